@@ -0,0 +1,116 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "AsyncRecordWriter.h"
+
+#include <memory>
+
+#include "atlas_io/Trace.h"
+#include "atlas_io/detail/Assert.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+AsyncRecordWriter::AsyncRecordWriter(size_t max_in_flight): max_in_flight_(max_in_flight) {
+    ATLAS_IO_ASSERT(max_in_flight_ > 0);
+    thread_ = std::thread([this]() { run(); });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+AsyncRecordWriter::~AsyncRecordWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    task_available_.notify_one();
+    thread_.join();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+std::shared_future<size_t> AsyncRecordWriter::write(RecordWriter&& record, const eckit::PathName& path, Mode mode) {
+    ATLAS_IO_TRACE("AsyncRecordWriter::write");
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        task_done_.wait(lock, [this]() { return in_flight_ < max_in_flight_; });
+        ++in_flight_;
+    }
+
+    // Copy referenced data now; the caller may modify it as soon as we return
+    auto snapshot = std::make_shared<RecordWriter>(std::move(record));
+    try {
+        snapshot->snapshot();
+    }
+    catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --in_flight_;
+        }
+        task_done_.notify_all();
+        throw;
+    }
+
+    std::packaged_task<size_t()> task([snapshot, path, mode]() { return snapshot->write(path, mode); });
+    std::shared_future<size_t> future = task.get_future().share();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.emplace_back(std::move(task));
+    }
+    task_available_.notify_one();
+    return future;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void AsyncRecordWriter::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    task_done_.wait(lock, [this]() { return in_flight_ == 0; });
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+size_t AsyncRecordWriter::in_flight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return in_flight_;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void AsyncRecordWriter::run() {
+    TraceHookRegistry::enabled_on_this_thread() = false;
+    while (true) {
+        std::packaged_task<size_t()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            task_available_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;  // stop_ is only honoured once all submitted records are written
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        task();  // exceptions are stored in the shared state of the future
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --in_flight_;
+        }
+        task_done_.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
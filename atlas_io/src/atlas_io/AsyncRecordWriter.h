@@ -0,0 +1,85 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas_io/FileStream.h"
+#include "atlas_io/RecordWriter.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @class AsyncRecordWriter
+/// @brief Write records on a background thread
+///
+/// Records are written in the order they are submitted, so that several records can be appended to the same file.
+/// Referenced data is copied on the calling thread before write() returns, so that it can be modified right away;
+/// compression, checksumming and file I/O happen on the background thread.
+///
+/// At most max_in_flight records are held in memory at any time. When this limit is reached, write() blocks until
+/// the oldest record has been written. The default of 2 gives double buffering: one record is written while the
+/// next one is prepared.
+///
+/// Usage:
+///
+///     AsyncRecordWriter writer;
+///     for (int step = 0; step < nsteps; ++step) {
+///         RecordWriter record;
+///         record.set("field", ref(field));
+///         writer.write(std::move(record), "output.atlas", Mode::append);
+///     }
+///     writer.wait();
+class AsyncRecordWriter {
+public:
+    explicit AsyncRecordWriter(size_t max_in_flight = 2);
+
+    /// @brief Waits for all submitted records to be written
+    ~AsyncRecordWriter();
+
+    AsyncRecordWriter(const AsyncRecordWriter&) = delete;
+    AsyncRecordWriter& operator=(const AsyncRecordWriter&) = delete;
+
+    /// @brief Submit record to be written to path
+    /// @return future to the written record length. Errors while writing are rethrown by future::get()
+    std::shared_future<size_t> write(RecordWriter&&, const eckit::PathName&, Mode = Mode::write);
+
+    /// @brief Block until all submitted records are written
+    void wait();
+
+    /// @brief Number of records submitted but not yet written
+    size_t in_flight() const;
+
+private:
+    void run();
+
+    const size_t max_in_flight_;
+    std::deque<std::packaged_task<size_t()>> queue_;
+    size_t in_flight_{0};
+    bool stop_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable task_available_;
+    std::condition_variable task_done_;
+    std::thread thread_;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -10,14 +10,22 @@
 
 #include "Data.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "eckit/utils/Compressor.h"
+#include "eckit/utils/Hash.h"
 
+#include "atlas_io/Exceptions.h"
 #include "atlas_io/Stream.h"
 #include "atlas_io/Trace.h"
 #include "atlas_io/detail/Assert.h"
 #include "atlas_io/detail/Checksum.h"
+#include "atlas_io/detail/Defaults.h"
+#include "atlas_io/detail/ParallelFor.h"
 
 namespace atlas {
 namespace io {
@@ -26,16 +34,32 @@ namespace io {
 
 Data::Data(void* p, size_t size): buffer_(p, size), size_(size) {}
 
+Data::Data(const void* p, size_t size, std::shared_ptr<const void> owner):
+    size_(size), external_(p), owner_(std::move(owner)) {}
+
+// Copy referenced external memory into an owned buffer, so that it can be modified
+void Data::release_external() {
+    if (external_) {
+        eckit::Buffer buffer(external_, size_);
+        buffer_   = std::move(buffer);
+        external_ = nullptr;
+        owner_.reset();
+    }
+}
+
 std::uint64_t Data::write(Stream& out) const {
     ATLAS_IO_TRACE();
     if (size()) {
-        ATLAS_IO_ASSERT(buffer_.size() >= size());
-        return out.write(buffer_.data(), size());
+        ATLAS_IO_ASSERT(external_ || buffer_.size() >= size());
+        return out.write(data(), size());
     }
     return 0;
 }
 
 std::uint64_t Data::read(Stream& in, size_t size) {
+    if (external_) {
+        clear();
+    }
     if (size > size_) {
         buffer_.resize(size);
         size_ = size;
@@ -44,51 +68,177 @@ std::uint64_t Data::read(Stream& in, size_t size) {
 }
 
 
-void Data::compress(const std::string& compression) {
+namespace {
+
+size_t nb_chunks(size_t size, size_t chunk_size) {
+    return (size + chunk_size - 1) / chunk_size;
+}
+
+size_t chunk_length(size_t chunk, size_t size, size_t chunk_size) {
+    return std::min(chunk_size, size - chunk * chunk_size);
+}
+
+bool chunked(size_t size, size_t chunk_size) {
+    return chunk_size > 0 && size > chunk_size;
+}
+
+std::unique_ptr<eckit::Compressor> make_compressor(const std::string& compression) {
+    return std::unique_ptr<eckit::Compressor>(eckit::CompressorFactory::instance().build(compression));
+}
+
+}  // namespace
+
+void Data::compress(const std::string& compression, size_t chunk_size) {
     ATLAS_IO_TRACE("compress(" + compression + ")");
     if (size_) {
-        auto compressor = std::unique_ptr<eckit::Compressor>(eckit::CompressorFactory::instance().build(compression));
+        auto compressor = make_compressor(compression);
         if (dynamic_cast<eckit::NoCompressor*>(compressor.get())) {
             return;
         }
-        eckit::Buffer compressed(size_t(1.2 * size_));
-        size_   = compressor->compress(buffer_, size_, compressed);
-        buffer_ = std::move(compressed);
+        if (not chunked(size_, chunk_size)) {
+            release_external();
+            eckit::Buffer compressed(size_t(1.2 * size_));
+            size_   = compressor->compress(buffer_, size_, compressed);
+            buffer_ = std::move(compressed);
+            return;
+        }
+
+        // Each chunk is compressed by its own compressor, as compressors may hold state
+        const size_t nchunks = nb_chunks(size_, chunk_size);
+        const char* in       = static_cast<const char*>(data());
+        std::vector<eckit::Buffer> chunks(nchunks);
+        std::vector<std::uint64_t> header(1 + nchunks);
+        header[0] = nchunks;
+        parallel_for(nchunks, [&](size_t c) {
+            size_t length = chunk_length(c, size_, chunk_size);
+            auto chunk_compressor = make_compressor(compression);
+            eckit::Buffer compressed(size_t(1.2 * length));
+            header[1 + c] = chunk_compressor->compress(in + c * chunk_size, length, compressed);
+            chunks[c]     = std::move(compressed);
+        });
+
+        std::vector<size_t> offsets(nchunks + 1);
+        offsets[0] = header.size() * sizeof(std::uint64_t);
+        for (size_t c = 0; c < nchunks; ++c) {
+            offsets[c + 1] = offsets[c] + header[1 + c];
+        }
+
+        eckit::Buffer compressed(offsets[nchunks]);
+        char* out = static_cast<char*>(compressed.data());
+        ::memcpy(out, header.data(), offsets[0]);
+        parallel_for(nchunks, [&](size_t c) { ::memcpy(out + offsets[c], chunks[c].data(), header[1 + c]); });
+
+        buffer_   = std::move(compressed);
+        size_     = offsets[nchunks];
+        external_ = nullptr;
+        owner_.reset();
     }
 }
 
-void Data::decompress(const std::string& compression, size_t uncompressed_size) {
+void Data::decompress(const std::string& compression, size_t uncompressed_size, size_t chunk_size) {
     ATLAS_IO_TRACE("decompress(" + compression + ")");
 
-    auto compressor = std::unique_ptr<eckit::Compressor>(eckit::CompressorFactory::instance().build(compression));
+    auto compressor = make_compressor(compression);
     if (dynamic_cast<eckit::NoCompressor*>(compressor.get())) {
         return;
     }
+    if (not chunked(uncompressed_size, chunk_size)) {
+        release_external();
+
+        eckit::Buffer uncompressed(size_t(1.2 * uncompressed_size));
+        compressor->uncompress(buffer_, size_, uncompressed, uncompressed_size);
+        size_   = uncompressed_size;
+        buffer_ = std::move(uncompressed);
+        return;
+    }
+
+    const size_t nchunks = nb_chunks(uncompressed_size, chunk_size);
+    const char* in       = static_cast<const char*>(data());
+    std::vector<std::uint64_t> header(1 + nchunks);
+    if (size_ < header.size() * sizeof(std::uint64_t)) {
+        throw DataCorruption("Compressed data is too small to contain " + std::to_string(nchunks) + " chunks");
+    }
+    ::memcpy(header.data(), in, header.size() * sizeof(std::uint64_t));
+    if (header[0] != nchunks) {
+        throw DataCorruption("Compressed data contains " + std::to_string(header[0]) + " chunks, expected " +
+                             std::to_string(nchunks));
+    }
+
+    std::vector<size_t> offsets(nchunks + 1);
+    offsets[0] = header.size() * sizeof(std::uint64_t);
+    for (size_t c = 0; c < nchunks; ++c) {
+        offsets[c + 1] = offsets[c] + header[1 + c];
+    }
+    if (offsets[nchunks] > size_) {
+        throw DataCorruption("Compressed chunks exceed size of compressed data");
+    }
+
+    eckit::Buffer uncompressed(uncompressed_size);
+    char* out = static_cast<char*>(uncompressed.data());
+    parallel_for(nchunks, [&](size_t c) {
+        size_t length         = chunk_length(c, uncompressed_size, chunk_size);
+        auto chunk_compressor = make_compressor(compression);
+        eckit::Buffer chunk(size_t(1.2 * length));
+        chunk_compressor->uncompress(in + offsets[c], header[1 + c], chunk, length);
+        ::memcpy(out + c * chunk_size, chunk.data(), length);
+    });
 
-    eckit::Buffer uncompressed(size_t(1.2 * uncompressed_size));
-    compressor->uncompress(buffer_, size_, uncompressed, uncompressed_size);
-    size_   = uncompressed_size;
-    buffer_ = std::move(uncompressed);
+    buffer_   = std::move(uncompressed);
+    size_     = uncompressed_size;
+    external_ = nullptr;
+    owner_.reset();
 }
 
 void Data::clear() {
-    buffer_ = eckit::Buffer{};
-    size_   = 0;
+    buffer_   = eckit::Buffer{};
+    size_     = 0;
+    external_ = nullptr;
+    owner_.reset();
 }
 
-std::string Data::checksum(const std::string& algorithm) const {
-    return atlas::io::checksum(buffer_, size_, algorithm);
+std::string Data::checksum(const std::string& algorithm, size_t chunk_size) const {
+    if (not chunked(size_, chunk_size)) {
+        return atlas::io::checksum(data(), size_, algorithm);
+    }
+    ATLAS_IO_TRACE("checksum(chunked)");
+
+    // Resolve the algorithm once, so that all chunks agree, then hash chunks without tracing from worker threads
+    std::string alg = algorithm.empty() ? defaults::checksum_algorithm() : algorithm;
+    if (not eckit::HashFactory::instance().has(alg)) {
+        alg = "none";
+    }
+
+    const size_t nchunks = nb_chunks(size_, chunk_size);
+    const char* in       = static_cast<const char*>(data());
+    std::vector<std::string> checksums(nchunks);
+    parallel_for(nchunks, [&](size_t c) {
+        std::unique_ptr<eckit::Hash> hasher(eckit::HashFactory::instance().build(alg));
+        checksums[c] = hasher->compute(in + c * chunk_size, long(chunk_length(c, size_, chunk_size)));
+    });
+
+    std::string concatenated;
+    for (auto& c : checksums) {
+        concatenated += c;
+    }
+    std::unique_ptr<eckit::Hash> hasher(eckit::HashFactory::instance().build(alg));
+    return alg + ":" + hasher->compute(concatenated.data(), long(concatenated.size()));
 }
 
 void Data::assign(const Data& other) {
+    if (external_) {
+        clear();
+    }
     if (other.size() > buffer_.size()) {
         buffer_.resize(other.size());
     }
     size_ = other.size();
-    buffer_.copy(other.buffer_, size_);
+    buffer_.copy(other.data(), size_);
 }
 
 void Data::assign(const void* p, size_t s) {
+    if (external_) {
+        clear();
+    }
     if (s > size()) {
         buffer_.resize(s);
     }
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 
 #include "eckit/io/Buffer.h"
 
@@ -25,26 +26,52 @@ class Data {
 public:
     Data() = default;
     Data(void*, size_t);
+
+    /// @brief Reference external memory, e.g. a memory mapped file, without copying.
+    /// The memory is kept alive by the shared owner for as long as it is referenced.
+    Data(const void*, size_t, std::shared_ptr<const void> owner);
+
     Data(Data&&)            = default;
     Data& operator=(Data&&) = default;
 
     operator const void*() const { return data(); }
-    const void* data() const { return buffer_.data(); }
+    const void* data() const { return external_ ? external_ : buffer_.data(); }
     size_t size() const { return size_; }
 
+    /// @brief True if data references external memory instead of owning a buffer
+    bool external() const { return external_ != nullptr; }
+
+    /// @brief Shared owner of external memory, to be held by objects that keep referencing it
+    const std::shared_ptr<const void>& owner() const { return owner_; }
+
     void assign(const Data& other);
     void assign(const void*, size_t);
     void clear();
 
     std::uint64_t write(Stream& out) const;
     std::uint64_t read(Stream& in, size_t size);
-    void compress(const std::string& compression);
-    void decompress(const std::string& compression, size_t uncompressed_size);
-    std::string checksum(const std::string& algorithm = "") const;
+
+    /// @brief Compress data in place.
+    /// With chunk_size > 0 and data larger than chunk_size, the data is split into chunks of chunk_size bytes
+    /// which are compressed independently and in parallel. The compressed layout is then
+    ///     [uint64 nb_chunks][uint64 compressed_size] x nb_chunks [compressed chunk] x nb_chunks
+    void compress(const std::string& compression, size_t chunk_size = 0);
+
+    /// @brief Decompress data in place. The chunk_size must match the one used for compress()
+    void decompress(const std::string& compression, size_t uncompressed_size, size_t chunk_size = 0);
+
+    /// @brief Compute checksum of the data.
+    /// With chunk_size > 0 and data larger than chunk_size, the checksums of each chunk are computed in parallel,
+    /// and the returned checksum is the checksum of the concatenated chunk checksums.
+    std::string checksum(const std::string& algorithm = "", size_t chunk_size = 0) const;
 
 private:
+    void release_external();
+
     eckit::Buffer buffer_;
     size_t size_{0};
+    const void* external_{nullptr};
+    std::shared_ptr<const void> owner_;
 };
 
 //---------------------------------------------------------------------------------------------------------------------
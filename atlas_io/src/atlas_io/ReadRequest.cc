@@ -102,7 +102,8 @@ void ReadRequest::checksum() {
         return;
     }
 
-    Checksum computed_checksum{item_->data().checksum(encoded_checksum.algorithm())};
+    Checksum computed_checksum{
+        item_->data().checksum(encoded_checksum.algorithm(), item_->metadata().data.chunk_size())};
 
     if (computed_checksum.available() && (computed_checksum.str() != encoded_checksum.str())) {
         std::stringstream err;
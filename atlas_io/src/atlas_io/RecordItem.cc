@@ -98,7 +98,7 @@ void RecordItem::clear() {
 void RecordItem::decompress() {
     ATLAS_IO_ASSERT(not empty());
     if (metadata().data.compressed()) {
-        data_.decompress(metadata().data.compression(), metadata().data.size());
+        data_.decompress(metadata().data.compression(), metadata().data.size(), metadata().data.chunk_size());
     }
     metadata_->data.compressed(false);
 }
@@ -108,7 +108,7 @@ void RecordItem::decompress() {
 void RecordItem::compress() {
     ATLAS_IO_ASSERT(not empty());
     if (not metadata().data.compressed() && metadata().data.compression() != "none") {
-        data_.compress(metadata().data.compression());
+        data_.compress(metadata().data.compression(), metadata().data.chunk_size());
         metadata_->data.compressed(true);
     }
 }
@@ -10,6 +10,9 @@
 
 #include "RecordItemReader.h"
 
+#include <cstring>
+#include <memory>
+
 #include "atlas_io/Exceptions.h"
 #include "atlas_io/FileStream.h"
 #include "atlas_io/Record.h"
@@ -79,6 +82,35 @@ static Data read_data(const Record& record, int data_section_index, Stream in) {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+static Data map_data(const Record& record, int data_section_index, const std::string& path, MemoryMap::Access access) {
+    ATLAS_IO_TRACE("map_data(data_section=" + std::to_string(data_section_index) + ")");
+    if (data_section_index == 0) {
+        return atlas::io::Data();
+    }
+
+    const auto& parsed       = static_cast<const ParsedRecord&>(record);
+    const auto& data_section = parsed.data_sections.at(size_t(data_section_index) - 1);
+
+    auto mapping = std::make_shared<MemoryMap>(path, data_section.offset, size_t(data_section.length), access);
+    const char* section_begin = static_cast<const char*>(mapping->data());
+
+    RecordDataSection::Begin data_begin;
+    ::memcpy(&data_begin, section_begin, sizeof(data_begin));
+    if (not data_begin.valid()) {
+        throw InvalidRecord("Data section is not valid");
+    }
+    auto data_size = size_t(data_section.length) - sizeof(RecordDataSection::Begin) - sizeof(RecordDataSection::End);
+    RecordDataSection::End data_end;
+    ::memcpy(&data_end, section_begin + sizeof(RecordDataSection::Begin) + data_size, sizeof(data_end));
+    if (not data_end.valid()) {
+        throw InvalidRecord("Data section is not valid");
+    }
+    const void* data = section_begin + sizeof(RecordDataSection::Begin);
+    return atlas::io::Data(data, data_size, std::shared_ptr<const void>(mapping, data));
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 static eckit::PathName make_absolute_path(const std::string& reference_path, RecordItem::URI& uri) {
     eckit::PathName absolute_path = uri.path;
     if (reference_path.size() && uri.path[0] != '/' && uri.path[0] != '~') {
@@ -225,5 +257,34 @@ void RecordItemReader::read(io::Metadata& metadata, io::Data& data) {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+void RecordItemReader::map(io::Metadata& metadata, io::Data& data, MemoryMap::Access access) {
+    if (in_) {
+        read_from_stream(record_, in_, uri_.key, metadata, data);
+        return;
+    }
+
+    ATLAS_IO_TRACE("RecordItemReader::map(" + uri_.path + ":" + uri_.key + ")");
+
+    metadata = record_.metadata(uri_.key);
+
+    auto absolute_path = make_absolute_path(ref_, uri_);
+
+    if (metadata.link()) {
+        Metadata linked;
+        RecordItemReader{absolute_path.dirName(), metadata.link()}.map(linked, data, access);
+        metadata.link(std::move(linked));
+    }
+    else if (metadata.data.section()) {
+        if (metadata.data.compressed()) {
+            data = atlas::io::read_data(record_, metadata.data.section(), InputFileStream(absolute_path));
+        }
+        else {
+            data = atlas::io::map_data(record_, metadata.data.section(), absolute_path, access);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
 }  // namespace io
 }  // namespace atlas
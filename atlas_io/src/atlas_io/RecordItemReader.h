@@ -15,6 +15,7 @@
 #include "atlas_io/Record.h"
 #include "atlas_io/RecordItem.h"
 #include "atlas_io/Stream.h"
+#include "atlas_io/detail/MemoryMap.h"
 
 namespace atlas {
 namespace io {
@@ -35,6 +36,12 @@ public:
 
     void read(Metadata&, Data&);
 
+    /// @brief Read metadata, and map the data of an uncompressed item directly from file into memory.
+    ///
+    /// The returned Data references the mapped file without copying and keeps the mapping alive (see Data::owner()).
+    /// Items that are compressed or not file based are read as with read(Metadata&, Data&).
+    void map(Metadata&, Data&, MemoryMap::Access = MemoryMap::Access::read_only);
+
 private:
     RecordItemReader(const std::string& ref, const std::string& uri);
 
@@ -43,6 +43,19 @@ inline void write_string(OStream& out, const std::string& s) {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+template <typename OStream>
+inline void write_padding(OStream& out, size_t alignment) {
+    if (alignment > 1) {
+        size_t misalignment = (out.position() + sizeof(RecordDataSection::Begin)) % alignment;
+        if (misalignment) {
+            std::string padding(alignment - misalignment, '\0');
+            write_string(out, padding);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 size_t RecordWriter::write(Stream out) const {
     ATLAS_IO_TRACE("RecordWriter::write");
     RecordHead r;
@@ -94,7 +107,8 @@ size_t RecordWriter::write(Stream out) const {
             }
             atlas::io::Data data;
             encode_data(encoder, data);
-            data.compress(info.compression());
+            data.compress(info.compression(), info.chunk_size());
+            atlas::io::write_padding(out, alignment_);
             auto& data_section  = index[i];
             data_section.offset = position();
             atlas::io::write_struct(out, RecordDataSection::Begin());
@@ -103,7 +117,7 @@ size_t RecordWriter::write(Stream out) const {
             }
             atlas::io::write_struct(out, RecordDataSection::End());
             data_section.length   = position() - data_section.offset;
-            data_section.checksum = do_checksum_ ? data.checksum() : std::string("none:");
+            data_section.checksum = do_checksum_ ? data.checksum("", info.chunk_size()) : std::string("none:");
             ++i;
         }
     }
@@ -157,6 +171,18 @@ void RecordWriter::checksum(bool on) {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+void RecordWriter::alignment(size_t bytes) {
+    alignment_ = bytes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void RecordWriter::chunk_size(size_t bytes) {
+    chunk_size_ = bytes;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 void RecordWriter::set(const RecordWriter::Key& key, Link&& link, const eckit::Configuration&) {
     keys_.emplace_back(key);
     encoders_[key] = std::move(Encoder{link});
@@ -170,6 +196,7 @@ void RecordWriter::set(const RecordWriter::Key& key, Encoder&& encoder, const ec
     if (encoder.encodes_data()) {
         ++nb_data_sections_;
         info.compression(config.getString("compression", compression_));
+        info.chunk_size(size_t(config.getLong("chunk_size", long(chunk_size_))));
         info.section(nb_data_sections_);
     }
     keys_.emplace_back(key);
@@ -191,6 +218,23 @@ size_t RecordWriter::write(eckit::DataHandle& out) const {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+void RecordWriter::snapshot() {
+    ATLAS_IO_TRACE("RecordWriter::snapshot");
+    for (auto& key : keys_) {
+        if (info_.at(key).section() == 0) {
+            continue;
+        }
+        auto& encoder = encoders_.at(key);
+        atlas::io::Metadata metadata;
+        atlas::io::Data data;
+        encode_metadata(encoder, metadata);
+        encode_data(encoder, data);
+        encoder = Encoder{RecordItem(std::move(metadata), std::move(data))};
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 size_t RecordWriter::estimateMaximumSize() const {
     size_t size{0};
 
@@ -210,11 +254,18 @@ size_t RecordWriter::estimateMaximumSize() const {
         if (info.section() == 0) {
             continue;
         }
+        if (alignment_ > 1) {
+            size += alignment_ - 1;
+        }
         size += sizeof(RecordDataSection::Begin);
         {
             atlas::io::Metadata m;
             size_t max_data_size = encode_metadata(encoder, m);
             if (info.compression() != "none") {
+                if (info.chunk_size() && max_data_size > info.chunk_size()) {
+                    size_t nb_chunks = (max_data_size + info.chunk_size() - 1) / info.chunk_size();
+                    max_data_size += (1 + nb_chunks) * sizeof(std::uint64_t);
+                }
                 max_data_size = size_t(1.2 * max_data_size);
                 max_data_size = std::max<size_t>(max_data_size, 10 * 1024);  // minimum 10KB
             }
@@ -242,6 +293,9 @@ std::string RecordWriter::metadata() const {
             if (info.compression() != "none") {
                 m.set("data.compression.type", info.compression());
             }
+            if (info.chunk_size()) {
+                m.set("data.chunk_size", info.chunk_size());
+            }
         }
         metadata.set(key, m);
     }
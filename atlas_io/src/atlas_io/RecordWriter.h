@@ -59,6 +59,16 @@ public:
     /// @brief Set checksum off or to default
     void checksum(bool);
 
+    /// @brief Align data of each data section to a multiple of given bytes within the written stream,
+    /// by padding in front of the data section. Aligned uncompressed data can be memory mapped and
+    /// used in place, see RecordItemReader::map(). Default is 0: no padding.
+    void alignment(size_t bytes);
+
+    /// @brief Split data sections larger than given bytes into chunks that are compressed and checksummed
+    /// independently and in parallel, see Data::compress(). Default is 0, or $ATLAS_IO_CHUNK_SIZE: no chunking.
+    /// Can be overridden per item with configuration key "chunk_size".
+    void chunk_size(size_t bytes);
+
     // -- set( Key, Value ) where Value can be a variety of things
 
     /// @brief Add link to other record item (RecordItem::URI)
@@ -110,6 +120,10 @@ public:
     /// @pre The Stream must be opened for Write access.
     size_t write(Stream) const;
 
+    /// @brief Replace referenced data by owned copies, so that the record can still be written after
+    /// the referenced data was modified or went out of scope, e.g. by AsyncRecordWriter
+    void snapshot();
+
     /// @brief estimate maximum size of record
     ///
     /// This could be useful to write a record to a fixed size MemoryHandle
@@ -127,6 +141,8 @@ private:
     std::string compression_{defaults::compression_algorithm()};
     int do_checksum_{defaults::checksum_write()};
     int nb_data_sections_{0};
+    size_t alignment_{0};
+    size_t chunk_size_{defaults::chunk_size()};
 
     std::string metadata() const;
 };
@@ -16,6 +16,9 @@ namespace atlas {
 namespace io {
 
 atlas::io::Trace::Trace(const eckit::CodeLocation& loc) {
+    if (not TraceHookRegistry::enabled_on_this_thread()) {
+        return;
+    }
     for (size_t id = 0; id < TraceHookRegistry::size(); ++id) {
         if (TraceHookRegistry::enabled(id)) {
             hooks_.emplace_back(TraceHookRegistry::hook(id)(loc, loc.func()));
@@ -24,6 +27,9 @@ atlas::io::Trace::Trace(const eckit::CodeLocation& loc) {
 }
 
 Trace::Trace(const eckit::CodeLocation& loc, const std::string& title) {
+    if (not TraceHookRegistry::enabled_on_this_thread()) {
+        return;
+    }
     for (size_t id = 0; id < TraceHookRegistry::size(); ++id) {
         if (TraceHookRegistry::enabled(id)) {
             hooks_.emplace_back(TraceHookRegistry::hook(id)(loc, title));
@@ -32,6 +38,9 @@ Trace::Trace(const eckit::CodeLocation& loc, const std::string& title) {
 }
 
 Trace::Trace(const eckit::CodeLocation& loc, const std::string& title, const Labels& labels) {
+    if (not TraceHookRegistry::enabled_on_this_thread()) {
+        return;
+    }
     for (size_t id = 0; id < TraceHookRegistry::size(); ++id) {
         if (TraceHookRegistry::enabled(id)) {
             hooks_.emplace_back(TraceHookRegistry::hook(id)(loc, title));
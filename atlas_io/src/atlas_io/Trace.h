@@ -54,6 +54,12 @@ struct TraceHookRegistry {
     static TraceHookBuilder& hook(size_t id) { return instance().hooks[id]; }
     static size_t invalidId() { return std::numeric_limits<size_t>::max(); }
 
+    /// Hooks are not required to be thread-safe, so they can be switched off for background threads
+    static bool& enabled_on_this_thread() {
+        thread_local bool enabled = true;
+        return enabled;
+    }
+
 private:
     TraceHookRegistry() = default;
 };
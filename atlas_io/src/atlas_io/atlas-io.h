@@ -19,6 +19,7 @@
 #include "atlas_io/detail/StaticAssert.h"
 #include "atlas_io/detail/sfinae.h"
 
+#include "atlas_io/AsyncRecordWriter.h"
 #include "atlas_io/Exceptions.h"
 #include "atlas_io/FileStream.h"
 #include "atlas_io/Record.h"
@@ -41,6 +41,10 @@ public:
 
     bool compressed() const { return compression_ != "none"; }
 
+    /// @brief Data larger than chunk_size is compressed and checksummed in independent chunks. 0: no chunking
+    size_t chunk_size() const { return chunk_size_; }
+    void chunk_size(size_t s) { chunk_size_ = s; }
+
     operator bool() const { return section_ > 0; }
 
     const Checksum& checksum() const { return checksum_; }
@@ -55,6 +59,7 @@ private:
     Endian endian_{Endian::native};
     size_t uncompressed_size_{0};
     size_t compressed_size_{0};
+    size_t chunk_size_{0};
 };
 
 }  // namespace io
@@ -10,7 +10,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
+#include <thread>
 
 #include "eckit/config/Resource.h"
 
@@ -39,6 +41,22 @@ namespace defaults {
     return compression;
 }
 
+/// Size in bytes of chunks that data sections are split into for parallel compression and checksumming.
+/// Default is 0: no chunking.
+[[maybe_unused]] static size_t chunk_size() {
+    static size_t chunk_size = size_t(eckit::Resource<long>("atlas.io.chunk_size;$ATLAS_IO_CHUNK_SIZE", 0));
+    return chunk_size;
+}
+
+/// Number of threads used to process chunks. Default is 0: hardware concurrency.
+[[maybe_unused]] static size_t nb_threads() {
+    static size_t nb_threads = [] {
+        long n = eckit::Resource<long>("atlas.io.threads;$ATLAS_IO_THREADS", 0);
+        return n > 0 ? size_t(n) : std::max<size_t>(1, std::thread::hardware_concurrency());
+    }();
+    return nb_threads;
+}
+
 
 }  // namespace defaults
 }  // namespace io
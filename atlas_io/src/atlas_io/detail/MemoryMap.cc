@@ -0,0 +1,75 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "MemoryMap.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "atlas_io/Exceptions.h"
+#include "atlas_io/Trace.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+MemoryMap::MemoryMap(const std::string& path, std::uint64_t offset, size_t length, Access access) {
+    ATLAS_IO_TRACE("MemoryMap(" + path + ")");
+    size_ = length;
+    if (length == 0) {
+        return;
+    }
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw Exception("Could not open " + path + " for memory mapping: " + std::strerror(errno), Here());
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || std::uint64_t(st.st_size) < offset + length) {
+        ::close(fd);
+        throw InvalidRecord("Cannot memory map range [" + std::to_string(offset) + "," +
+                            std::to_string(offset + length) + ") beyond end of file " + path);
+    }
+
+    const std::uint64_t page_size      = std::uint64_t(::sysconf(_SC_PAGESIZE));
+    const std::uint64_t aligned_offset = offset - offset % page_size;
+    mapped_length_                     = length + size_t(offset - aligned_offset);
+
+    int prot = (access == Access::copy_on_write) ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    address_ = ::mmap(nullptr, mapped_length_, prot, MAP_PRIVATE, fd, off_t(aligned_offset));
+    int mmap_errno = errno;
+    ::close(fd);  // the mapping keeps its own reference to the file
+
+    if (address_ == MAP_FAILED) {
+        address_ = nullptr;
+        throw Exception("Could not memory map " + path + ": " + std::strerror(mmap_errno), Here());
+    }
+    data_ = static_cast<char*>(address_) + (offset - aligned_offset);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+MemoryMap::~MemoryMap() {
+    if (address_) {
+        ::munmap(address_, mapped_length_);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,57 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// Memory mapping of a byte range of a file.
+///
+/// The mapping is always private to the process: with Access::copy_on_write the mapped pages can be
+/// modified in memory, without the modifications being written back to the file.
+class MemoryMap {
+public:
+    enum class Access
+    {
+        read_only,
+        copy_on_write
+    };
+
+    MemoryMap(const std::string& path, std::uint64_t offset, size_t length, Access = Access::read_only);
+
+    MemoryMap(const MemoryMap&) = delete;
+    MemoryMap& operator=(const MemoryMap&) = delete;
+
+    ~MemoryMap();
+
+    /// @brief Pointer to the first byte of the requested range
+    void* data() const { return data_; }
+
+    /// @brief Length of the requested range in bytes
+    size_t size() const { return size_; }
+
+private:
+    void* address_{nullptr};  // page aligned address returned by mmap
+    size_t mapped_length_{0};
+    void* data_{nullptr};
+    size_t size_{0};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,70 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+#include "atlas_io/detail/Defaults.h"
+#include "atlas_io/detail/ThreadPool.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Call f(i) for i in [0,n) using up to defaults::nb_threads() threads of the ThreadPool.
+/// Tasks are handed out dynamically, so that tasks of unequal cost are balanced.
+/// The calling thread takes part in the work. The first exception thrown by a task is rethrown
+/// after all threads have finished; remaining tasks are then skipped.
+template <typename Functor>
+void parallel_for(size_t n, const Functor& f) {
+    size_t nb_threads = std::min(n, defaults::nb_threads());
+    if (nb_threads <= 1) {
+        for (size_t i = 0; i < n; ++i) {
+            f(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    std::function<void()> work = [&]() {
+        try {
+            for (size_t i = next++; i < n; i = next++) {
+                f(i);
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (not error) {
+                error = std::current_exception();
+            }
+            next = n;
+        }
+    };
+
+    ThreadPool::instance().run(nb_threads, work);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,93 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+#include "atlas_io/detail/Defaults.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+ThreadPool& ThreadPool::instance() {
+    static ThreadPool pool(defaults::nb_threads() - 1);
+    return pool;
+}
+
+ThreadPool::ThreadPool(size_t nb_workers) {
+    workers_.reserve(nb_workers);
+    for (size_t t = 0; t < nb_workers; ++t) {
+        workers_.emplace_back([this] { work(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ThreadPool::work() {
+    size_t seen = 0;
+    while (true) {
+        const std::function<void()>* task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&] { return stop_ || (generation_ != seen && requested_ > 0); });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+            --requested_;
+            task = task_;
+        }
+        (*task)();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                done_.notify_all();
+            }
+        }
+    }
+}
+
+void ThreadPool::run(size_t nb_threads, const std::function<void()>& task) {
+    std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+    const size_t helpers = nb_threads > 1 ? std::min(nb_threads - 1, workers_.size()) : 0;
+    if (not run_lock.owns_lock() || helpers == 0) {
+        task();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_      = &task;
+        requested_ = helpers;
+        pending_   = helpers;
+        ++generation_;
+    }
+    wake_.notify_all();
+    task();
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&] { return pending_ == 0; });
+    task_ = nullptr;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
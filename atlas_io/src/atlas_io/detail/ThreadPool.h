@@ -0,0 +1,64 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// Persistent pool of worker threads, created on first use with defaults::nb_threads() - 1 workers.
+///
+/// run() executes one task concurrently on the calling thread and on a number of workers, and returns when
+/// all of them have finished. Only one task runs on the pool at a time: a call to run() while the pool is busy,
+/// e.g. from another thread or from within a task, executes the task on the calling thread only.
+class ThreadPool {
+public:
+    static ThreadPool& instance();
+
+    /// @brief Number of worker threads, not counting the calling thread
+    size_t size() const { return workers_.size(); }
+
+    /// @brief Run task on the calling thread and on up to (nb_threads - 1) workers. The task must not throw.
+    void run(size_t nb_threads, const std::function<void()>& task);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+private:
+    explicit ThreadPool(size_t nb_workers);
+    ~ThreadPool();
+
+    void work();
+
+    std::vector<std::thread> workers_;
+    std::mutex run_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void()>* task_{nullptr};
+    size_t generation_{0};
+    size_t requested_{0};  // workers still to join the current task
+    size_t pending_{0};    // workers that have not yet finished the current task
+    bool stop_{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cstdint>
 #include <cstring>
 #include <fstream>
 #include <vector>
@@ -338,6 +339,152 @@ CASE("Test RecordItemReader") {
 
 //-----------------------------------------------------------------------------
 
+CASE("Memory mapped RecordItemReader") {
+    std::vector<double> v(1000);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = double(i);
+    }
+    std::string path = "record_mapped.atlas" + suffix();
+    {
+        io::RecordWriter record;
+        record.alignment(64);
+        record.set("v", io::ref(v), no_compression);
+        record.set("vc", io::ref(v));
+        record.write(path);
+    }
+    SECTION("uncompressed") {
+        io::Metadata metadata;
+        io::Data data;
+        {
+            io::RecordItemReader reader{"file:" + path + "?key=v"};
+            reader.map(metadata, data);
+        }
+        EXPECT(data.external());
+        EXPECT(data.owner() != nullptr);
+        EXPECT_EQ(data.size(), v.size() * sizeof(double));
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(data.data()) % 64, 0);
+        EXPECT(::memcmp(data, v.data(), data.size()) == 0);
+        if (metadata.data.checksum().available()) {
+            EXPECT_EQ(data.checksum(metadata.data.checksum().algorithm()), metadata.data.checksum().str());
+        }
+    }
+    SECTION("compressed falls back to read") {
+        io::Metadata metadata;
+        io::Data data;
+        io::RecordItemReader{"file:" + path + "?key=vc"}.map(metadata, data);
+        EXPECT(data.external() == not metadata.data.compressed());
+        data.decompress(metadata.data.compression(), metadata.data.size(), metadata.data.chunk_size());
+        EXPECT_EQ(data.size(), v.size() * sizeof(double));
+        EXPECT(::memcmp(data, v.data(), data.size()) == 0);
+    }
+    SECTION("copy on write") {
+        io::Metadata metadata;
+        io::Data data;
+        io::RecordItemReader{"file:" + path + "?key=v"}.map(metadata, data, io::MemoryMap::Access::copy_on_write);
+        EXPECT(data.external());
+        double* values = static_cast<double*>(const_cast<void*>(data.data()));
+        values[0]      = -1.;
+
+        std::vector<double> read;
+        io::RecordReader reader(path);
+        reader.read("v", read).wait();
+        EXPECT(read == v);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("Chunked compression and checksum") {
+    std::vector<double> v(100000);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = double(i % 1000);
+    }
+    const size_t chunk_size = 64 * 1024;
+    std::string path        = "record_chunked.atlas" + suffix();
+    {
+        io::RecordWriter record;
+        record.chunk_size(chunk_size);
+        record.set("v", io::ref(v));
+        eckit::LocalConfiguration unchunked;
+        unchunked.set("chunk_size", 0);
+        record.set("v_unchunked", io::ref(v), unchunked);
+        record.write(path);
+    }
+    SECTION("metadata") {
+        io::Metadata metadata;
+        io::Data data;
+        io::RecordItemReader{"file:" + path + "?key=v"}.read(metadata, data);
+        EXPECT_EQ(metadata.data.chunk_size(), chunk_size);
+        EXPECT_EQ(metadata.data.size(), v.size() * sizeof(double));
+        io::RecordItemReader{"file:" + path + "?key=v_unchunked"}.read(metadata, data);
+        EXPECT_EQ(metadata.data.chunk_size(), size_t(0));
+    }
+    SECTION("read") {
+        std::vector<double> read, read_unchunked;
+        io::RecordReader reader(path);
+        reader.read("v", read);
+        reader.read("v_unchunked", read_unchunked);
+        reader.wait();
+        EXPECT(read == v);
+        EXPECT(read_unchunked == v);
+    }
+    SECTION("Data") {
+        io::Data data(v.data(), v.size() * sizeof(double));
+        auto checksum = data.checksum("", chunk_size);
+        EXPECT_EQ(checksum, data.checksum("", chunk_size));
+        EXPECT_EQ(data.checksum(), data.checksum("", data.size()));
+        if (io::Checksum(checksum).available()) {
+            EXPECT(checksum != data.checksum());
+        }
+        data.compress(io::defaults::compression_algorithm(), chunk_size);
+        data.decompress(io::defaults::compression_algorithm(), v.size() * sizeof(double), chunk_size);
+        EXPECT_EQ(data.size(), v.size() * sizeof(double));
+        EXPECT(::memcmp(data, v.data(), data.size()) == 0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("Asynchronous write") {
+    std::string path = "record_async.atlas" + suffix();
+    std::vector<double> v(10000);
+    std::vector<std::shared_future<size_t>> lengths;
+    {
+        io::AsyncRecordWriter writer(2);
+        for (int step = 0; step < 4; ++step) {
+            for (size_t i = 0; i < v.size(); ++i) {
+                v[i] = double(step * 100000 + i);
+            }
+            io::RecordWriter record;
+            record.set("step", step);
+            record.set("v", io::ref(v));
+            lengths.emplace_back(writer.write(std::move(record), path, step == 0 ? io::Mode::write : io::Mode::append));
+            EXPECT(writer.in_flight() <= 2);
+            // Referenced data can be modified while the record is written in the background
+            std::fill(v.begin(), v.end(), -1.);
+        }
+        writer.wait();
+        EXPECT_EQ(writer.in_flight(), size_t(0));
+    }
+
+    size_t offset = 0;
+    for (int step = 0; step < 4; ++step) {
+        int read_step;
+        std::vector<double> read;
+        io::RecordReader reader(io::Record::URI{path, offset});
+        reader.read("step", read_step);
+        reader.read("v", read);
+        reader.wait();
+        EXPECT_EQ(read_step, step);
+        EXPECT_EQ(read.size(), v.size());
+        EXPECT_EQ(read.front(), double(step * 100000));
+        EXPECT_EQ(read.back(), double(step * 100000 + v.size() - 1));
+        offset += lengths[step].get();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 CASE("Read records from different files") {
     Arrays data1, data2, data3;
 
@@ -145,6 +145,93 @@ void forEach(idx_t idxMax, const Functor& functor) {
   }
 }
 
+// Loop over single elements of the last dimension. Unsequenced policies are
+// vectorised with "omp simd". Only used for loops that do not recurse, as simd
+// regions must not be nested.
+template <typename ExecutionPolicy, typename Functor>
+void forEachElement(idx_t idxMax, const Functor& functor) {
+  if constexpr (std::is_same_v<ExecutionPolicy,
+                               execution::parallel_unsequenced_policy>) {
+    atlas_omp_pragma(omp parallel for simd schedule(static))
+    for (auto idx = idx_t{}; idx < idxMax; ++idx) {
+      functor(idx);
+    }
+  } else if constexpr (std::is_same_v<ExecutionPolicy,
+                                      execution::unsequenced_policy>) {
+    atlas_omp_pragma(omp simd)
+    for (auto idx = idx_t{}; idx < idxMax; ++idx) {
+      functor(idx);
+    }
+  } else {
+    forEach<ExecutionPolicy>(idxMax, functor);
+  }
+}
+
+// Parallel loop over two collapsed dimensions. Each thread gets a contiguous
+// chunk of the combined index range, and increments both indices without
+// divisions in the loop.
+template <typename Functor>
+void forEachCollapsed(idx_t idxMax0, idx_t idxMax1, const Functor& functor) {
+  const size_t size = size_t(idxMax0) * size_t(idxMax1);
+  atlas_omp_parallel {
+    const size_t nbThreads = atlas_omp_get_num_threads();
+    const size_t thread = atlas_omp_get_thread_num();
+    const size_t begin = thread * size / nbThreads;
+    const size_t end = (thread + 1) * size / nbThreads;
+    if (begin < end) {
+      auto idx0 = static_cast<idx_t>(begin / size_t(idxMax1));
+      auto idx1 = static_cast<idx_t>(begin % size_t(idxMax1));
+      for (size_t idx = begin; idx < end; ++idx) {
+        functor(idx0, idx1);
+        if (++idx1 == idxMax1) {
+          idx1 = 0;
+          ++idx0;
+        }
+      }
+    }
+  }
+}
+
+// True if the next iteration dimension directly follows ItrDim.
+template <int ItrDim, int... ItrDims>
+struct AdjacentItrDim : std::false_type {};
+
+template <int ItrDim, int NextDim, int... ItrDims>
+struct AdjacentItrDim<ItrDim, NextDim, ItrDims...>
+    : std::bool_constant<NextDim == ItrDim + 1> {};
+
+// Collapse ItrDim with the next iteration dimension for parallel policies.
+// The parallel unsequenced policy keeps the innermost dimension for simd.
+template <typename ExecutionPolicy, int ItrDim, int... ItrDims>
+constexpr bool collapse() {
+  if constexpr (!execution::is_omp_policy<ExecutionPolicy>() ||
+                !AdjacentItrDim<ItrDim, ItrDims...>::value) {
+    return false;
+  } else if constexpr (std::is_same_v<ExecutionPolicy,
+                                      execution::parallel_unsequenced_policy>) {
+    return sizeof...(ItrDims) >= 2;
+  } else {
+    return true;
+  }
+}
+
+// True if ItrDim is the last dimension of all views. Together with integral
+// indices for all previous dimensions, each iteration selects a single element
+// of each view.
+template <int ItrDim, typename... ArrayViews>
+constexpr bool isLastDim(const std::tuple<ArrayViews...>*) {
+  return ((std::decay_t<ArrayViews>::rank() == ItrDim + 1) && ...);
+}
+
+template <int ItrDim, typename ArrayViewTuple>
+inline constexpr bool is_last_dim_v =
+    isLastDim<ItrDim>(static_cast<std::decay_t<ArrayViewTuple>*>(nullptr));
+
+// Element of a rank-1 slice, of the same type as a slice with all indices.
+template <typename Line>
+using element_t =
+    typename get_slice_type<typename std::decay_t<Line>::value_type, 0>::type;
+
 template <int NPad>
 constexpr auto argPadding() {
   if constexpr (NPad > 0) {
@@ -202,15 +289,26 @@ struct ArrayForEachImpl<ExecutionPolicy, Dim, ItrDim, ItrDims...> {
       // Get size of iteration dimenion from first view argument.
       const auto idxMax = std::get<0>(arrayViews).shape(ItrDim);
 
-      forEach<ExecutionPolicy>(idxMax, [&](idx_t idx) {
-        // Demote parallel execution policy to a non-parallel one in further
-        // recursion
-        ArrayForEachImpl<
-            execution::demote_policy_t<ExecutionPolicy>, Dim + 1,
-            ItrDims...>::apply(std::forward<ArrayViewTuple>(arrayViews), mask,
-                               function, tuplePushBack(slicerArgs, idx),
-                               tuplePushBack(maskArgs, idx));
-      });
+      if constexpr (collapse<ExecutionPolicy, ItrDim, ItrDims...>()) {
+        applyCollapsed(std::integer_sequence<int, ItrDims...>{},
+                       std::forward<ArrayViewTuple>(arrayViews), mask, function,
+                       slicerArgs, maskArgs);
+      } else if constexpr (sizeof...(ItrDims) == 0 &&
+                           (std::is_integral_v<SlicerArgs> && ...) &&
+                           is_last_dim_v<ItrDim, ArrayViewTuple>) {
+        applyLastDim(idxMax, std::forward<ArrayViewTuple>(arrayViews), mask,
+                     function, slicerArgs, maskArgs);
+      } else {
+        forEach<ExecutionPolicy>(idxMax, [&](idx_t idx) {
+          // Demote parallel execution policy to a non-parallel one in further
+          // recursion
+          ArrayForEachImpl<
+              execution::demote_policy_t<ExecutionPolicy>, Dim + 1,
+              ItrDims...>::apply(std::forward<ArrayViewTuple>(arrayViews),
+                                 mask, function, tuplePushBack(slicerArgs, idx),
+                                 tuplePushBack(maskArgs, idx));
+        });
+      }
     }
     // Add a RangeAll to arguments.
     else {
@@ -219,6 +317,68 @@ struct ArrayForEachImpl<ExecutionPolicy, Dim, ItrDim, ItrDims...> {
           tuplePushBack(slicerArgs, Range::all()), maskArgs);
     }
   }
+
+ private:
+  // Iterate over ItrDim and NextDim in a single parallel loop.
+  template <int NextDim, int... RemainingDims, typename ArrayViewTuple,
+            typename Mask, typename Function, typename... SlicerArgs,
+            typename... MaskArgs>
+  static void applyCollapsed(std::integer_sequence<int, NextDim, RemainingDims...>,
+                             ArrayViewTuple&& arrayViews, const Mask& mask,
+                             const Function& function,
+                             const std::tuple<SlicerArgs...>& slicerArgs,
+                             const std::tuple<MaskArgs...>& maskArgs) {
+    const auto idxMax0 = std::get<0>(arrayViews).shape(ItrDim);
+    const auto idxMax1 = std::get<0>(arrayViews).shape(NextDim);
+
+    forEachCollapsed(idxMax0, idxMax1, [&](idx_t idx0, idx_t idx1) {
+      ArrayForEachImpl<execution::demote_policy_t<ExecutionPolicy>, Dim + 2,
+                       RemainingDims...>::
+          apply(std::forward<ArrayViewTuple>(arrayViews), mask, function,
+                tuplePushBack(tuplePushBack(slicerArgs, idx0), idx1),
+                tuplePushBack(tuplePushBack(maskArgs, idx0), idx1));
+    });
+  }
+
+  // Iterate over the last dimension of all views. Lines along this dimension
+  // are sliced once, and elements are then addressed directly, with a
+  // specialised loop for unit stride which compilers can vectorise.
+  template <typename ArrayViewTuple, typename Mask, typename Function,
+            typename... SlicerArgs, typename... MaskArgs>
+  static void applyLastDim(idx_t idxMax, ArrayViewTuple&& arrayViews,
+                           const Mask& mask, const Function& function,
+                           const std::tuple<SlicerArgs...>& slicerArgs,
+                           const std::tuple<MaskArgs...>& maskArgs) {
+    auto lines =
+        makeSlices(slicerArgs, std::forward<ArrayViewTuple>(arrayViews));
+
+    const auto masked = [&](idx_t idx) {
+      if constexpr (std::is_same_v<Mask, NoMask>) {
+        return false;
+      } else {
+        return bool(std::apply(mask, tuplePushBack(maskArgs, idx)));
+      }
+    };
+
+    std::apply(
+        [&](auto&... line) {
+          if (((line.stride(0) == 1) && ...)) {
+            forEachElement<ExecutionPolicy>(idxMax, [&](idx_t idx) {
+              if (!masked(idx)) {
+                function(element_t<decltype(line)>{line.data()[idx]}...);
+              }
+            });
+          } else {
+            forEachElement<ExecutionPolicy>(idxMax, [&](idx_t idx) {
+              if (!masked(idx)) {
+                function(element_t<decltype(line)>{
+                    line.data()[idx * line.stride(0)]}...);
+              }
+            });
+          }
+        },
+        lines);
+  }
 };
 
 template <typename...>
@@ -288,10 +448,17 @@ struct ArrayForEach {
   ///         When a config is supplied containing "execution_policy" =
   ///         "sequenced_policy" (default). All loops are then executed in
   ///         sequential (row-major) order. With "execution_policy" =
-  ///         "parallel_unsequenced" the first loop is executed using OpenMP.
-  ///         The remaining loops are executed in serial. Note: The lowest
-  ///         ArrayView.rank() must be greater than or equal to the highest dim
-  ///         in ItrDims. TODO: static checking for this.
+  ///         "parallel_policy" or "parallel_unsequenced_policy" the first
+  ///         loop is executed using OpenMP, collapsed with the next loop when
+  ///         the first two ItrDims are adjacent. The parallel unsequenced
+  ///         policy only collapses if another loop remains. The remaining
+  ///         loops are executed in serial. When the last ItrDim is the last
+  ///         dimension of all views and all other dimensions are iterated,
+  ///         the function receives single elements, which are addressed
+  ///         directly; with unsequenced policies this loop is vectorised with
+  ///         "omp simd". Note: The lowest ArrayView.rank() must be greater
+  ///         than or equal to the highest dim in ItrDims. TODO: static
+  ///         checking for this.
   template <typename... ArrayView, typename Mask, typename Function>
   static void apply(const eckit::Parametrisation& conf,
                     std::tuple<ArrayView...>&& arrayViews, const Mask& mask,
@@ -0,0 +1,46 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/BlockCellColumns.h"
+
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace functionspace {
+
+// ----------------------------------------------------------------------------
+
+namespace {
+const detail::BlockColumns* extract(const FunctionSpace& functionspace) {
+    auto* impl = dynamic_cast<const detail::BlockColumns*>(functionspace.get());
+    return (impl && impl->type() == BlockCellColumns::type()) ? impl : nullptr;
+}
+}  // namespace
+
+BlockCellColumns::BlockCellColumns(): FunctionSpace(), functionspace_(nullptr) {}
+
+BlockCellColumns::BlockCellColumns(const FunctionSpace& functionspace):
+    FunctionSpace(functionspace), functionspace_(extract(*this)) {}
+
+BlockCellColumns::BlockCellColumns(const Mesh& mesh, const eckit::Configuration& config):
+    BlockCellColumns(CellColumns(mesh, config), config) {}
+
+BlockCellColumns::BlockCellColumns(const CellColumns& cellcolumns, const eckit::Configuration& config):
+    FunctionSpace(new detail::BlockColumns(cellcolumns, cellcolumns.levels(), type(), config)),
+    functionspace_(extract(*this)) {}
+
+const Mesh& BlockCellColumns::mesh() const {
+    return CellColumns(functionspace_->columns()).mesh();
+}
+
+// ----------------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
@@ -0,0 +1,67 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+#pragma once
+
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/detail/BlockColumns.h"
+
+namespace atlas {
+namespace functionspace {
+
+// -------------------------------------------------------------------
+
+/// @brief NPROMA-blocked variant of CellColumns
+///
+/// Fields have shape (nblks[,variables][,levels],nproma). Options "nproma" and "owned" as for
+/// detail::BlockColumns; other options are passed on to CellColumns.
+class BlockCellColumns : public FunctionSpace {
+public:
+    BlockCellColumns();
+    BlockCellColumns(const FunctionSpace&);
+    BlockCellColumns(const Mesh&, const eckit::Configuration& = util::NoConfig());
+    BlockCellColumns(const CellColumns&, const eckit::Configuration& = util::NoConfig());
+
+    static std::string type() { return "BlockCellColumns"; }
+
+    operator bool() const { return valid(); }
+    bool valid() const { return functionspace_; }
+
+    idx_t size() const { return functionspace_->size(); }
+    idx_t levels() const { return functionspace_->levels(); }
+    idx_t nproma() const { return functionspace_->nproma(); }
+    idx_t nblks() const { return functionspace_->nblks(); }
+    idx_t block_begin(idx_t jblk) const { return functionspace_->block_begin(jblk); }
+    idx_t block_size(idx_t jblk) const { return functionspace_->block_size(jblk); }
+    idx_t index(idx_t jblk, idx_t jrof) const { return functionspace_->index(jblk, jrof); }
+    bool owned() const { return functionspace_->owned(); }
+
+    CellColumns cellcolumns() const { return functionspace_->columns(); }
+    const Mesh& mesh() const;
+
+    void to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const {
+        functionspace_->to_blocked(nonblocked, blocked);
+    }
+    void to_blocked(const Field& nonblocked, Field& blocked) const { functionspace_->to_blocked(nonblocked, blocked); }
+    void to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const {
+        functionspace_->to_nonblocked(blocked, nonblocked);
+    }
+    void to_nonblocked(const Field& blocked, Field& nonblocked) const {
+        functionspace_->to_nonblocked(blocked, nonblocked);
+    }
+
+private:
+    const detail::BlockColumns* functionspace_;
+};
+
+// -------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
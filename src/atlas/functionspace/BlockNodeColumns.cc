@@ -0,0 +1,46 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/BlockNodeColumns.h"
+
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace functionspace {
+
+// ----------------------------------------------------------------------------
+
+namespace {
+const detail::BlockColumns* extract(const FunctionSpace& functionspace) {
+    auto* impl = dynamic_cast<const detail::BlockColumns*>(functionspace.get());
+    return (impl && impl->type() == BlockNodeColumns::type()) ? impl : nullptr;
+}
+}  // namespace
+
+BlockNodeColumns::BlockNodeColumns(): FunctionSpace(), functionspace_(nullptr) {}
+
+BlockNodeColumns::BlockNodeColumns(const FunctionSpace& functionspace):
+    FunctionSpace(functionspace), functionspace_(extract(*this)) {}
+
+BlockNodeColumns::BlockNodeColumns(const Mesh& mesh, const eckit::Configuration& config):
+    BlockNodeColumns(NodeColumns(mesh, config), config) {}
+
+BlockNodeColumns::BlockNodeColumns(const NodeColumns& nodecolumns, const eckit::Configuration& config):
+    FunctionSpace(new detail::BlockColumns(nodecolumns, nodecolumns.levels(), type(), config)),
+    functionspace_(extract(*this)) {}
+
+const Mesh& BlockNodeColumns::mesh() const {
+    return NodeColumns(functionspace_->columns()).mesh();
+}
+
+// ----------------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
@@ -57,6 +57,17 @@ public:
     idx_t nproma() const { return functionspace_->nproma(); }
     idx_t nblks() const { return functionspace_->nblks(); }
 
+    void to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const {
+        functionspace_->to_blocked(nonblocked, blocked);
+    }
+    void to_blocked(const Field& nonblocked, Field& blocked) const { functionspace_->to_blocked(nonblocked, blocked); }
+    void to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const {
+        functionspace_->to_nonblocked(blocked, nonblocked);
+    }
+    void to_nonblocked(const Field& blocked, Field& nonblocked) const {
+        functionspace_->to_nonblocked(blocked, nonblocked);
+    }
+
     Field xy() const { return functionspace_->xy(); }
     Field partition() const { return functionspace_->partition(); }
     Field global_index() const { return functionspace_->global_index(); }
@@ -17,6 +17,7 @@
 #include "atlas/array/MakeView.h"
 #include "atlas/field/detail/FieldImpl.h"
 #include "atlas/functionspace/EdgeColumns.h"
+#include "atlas/functionspace/detail/FieldSetGatherScatter.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -46,29 +47,6 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
-namespace {
-template <typename T, typename Field>
-array::LocalView<T, 3> make_leveled_view(Field& field) {
-    using namespace array;
-    if (field.levels()) {
-        if (field.variables()) {
-            return make_view<T, 3>(field).slice(Range::all(), Range::all(), Range::all());
-        }
-        else {
-            return make_view<T, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
-        }
-    }
-    else {
-        if (field.variables()) {
-            return make_view<T, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
-        }
-        else {
-            return make_view<T, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
-        }
-    }
-}
-}  // namespace
-
 class EdgeColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
                                      public mesh::detail::MeshObserver {
 private:
@@ -166,6 +144,12 @@ private:
 
     static value_type* create(const Mesh& mesh) {
         value_type* value = new value_type();
+        if (value->mode() == parallel::Checksum::Mode::reduce) {
+            value->setup(mesh.mpi_comm(), array::make_view<int, 1>(mesh.edges().partition()).data(),
+                         array::make_view<idx_t, 1>(mesh.edges().remote_index()).data(), REMOTE_IDX_BASE,
+                         array::make_view<gidx_t, 1>(mesh.edges().global_index()).data(), mesh.edges().size());
+            return value;
+        }
         util::ObjectHandle<parallel::GatherScatter> gather(
             EdgeColumnsGatherScatterCache::instance().get_or_create(mesh));
         value->setup(gather);
@@ -380,36 +364,7 @@ const parallel::HaloExchange& EdgeColumns::halo_exchange() const {
 void EdgeColumns::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
 
-    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root(0);
-        glb.metadata().get("owner", root);
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> loc_field(make_leveled_view<const int>(loc));
-            parallel::Field<int> glb_field(make_leveled_view<int>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> loc_field(make_leveled_view<const long>(loc));
-            parallel::Field<long> glb_field(make_leveled_view<long>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> loc_field(make_leveled_view<const float>(loc));
-            parallel::Field<float> glb_field(make_leveled_view<float>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> loc_field(make_leveled_view<const double>(loc));
-            parallel::Field<double> glb_field(make_leveled_view<double>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-    }
+    gather_fieldset(gather(), local_fieldset, global_fieldset);
 }
 
 void EdgeColumns::gather(const Field& local, Field& global) const {
@@ -437,37 +392,14 @@ const parallel::GatherScatter& EdgeColumns::scatter() const {
 void EdgeColumns::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
 
+    scatter_fieldset(scatter(), global_fieldset, local_fieldset);
+
     for (idx_t f = 0; f < local_fieldset.size(); ++f) {
         const Field& glb      = global_fieldset[f];
         Field& loc            = local_fieldset[f];
-        const idx_t nb_fields = 1;
         idx_t root(0);
         glb.metadata().get("owner", root);
 
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> glb_field(make_leveled_view<const int>(glb));
-            parallel::Field<int> loc_field(make_leveled_view<int>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> glb_field(make_leveled_view<const long>(glb));
-            parallel::Field<long> loc_field(make_leveled_view<long>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> glb_field(make_leveled_view<const float>(glb));
-            parallel::Field<float> loc_field(make_leveled_view<float>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> glb_field(make_leveled_view<const double>(glb));
-            parallel::Field<double> loc_field(make_leveled_view<double>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-
         glb.metadata().broadcast(loc.metadata(), root);
         loc.metadata().set("global", false);
     }
@@ -11,12 +11,14 @@
 //#include <cstdarg>
 //#include <functional>
 
+#include "eckit/config/Resource.h"
 #include "eckit/utils/MD5.h"
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/detail/FieldSetGatherScatter.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -66,6 +68,24 @@ array::LocalView<T, 3> make_leveled_view(Field& field) {
     }
 }
 
+// Mask of nodes excluded from gather and checksum (0=include,1=exclude)
+std::vector<int> gather_mask(const Mesh& mesh) {
+    mesh::IsGhostNode is_ghost(mesh.nodes());
+    std::vector<int> mask(mesh.nodes().size());
+    const idx_t npts = mask.size();
+    atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
+        mask[n] = is_ghost(n) ? 1 : 0;
+
+        // --> This would add periodic west-bc to the gather, but means that
+        // global-sums, means, etc are computed wrong
+        // if( mask[j] == 1 &&
+        // internals::Topology::check(flags(j),internals::Topology::BC) ) {
+        //  mask[j] = 0;
+        //}
+    }
+    return mask;
+}
+
 }  // namespace
 
 class NodeColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
@@ -140,19 +160,7 @@ private:
     static value_type* create(const Mesh& mesh) {
         value_type* value = new value_type();
 
-        mesh::IsGhostNode is_ghost(mesh.nodes());
-        std::vector<int> mask(mesh.nodes().size());
-        const idx_t npts = mask.size();
-        atlas_omp_parallel_for(idx_t n = 0; n < npts; ++n) {
-            mask[n] = is_ghost(n) ? 1 : 0;
-
-            // --> This would add periodic west-bc to the gather, but means that
-            // global-sums, means, etc are computed wrong
-            // if( mask[j] == 1 &&
-            // internals::Topology::check(flags(j),internals::Topology::BC) ) {
-            //  mask[j] = 0;
-            //}
-        }
+        std::vector<int> mask = gather_mask(mesh);
 
         value->setup(mesh.mpi_comm(),
                      array::make_view<int, 1>(mesh.nodes().partition()).data(),
@@ -189,6 +197,14 @@ private:
 
     static value_type* create(const Mesh& mesh) {
         value_type* value = new value_type();
+        if (value->mode() == parallel::Checksum::Mode::reduce) {
+            std::vector<int> mask = gather_mask(mesh);
+            value->setup(mesh.mpi_comm(), array::make_view<int, 1>(mesh.nodes().partition()).data(),
+                         array::make_view<idx_t, 1>(mesh.nodes().remote_index()).data(), REMOTE_IDX_BASE,
+                         array::make_view<gidx_t, 1>(mesh.nodes().global_index()).data(), mask.data(),
+                         mesh.nodes().size());
+            return value;
+        }
         util::ObjectHandle<parallel::GatherScatter> gather(
             NodeColumnsGatherScatterCache::instance().get_or_create(mesh));
         value->setup(gather);
@@ -201,6 +217,8 @@ NodeColumns::NodeColumns(Mesh mesh): NodeColumns(mesh, util::NoConfig()) {}
 NodeColumns::NodeColumns(Mesh mesh, const eckit::Configuration& config):
     mesh_(mesh), nodes_(mesh_.nodes()), nb_levels_(config.getInt("levels", 0)), nb_nodes_(0) {
     ATLAS_TRACE();
+    reproducible_sums_ = eckit::Resource<bool>("atlasReproducibleSums;$ATLAS_REPRODUCIBLE_SUMS", false);
+    config.get("reproducible_sums", reproducible_sums_);
     if (config.has("halo")) {
         halo_ = mesh::Halo(config.getInt("halo"));
     }
@@ -455,37 +473,7 @@ void NodeColumns::gather(const FieldSet& local_fieldset, FieldSet& global_fields
 
     mpi::Scope mpi_scope(mpi_comm());
 
-    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root(0);
-        glb.metadata().get("owner", root);
-
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> loc_field(make_leveled_view<const int>(loc));
-            parallel::Field<int> glb_field(make_leveled_view<int>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> loc_field(make_leveled_view<const long>(loc));
-            parallel::Field<long> glb_field(make_leveled_view<long>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> loc_field(make_leveled_view<const float>(loc));
-            parallel::Field<float> glb_field(make_leveled_view<float>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> loc_field(make_leveled_view<const double>(loc));
-            parallel::Field<double> glb_field(make_leveled_view<double>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-    }
+    gather_fieldset(gather(), local_fieldset, global_fieldset);
 }
 
 void NodeColumns::gather(const Field& local, Field& global) const {
@@ -514,37 +502,14 @@ void NodeColumns::scatter(const FieldSet& global_fieldset, FieldSet& local_field
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
 
     mpi::Scope mpi_scope(mpi_comm());
+    scatter_fieldset(scatter(), global_fieldset, local_fieldset);
+
     for (idx_t f = 0; f < local_fieldset.size(); ++f) {
         const Field& glb      = global_fieldset[f];
         Field& loc            = local_fieldset[f];
-        const idx_t nb_fields = 1;
         idx_t root(0);
         glb.metadata().get("owner", root);
 
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> glb_field(make_leveled_view<const int>(glb));
-            parallel::Field<int> loc_field(make_leveled_view<int>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> glb_field(make_leveled_view<const long>(glb));
-            parallel::Field<long> loc_field(make_leveled_view<long>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> glb_field(make_leveled_view<const float>(glb));
-            parallel::Field<float> loc_field(make_leveled_view<float>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> glb_field(make_leveled_view<const double>(glb));
-            parallel::Field<double> loc_field(make_leveled_view<double>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-
         auto name = loc.name();
         glb.metadata().broadcast(loc.metadata(), root);
         loc.metadata().set("global", false);
@@ -708,5 +673,13 @@ const parallel::Checksum& NodeColumns::checksum() const {
     return functionspace_->checksum();
 }
 
+std::vector<Statistics> NodeColumns::statistics(const FieldSet& fields, const eckit::Configuration& config) const {
+    return functionspace_->statistics(fields, config);
+}
+
+Statistics NodeColumns::statistics(const Field& field, const eckit::Configuration& config) const {
+    return functionspace_->statistics(field, config);
+}
+
 }  // namespace functionspace
 }  // namespace atlas
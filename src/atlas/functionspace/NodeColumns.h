@@ -12,6 +12,7 @@
 
 #include "atlas/functionspace/FunctionSpace.h"
 #include "atlas/functionspace/detail/FunctionSpaceImpl.h"
+#include "atlas/functionspace/detail/Statistics.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh.h"
 #include "atlas/option.h"
@@ -68,6 +69,11 @@ public:
 
     mesh::Nodes& nodes() const { return nodes_; }
 
+    /// @brief Whether sums of floating point fields (sum, mean, orderIndependentSum, ...) are computed exactly,
+    /// and hence bit-identical for any number of MPI tasks and threads.
+    /// Set with option "reproducible_sums", or by default with environment variable ATLAS_REPRODUCIBLE_SUMS
+    bool reproducible_sums() const { return reproducible_sums_; }
+
     // -- Field creation methods
 
     using FunctionSpaceImpl::createField;
@@ -256,6 +262,14 @@ public:
     /// @param [out] N         Number of values used to create the means
     void meanAndStandardDeviationPerLevel(const Field&, Field& mean, Field& stddev, idx_t& N) const;
 
+    /// @brief Compute statistics of each field in a single pass over the data, with the contributions
+    /// of all MPI tasks combined in a few collectives shared by all fields.
+    /// @param [in] config   Option "statistics" selects a subset, see functionspace::Statistics
+    std::vector<Statistics> statistics(const FieldSet&, const eckit::Configuration& = util::NoConfig()) const;
+
+    /// @brief Compute statistics of a field, see statistics(const FieldSet&, ...)
+    Statistics statistics(const Field&, const eckit::Configuration& = util::NoConfig()) const;
+
     virtual idx_t size() const override { return nb_nodes_; }
 
     idx_t part() const override { return mesh_.part(); }
@@ -299,6 +313,7 @@ private:                  // data
     idx_t nb_levels_;
     idx_t nb_nodes_;
     mutable idx_t nb_nodes_global_{-1};
+    bool reproducible_sums_;
 
     mutable util::ObjectHandle<parallel::GatherScatter> gather_scatter_;  // without ghost
     mutable util::ObjectHandle<parallel::HaloExchange> halo_exchange_;
@@ -663,6 +678,14 @@ public:
     /// @param [out] N         Number of values used to create the means
     void meanAndStandardDeviationPerLevel(const Field&, Field& mean, Field& stddev, idx_t& N) const;
 
+    /// @brief Compute statistics of each field in a single pass over the data, with the contributions
+    /// of all MPI tasks combined in a few collectives shared by all fields.
+    /// @param [in] config   Option "statistics" selects a subset, see functionspace::Statistics
+    std::vector<Statistics> statistics(const FieldSet&, const eckit::Configuration& = util::NoConfig()) const;
+
+    /// @brief Compute statistics of a field, see statistics(const FieldSet&, ...)
+    Statistics statistics(const Field&, const eckit::Configuration& = util::NoConfig()) const;
+
 private:
     const detail::NodeColumns* functionspace_;
 };
@@ -56,6 +56,15 @@ std::string StructuredColumns::checksum(const Field& field) const {
     return functionspace_->checksum(field);
 }
 
+std::vector<Statistics> StructuredColumns::statistics(const FieldSet& fields,
+                                                      const eckit::Configuration& config) const {
+    return functionspace_->statistics(fields, config);
+}
+
+Statistics StructuredColumns::statistics(const Field& field, const eckit::Configuration& config) const {
+    return functionspace_->statistics(field, config);
+}
+
 // ----------------------------------------------------------------------------
 
 }  // namespace functionspace
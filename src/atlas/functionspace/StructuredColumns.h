@@ -53,6 +53,11 @@ public:
     std::string checksum(const FieldSet&) const;
     std::string checksum(const Field&) const;
 
+    /// @brief Compute statistics of each field over owned points in a single pass over the data,
+    /// see functionspace::Statistics
+    std::vector<Statistics> statistics(const FieldSet&, const eckit::Configuration& = util::NoConfig()) const;
+    Statistics statistics(const Field&, const eckit::Configuration& = util::NoConfig()) const;
+
     idx_t index(idx_t i, idx_t j) const { return functionspace_->index(i, j); }
 
     idx_t i_begin(idx_t j) const { return functionspace_->i_begin(j); }
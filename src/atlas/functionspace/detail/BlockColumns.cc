@@ -0,0 +1,180 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/detail/BlockColumns.h"
+
+#include <vector>
+
+#include "atlas/array/DataType.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/option.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+namespace {
+
+BlockLayout make_layout(const FunctionSpace& columns, bool owned, idx_t nproma) {
+    if (not owned) {
+        return BlockLayout(columns.size(), nproma);
+    }
+    auto ghost = array::make_view<int, 1>(columns.ghost());
+    std::vector<idx_t> points;
+    points.reserve(ghost.size());
+    for (idx_t n = 0; n < ghost.size(); ++n) {
+        if (ghost(n) == 0) {
+            points.emplace_back(n);
+        }
+    }
+    return BlockLayout(std::move(points), nproma);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+
+BlockColumns::BlockColumns(const FunctionSpace& columns, idx_t levels, const std::string& type,
+                           const eckit::Configuration& config):
+    columns_(columns), type_(type), levels_(levels) {
+    ATLAS_ASSERT(columns_);
+    idx_t nproma = 1;
+    config.get("nproma", nproma);
+    ATLAS_ASSERT(nproma > 0);
+    config.get("owned", owned_);
+    layout_ = make_layout(columns_, owned_, nproma);
+}
+
+array::ArrayShape BlockColumns::config_shape(const eckit::Configuration& config) const {
+    array::ArrayShape shape;
+    shape.emplace_back(nblks());
+    idx_t variables(0);
+    config.get("variables", variables);
+    if (variables > 0) {
+        shape.emplace_back(variables);
+    }
+    idx_t levels(levels_);
+    config.get("levels", levels);
+    if (levels > 0) {
+        shape.emplace_back(levels);
+    }
+    shape.emplace_back(nproma());
+    return shape;
+}
+
+Field BlockColumns::createField(const eckit::Configuration& config) const {
+    bool global(false);
+    config.get("global", global);
+    if (global) {
+        Field field = columns_.createField(config);
+        field.set_functionspace(this);
+        return field;
+    }
+
+    array::DataType::kind_t kind;
+    if (!config.get("datatype", kind)) {
+        throw_Exception("datatype missing", Here());
+    }
+    std::string name;
+    config.get("name", name);
+
+    Field field(name, array::DataType(kind), config_shape(config));
+    field.set_functionspace(this);
+    field.metadata().set("global", false);
+
+    idx_t levels(levels_);
+    config.get("levels", levels);
+    field.set_levels(levels);
+
+    idx_t variables(0);
+    config.get("variables", variables);
+    field.set_variables(variables);
+
+    if (config.has("type")) {
+        field.metadata().set("type", config.getString("type"));
+    }
+    field.set_horizontal_dimension({0, field.rank() - 1});
+    return field;
+}
+
+Field BlockColumns::createField(const Field& other, const eckit::Configuration& config) const {
+    return createField(option::name(other.name()) | option::datatype(other.datatype()) |
+                       option::levels(other.levels()) | option::variables(other.variables()) |
+                       option::type(other.metadata().getString("type", "scalar")) | config);
+}
+
+// ----------------------------------------------------------------------------
+
+void BlockColumns::to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const {
+    layout_.to_blocked(nonblocked, blocked);
+}
+
+void BlockColumns::to_blocked(const Field& nonblocked, Field& blocked) const {
+    layout_.to_blocked(nonblocked, blocked);
+}
+
+void BlockColumns::to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const {
+    layout_.to_nonblocked(blocked, nonblocked);
+}
+
+void BlockColumns::to_nonblocked(const Field& blocked, Field& nonblocked) const {
+    layout_.to_nonblocked(blocked, nonblocked);
+}
+
+FieldSet BlockColumns::create_nonblocked(const FieldSet& fieldset) const {
+    FieldSet nonblocked;
+    for (idx_t f = 0; f < fieldset.size(); ++f) {
+        nonblocked.add(columns_.createField(fieldset[f], util::Config("global", false)));
+    }
+    return nonblocked;
+}
+
+// ----------------------------------------------------------------------------
+
+void BlockColumns::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset) const {
+    ATLAS_TRACE("BlockColumns::scatter");
+    ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    FieldSet nonblocked = create_nonblocked(global_fieldset);
+    columns_.scatter(global_fieldset, nonblocked);
+    layout_.to_blocked(nonblocked, local_fieldset);
+}
+
+void BlockColumns::scatter(const Field& global, Field& local) const {
+    FieldSet global_fields;
+    FieldSet local_fields;
+    global_fields.add(global);
+    local_fields.add(local);
+    scatter(global_fields, local_fields);
+}
+
+void BlockColumns::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset) const {
+    ATLAS_TRACE("BlockColumns::gather");
+    ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    FieldSet nonblocked = create_nonblocked(local_fieldset);
+    layout_.to_nonblocked(local_fieldset, nonblocked);
+    columns_.gather(nonblocked, global_fieldset);
+}
+
+void BlockColumns::gather(const Field& local, Field& global) const {
+    FieldSet local_fields;
+    FieldSet global_fields;
+    local_fields.add(local);
+    global_fields.add(global);
+    gather(local_fields, global_fields);
+}
+
+// ----------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
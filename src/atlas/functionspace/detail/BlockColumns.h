@@ -0,0 +1,108 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+#pragma once
+
+#include <string>
+
+#include "atlas/array/ArrayShape.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/functionspace/detail/BlockLayout.h"
+#include "atlas/functionspace/detail/FunctionSpaceImpl.h"
+#include "atlas/library/config.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+class FieldSet;
+}  // namespace atlas
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+// -------------------------------------------------------------------
+
+/// @brief NPROMA-blocked view of the points of a column function space (e.g. NodeColumns, CellColumns)
+///
+/// Fields have shape (nblks[,variables][,levels],nproma). Options:
+///   - "nproma" : number of points per block (default 1)
+///   - "owned"  : block only points that are not ghost points (default false)
+///
+/// The block layout, including the index map of blocked points, is computed once at construction and reused
+/// for all layout conversions, gather and scatter.
+class BlockColumns : public FunctionSpaceImpl {
+public:
+    BlockColumns(const FunctionSpace& columns, idx_t levels, const std::string& type,
+                 const eckit::Configuration& = util::NoConfig());
+
+    std::string type() const override { return type_; }
+    std::string distribution() const override { return columns_.distribution(); }
+
+    Field createField(const eckit::Configuration&) const override;
+    Field createField(const Field&, const eckit::Configuration&) const override;
+
+    using FunctionSpaceImpl::scatter;
+    void scatter(const FieldSet&, FieldSet&) const override;
+    void scatter(const Field&, Field&) const override;
+    using FunctionSpaceImpl::gather;
+    void gather(const FieldSet&, FieldSet&) const override;
+    void gather(const Field&, Field&) const override;
+
+    /// @brief Copy non-blocked fields of the column function space to blocked fields
+    void to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const;
+    void to_blocked(const Field& nonblocked, Field& blocked) const;
+
+    /// @brief Copy blocked fields to non-blocked fields of the column function space
+    void to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const;
+    void to_nonblocked(const Field& blocked, Field& nonblocked) const;
+
+    idx_t size() const override { return layout_.size(); }
+    idx_t levels() const { return levels_; }
+    idx_t nproma() const { return layout_.nproma(); }
+    idx_t nblks() const { return layout_.nblks(); }
+    idx_t block_begin(idx_t jblk) const { return layout_.block_begin(jblk); }
+    idx_t block_size(idx_t jblk) const { return layout_.block_size(jblk); }
+
+    /// @brief Index in the column function space of point jrof in block jblk
+    idx_t index(idx_t jblk, idx_t jrof) const { return layout_.point(jblk, jrof); }
+
+    /// @brief Whether only owned points are blocked
+    bool owned() const { return owned_; }
+
+    const BlockLayout& layout() const { return layout_; }
+    const FunctionSpace& columns() const { return columns_; }
+
+    Field lonlat() const override { return columns_.lonlat(); }
+    Field ghost() const override { return columns_.ghost(); }
+    Field remote_index() const override { return columns_.remote_index(); }
+    Field partition() const override { return columns_.partition(); }
+    Field global_index() const override { return columns_.global_index(); }
+    idx_t part() const override { return columns_.part(); }
+    idx_t nb_parts() const override { return columns_.nb_parts(); }
+    std::string mpi_comm() const override { return columns_.mpi_comm(); }
+    size_t footprint() const override { return sizeof(*this) + layout_.footprint() + columns_.footprint(); }
+
+private:
+    array::ArrayShape config_shape(const eckit::Configuration&) const;
+    FieldSet create_nonblocked(const FieldSet&) const;
+
+private:
+    FunctionSpace columns_;
+    std::string type_;
+    idx_t levels_;
+    bool owned_{false};
+    BlockLayout layout_;
+};
+
+// -------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -0,0 +1,191 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/detail/BlockLayout.h"
+
+#include "atlas/array/Array.h"
+#include "atlas/array/DataType.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+namespace {
+
+// Data and strides of a non-blocked field and its blocked counterpart
+struct FieldPair {
+    array::DataType::kind_t kind;
+    void* nonblocked;
+    void* blocked;
+    idx_t nlev;
+    idx_t nvar;
+    idx_t nonblocked_point_stride;
+    idx_t nonblocked_lev_stride;
+    idx_t nonblocked_var_stride;
+    idx_t blocked_blk_stride;
+    idx_t blocked_var_stride;
+    idx_t blocked_lev_stride;
+    idx_t blocked_rof_stride;
+};
+
+FieldPair make_field_pair(const Field& nonblocked, const Field& blocked, const BlockLayout& layout) {
+    const idx_t rank = nonblocked.rank();
+    ATLAS_ASSERT(rank >= 1 && rank <= 3, "Non-blocked field must have rank 1, 2 or 3");
+    ATLAS_ASSERT(blocked.rank() == rank + 1, "Blocked field must have one dimension more than non-blocked field");
+    ATLAS_ASSERT(blocked.datatype() == nonblocked.datatype());
+    ATLAS_ASSERT(blocked.shape(0) == layout.nblks());
+    ATLAS_ASSERT(blocked.shape(rank) == layout.nproma());
+
+    // A rank-2 field has either levels or variables, as indicated by the field metadata
+    const bool has_variables = rank == 3 || (rank == 2 && nonblocked.variables() > 0);
+    const bool has_levels    = rank == 3 || (rank == 2 && not has_variables);
+
+    FieldPair pair;
+    pair.kind                    = nonblocked.datatype().kind();
+    pair.nonblocked              = const_cast<void*>(nonblocked.array().data());
+    pair.blocked                 = const_cast<void*>(blocked.array().data());
+    pair.nlev                    = has_levels ? nonblocked.shape(1) : 1;
+    pair.nvar                    = has_variables ? nonblocked.shape(rank - 1) : 1;
+    pair.nonblocked_point_stride = nonblocked.stride(0);
+    pair.nonblocked_lev_stride   = has_levels ? nonblocked.stride(1) : 0;
+    pair.nonblocked_var_stride   = has_variables ? nonblocked.stride(rank - 1) : 0;
+    pair.blocked_blk_stride      = blocked.stride(0);
+    pair.blocked_var_stride      = has_variables ? blocked.stride(1) : 0;
+    pair.blocked_lev_stride      = has_levels ? blocked.stride(has_variables ? 2 : 1) : 0;
+    pair.blocked_rof_stride      = blocked.stride(rank);
+    if (has_variables) {
+        ATLAS_ASSERT(blocked.shape(1) == pair.nvar);
+    }
+    if (has_levels) {
+        ATLAS_ASSERT(blocked.shape(has_variables ? 2 : 1) == pair.nlev);
+    }
+    return pair;
+}
+
+template <typename Value, bool ToBlocked>
+void transpose_block(const BlockLayout& layout, const FieldPair& pair, idx_t jblk) {
+    Value* nonblocked    = static_cast<Value*>(pair.nonblocked);
+    Value* blocked       = static_cast<Value*>(pair.blocked) + jblk * pair.blocked_blk_stride;
+    const idx_t blk_size = layout.block_size(jblk);
+    const idx_t rof      = pair.blocked_rof_stride;
+    for (idx_t jvar = 0; jvar < pair.nvar; ++jvar) {
+        for (idx_t jlev = 0; jlev < pair.nlev; ++jlev) {
+            Value* b           = blocked + jvar * pair.blocked_var_stride + jlev * pair.blocked_lev_stride;
+            const idx_t offset = jvar * pair.nonblocked_var_stride + jlev * pair.nonblocked_lev_stride;
+            if (ToBlocked) {
+                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
+                    b[jrof * rof] = nonblocked[layout.point(jblk, jrof) * pair.nonblocked_point_stride + offset];
+                }
+                for (idx_t jrof = blk_size; jrof < layout.nproma() && blk_size > 0; ++jrof) {
+                    b[jrof * rof] = b[(blk_size - 1) * rof];
+                }
+            }
+            else {
+                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
+                    nonblocked[layout.point(jblk, jrof) * pair.nonblocked_point_stride + offset] = b[jrof * rof];
+                }
+            }
+        }
+    }
+}
+
+template <bool ToBlocked>
+void transpose_block(const BlockLayout& layout, const FieldPair& pair, idx_t jblk) {
+    if (pair.kind == array::DataType::kind<int>()) {
+        transpose_block<int, ToBlocked>(layout, pair, jblk);
+    }
+    else if (pair.kind == array::DataType::kind<long>()) {
+        transpose_block<long, ToBlocked>(layout, pair, jblk);
+    }
+    else if (pair.kind == array::DataType::kind<float>()) {
+        transpose_block<float, ToBlocked>(layout, pair, jblk);
+    }
+    else if (pair.kind == array::DataType::kind<double>()) {
+        transpose_block<double, ToBlocked>(layout, pair, jblk);
+    }
+}
+
+template <bool ToBlocked>
+void transpose(const BlockLayout& layout, const std::vector<FieldPair>& pairs) {
+    for (const auto& pair : pairs) {
+        if (pair.kind != array::DataType::kind<int>() && pair.kind != array::DataType::kind<long>() &&
+            pair.kind != array::DataType::kind<float>() && pair.kind != array::DataType::kind<double>()) {
+            throw_Exception("datatype not supported", Here());
+        }
+    }
+    atlas_omp_parallel {
+        for (const auto& pair : pairs) {
+            atlas_omp_for(idx_t jblk = 0; jblk < layout.nblks(); ++jblk) {
+                transpose_block<ToBlocked>(layout, pair, jblk);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------
+
+BlockLayout::BlockLayout(idx_t size, idx_t nproma) {
+    setup(size, nproma);
+}
+
+BlockLayout::BlockLayout(std::vector<idx_t>&& points, idx_t nproma): points_(std::move(points)) {
+    setup(static_cast<idx_t>(points_.size()), nproma);
+}
+
+void BlockLayout::setup(idx_t size, idx_t nproma) {
+    ATLAS_ASSERT(nproma > 0);
+    nproma_      = nproma;
+    size_        = size;
+    nblks_       = (size + nproma - 1) / nproma;
+    endblk_size_ = size > 0 ? size - (nblks_ - 1) * nproma : nproma;
+}
+
+void BlockLayout::to_blocked(const Field& nonblocked, Field& blocked) const {
+    transpose<true>(*this, {make_field_pair(nonblocked, blocked, *this)});
+}
+
+void BlockLayout::to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const {
+    ATLAS_TRACE("BlockLayout::to_blocked");
+    ATLAS_ASSERT(nonblocked.size() == blocked.size());
+    std::vector<FieldPair> pairs;
+    pairs.reserve(nonblocked.size());
+    for (idx_t f = 0; f < nonblocked.size(); ++f) {
+        pairs.emplace_back(make_field_pair(nonblocked[f], blocked[f], *this));
+    }
+    transpose<true>(*this, pairs);
+}
+
+void BlockLayout::to_nonblocked(const Field& blocked, Field& nonblocked) const {
+    transpose<false>(*this, {make_field_pair(nonblocked, blocked, *this)});
+}
+
+void BlockLayout::to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const {
+    ATLAS_TRACE("BlockLayout::to_nonblocked");
+    ATLAS_ASSERT(nonblocked.size() == blocked.size());
+    std::vector<FieldPair> pairs;
+    pairs.reserve(nonblocked.size());
+    for (idx_t f = 0; f < nonblocked.size(); ++f) {
+        pairs.emplace_back(make_field_pair(nonblocked[f], blocked[f], *this));
+    }
+    transpose<false>(*this, pairs);
+}
+
+// -------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
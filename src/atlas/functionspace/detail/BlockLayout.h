@@ -0,0 +1,85 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+#pragma once
+
+#include <vector>
+
+#include "atlas/library/config.h"
+
+namespace atlas {
+class Field;
+class FieldSet;
+}  // namespace atlas
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+// -------------------------------------------------------------------
+
+/// @brief Distribution of the points of a function space over blocks of nproma points
+///
+/// Blocked fields have shape (nblks[,variables][,levels],nproma), non-blocked fields have shape
+/// (size[,levels][,variables]). The blocked points are either all points of the non-blocked function space,
+/// or a selection given by their indices (e.g. only owned points), which is then stored as index map.
+/// The last block may be partially filled; its remaining entries are filled with the last point of the block
+/// when converting to blocked fields, so that blocked computations do not operate on uninitialised values.
+///
+/// Conversions are OpenMP-parallel over blocks. Conversions of a FieldSet use a single parallel region
+/// for all fields.
+class BlockLayout {
+public:
+    BlockLayout() = default;
+
+    /// @brief Blocks of all points [0,size)
+    BlockLayout(idx_t size, idx_t nproma);
+
+    /// @brief Blocks of selected points, given by their index in non-blocked fields
+    BlockLayout(std::vector<idx_t>&& points, idx_t nproma);
+
+    idx_t nproma() const { return nproma_; }
+    idx_t nblks() const { return nblks_; }
+
+    /// @brief Number of blocked points
+    idx_t size() const { return size_; }
+
+    idx_t block_begin(idx_t jblk) const { return jblk * nproma_; }
+    idx_t block_size(idx_t jblk) const { return (jblk != nblks_ - 1 ? nproma_ : endblk_size_); }
+
+    /// @brief Index in non-blocked fields of point jrof in block jblk
+    idx_t point(idx_t jblk, idx_t jrof) const {
+        const idx_t n = block_begin(jblk) + jrof;
+        return points_.empty() ? n : points_[n];
+    }
+
+    void to_blocked(const Field& nonblocked, Field& blocked) const;
+    void to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const;
+
+    /// @brief Copy blocked points to non-blocked fields. Points that are not blocked are left untouched.
+    void to_nonblocked(const Field& blocked, Field& nonblocked) const;
+    void to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const;
+
+    size_t footprint() const { return sizeof(*this) + points_.capacity() * sizeof(idx_t); }
+
+private:
+    void setup(idx_t size, idx_t nproma);
+
+    idx_t nproma_{1};
+    idx_t nblks_{0};
+    idx_t endblk_size_{1};
+    idx_t size_{0};
+    std::vector<idx_t> points_;  // empty if all points are blocked
+};
+
+// -------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -42,161 +42,6 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
-namespace {
-
-template <class ValueType>
-void block_copy(const Field sloc, Field loc, const functionspace::detail::BlockStructuredColumns& fs) {
-    if (sloc.variables() and sloc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 4>(loc);
-        auto sloc_v = array::make_view<ValueType, 3>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jvar = 0; jvar < sloc.shape(2); ++jvar) {
-                for (idx_t jlev = 0; jlev < sloc.shape(1); ++jlev) {
-                    for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                        loc_v(jblk, jvar, jlev, jrof) = sloc_v(blk_begin+jrof, jlev, jvar);
-                    }
-                }
-            }
-        }
-    }
-    else if (not sloc.variables() and sloc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 3>(loc);
-        auto sloc_v = array::make_view<ValueType, 2>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jlev = 0; jlev < sloc.shape(1); ++jlev) {
-                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                    loc_v(jblk, jlev, jrof) = sloc_v(blk_begin+jrof, jlev);
-                }
-            }
-        }
-    }
-    else if (sloc.variables() and not sloc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 3>(loc);
-        auto sloc_v = array::make_view<ValueType, 2>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jvar = 0; jvar < sloc.shape(1); ++jvar) {
-                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                    loc_v(jblk, jvar, jrof) = sloc_v(blk_begin+jrof, jvar);
-                }
-            }
-        }
-    }
-    else {
-        auto loc_v  = array::make_view<ValueType, 2>(loc);
-        auto sloc_v = array::make_view<ValueType, 1>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                loc_v(jblk, jrof) = sloc_v(blk_begin+jrof);
-            }
-        }
-    }
-}
-
-template <class ValueType>
-void rev_block_copy(const Field loc, Field sloc, const functionspace::detail::BlockStructuredColumns& fs) {
-    if (loc.variables() and loc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 4>(loc);
-        auto sloc_v = array::make_view<ValueType, 3>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jvar = 0; jvar < sloc.shape(2); ++jvar) {
-                for (idx_t jlev = 0; jlev < sloc.shape(1); ++jlev) {
-                    for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                        sloc_v(blk_begin+jrof, jlev, jvar) = loc_v(jblk, jvar, jlev, jrof);
-                    }
-                }
-            }
-        }
-    }
-    else if (not loc.variables() and loc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 3>(loc);
-        auto sloc_v = array::make_view<ValueType, 2>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jlev = 0; jlev < sloc.shape(1); ++jlev) {
-                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                    sloc_v(blk_begin+jrof, jlev) = loc_v(jblk, jlev, jrof);
-                }
-            }
-        }
-    }
-    else if (loc.variables() and not loc.levels()) {
-        auto loc_v  = array::make_view<ValueType, 3>(loc);
-        auto sloc_v = array::make_view<ValueType, 2>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jvar = 0; jvar < sloc.shape(1); ++jvar) {
-                for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                    sloc_v(blk_begin+jrof, jvar) = loc_v(jblk, jvar, jrof);
-                }
-            }
-        }
-    }
-    else {
-        auto loc_v  = array::make_view<ValueType, 2>(loc);
-        auto sloc_v = array::make_view<ValueType, 1>(sloc);
-        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
-            const idx_t blk_size = fs.block_size(jblk);
-            const idx_t blk_begin = fs.block_begin(jblk);
-            for (idx_t jrof = 0; jrof < blk_size; ++jrof) {
-                sloc_v(blk_begin+jrof) = loc_v(jblk, jrof);
-            }
-        }
-    }
-}
-
-void transpose_nonblocked_to_blocked(const Field& nonblocked, Field& blocked, const functionspace::detail::BlockStructuredColumns& fs) {
-    auto kind = nonblocked.datatype().kind();
-    if (kind == array::DataType::kind<int>()) {
-        block_copy<int>(nonblocked, blocked, fs);
-    }
-    else if (kind == array::DataType::kind<long>()) {
-        block_copy<long>(nonblocked, blocked, fs);
-    }
-    else if (kind == array::DataType::kind<float>()) {
-        block_copy<float>(nonblocked, blocked, fs);
-    }
-    else if (kind == array::DataType::kind<double>()) {
-        block_copy<double>(nonblocked, blocked, fs);
-    }
-    else {
-        throw_Exception("datatype not supported", Here());
-    }
-}
-
-void transpose_blocked_to_nonblocked(const Field& blocked, Field& nonblocked, const functionspace::detail::BlockStructuredColumns& fs) {
-    auto kind = blocked.datatype().kind();
-    if (kind == array::DataType::kind<int>()) {
-        rev_block_copy<int>(blocked, nonblocked, fs);
-    }
-    else if (kind == array::DataType::kind<long>()) {
-        rev_block_copy<long>(blocked, nonblocked, fs);
-    }
-    else if (kind == array::DataType::kind<float>()) {
-        rev_block_copy<float>(blocked, nonblocked, fs);
-    }
-    else if (kind == array::DataType::kind<double>()) {
-        rev_block_copy<double>(blocked, nonblocked, fs);
-    }
-    else {
-        throw_Exception("datatype not supported", Here());
-    }
-}
-
-
-}// namespace
-
 array::ArrayShape BlockStructuredColumns::config_shape(const eckit::Configuration& config) const {
     array::ArrayShape shape;
 
@@ -206,7 +51,7 @@ array::ArrayShape BlockStructuredColumns::config_shape(const eckit::Configuratio
         return structuredcolumns_->config_shape(config);
     }
     else {
-        shape.emplace_back(nblks_);
+        shape.emplace_back(nblks());
         idx_t variables(0);
         config.get("variables", variables);
         if (variables > 0) {
@@ -217,7 +62,7 @@ array::ArrayShape BlockStructuredColumns::config_shape(const eckit::Configuratio
         if (levels > 0) {
             shape.emplace_back(levels);
         }
-        shape.emplace_back(nproma_);
+        shape.emplace_back(nproma());
     }
     return shape;
 }
@@ -285,14 +130,15 @@ Field BlockStructuredColumns::createField(const Field& other, const eckit::Confi
 // ----------------------------------------------------------------------------
 void BlockStructuredColumns::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    FieldSet nonblocked;
+    for (idx_t f = 0; f < global_fieldset.size(); ++f) {
+        nonblocked.add(structuredcolumns_->createField(global_fieldset[f], util::Config("global", false)));
+    }
+    structuredcolumns_->scatter(global_fieldset, nonblocked);
     for (idx_t f = 0; f < local_fieldset.size(); ++f) {
-        const Field& glb  = global_fieldset[f];
-        Field& loc        = local_fieldset[f];
-        auto sloc         = structuredcolumns_->createField(glb, util::Config("global",false));
-        structuredcolumns_->scatter(glb, sloc);
-        loc.metadata() = sloc.metadata();
-        transpose_nonblocked_to_blocked(sloc, loc, *this);
+        local_fieldset[f].metadata() = nonblocked[f].metadata();
     }
+    layout_.to_blocked(nonblocked, local_fieldset);
 }
 
 // ----------------------------------------------------------------------------
@@ -311,32 +157,43 @@ void BlockStructuredColumns::scatter(const Field& global, Field& local) const {
 // ----------------------------------------------------------------------------
 void BlockStructuredColumns::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    FieldSet nonblocked;
     for (idx_t f = 0; f < local_fieldset.size(); ++f) {
-        const Field& loc = local_fieldset[f];
-        Field& glb       = global_fieldset[f];
-        auto sloc = structuredcolumns_->createField(loc, util::Config("global",false));
-        transpose_blocked_to_nonblocked(loc, sloc, *this);
-        structuredcolumns_->gather(sloc, glb);
-        glb.metadata() = loc.metadata();
+        nonblocked.add(structuredcolumns_->createField(local_fieldset[f], util::Config("global", false)));
+    }
+    layout_.to_nonblocked(local_fieldset, nonblocked);
+    structuredcolumns_->gather(nonblocked, global_fieldset);
+    for (idx_t f = 0; f < global_fieldset.size(); ++f) {
+        Field& glb     = global_fieldset[f];
+        glb.metadata() = local_fieldset[f].metadata();
         glb.metadata().set("global", false);
     }
 }
 // ----------------------------------------------------------------------------
 
-void BlockStructuredColumns::setup(const eckit::Configuration &config) {
-    nproma_ = 1;
-    idx_t tmp_nproma;
-    if (config.get("nproma", tmp_nproma)) {
-        ATLAS_ASSERT(tmp_nproma > 0);
-        nproma_ = tmp_nproma;
-    }
+void BlockStructuredColumns::to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const {
+    layout_.to_blocked(nonblocked, blocked);
+}
 
-    nblks_ = std::floor( structuredcolumns_->size() / nproma_ );
-    endblk_size_ = nproma_;
-    if (structuredcolumns_->size() % nproma_ > 0) {
-        endblk_size_ = structuredcolumns_->size() - nblks_ * nproma_;
-        nblks_++;
-    }
+void BlockStructuredColumns::to_blocked(const Field& nonblocked, Field& blocked) const {
+    layout_.to_blocked(nonblocked, blocked);
+}
+
+void BlockStructuredColumns::to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const {
+    layout_.to_nonblocked(blocked, nonblocked);
+}
+
+void BlockStructuredColumns::to_nonblocked(const Field& blocked, Field& nonblocked) const {
+    layout_.to_nonblocked(blocked, nonblocked);
+}
+
+// ----------------------------------------------------------------------------
+
+void BlockStructuredColumns::setup(const eckit::Configuration &config) {
+    idx_t nproma = 1;
+    config.get("nproma", nproma);
+    ATLAS_ASSERT(nproma > 0);
+    layout_ = BlockLayout(structuredcolumns_->size(), nproma);
 }
 
 // ----------------------------------------------------------------------------
@@ -16,6 +16,7 @@
 
 #include "atlas/array/DataType.h"
 #include "atlas/field/Field.h"
+#include "atlas/functionspace/detail/BlockLayout.h"
 #include "atlas/functionspace/detail/FunctionSpaceImpl.h"
 #include "atlas/functionspace/detail/StructuredColumns.h"
 #include "atlas/functionspace/StructuredColumns.h"
@@ -42,7 +43,7 @@ class GatherScatter;
 
 namespace atlas {
 class Field;
-//class FieldSet;
+class FieldSet;
 class Grid;
 class StructuredGrid;
 }  // namespace atlas
@@ -92,10 +93,18 @@ public:
 
     idx_t size() const override { return structuredcolumns_->size(); }
     idx_t index(idx_t jblk, idx_t jrof) const {
-        return jblk * nproma_ + jrof; // local index;
+        return layout_.point(jblk, jrof); // local index;
     }
-    idx_t nproma() const { return nproma_; }
-    idx_t nblks() const { return nblks_; }
+    idx_t nproma() const { return layout_.nproma(); }
+    idx_t nblks() const { return layout_.nblks(); }
+
+    /// @brief Copy non-blocked fields of structuredcolumns() to blocked fields
+    void to_blocked(const FieldSet& nonblocked, FieldSet& blocked) const;
+    void to_blocked(const Field& nonblocked, Field& blocked) const;
+
+    /// @brief Copy blocked fields to non-blocked fields of structuredcolumns()
+    void to_nonblocked(const FieldSet& blocked, FieldSet& nonblocked) const;
+    void to_nonblocked(const Field& blocked, Field& nonblocked) const;
 
     const Vertical& vertical() const { return structuredcolumns_->vertical(); }
     const StructuredGrid& grid() const { return structuredcolumns_->grid(); }
@@ -114,8 +123,8 @@ public:
     idx_t part() const override { return structuredcolumns_->part(); }
     idx_t nb_parts() const override { return structuredcolumns_->nb_parts(); }
     const StructuredColumns& structuredcolumns() const { return *structuredcolumns_; }
-    idx_t block_begin(idx_t jblk) const { return jblk * nproma_; }
-    idx_t block_size(idx_t jblk) const { return (jblk != nblks_-1 ? nproma_ : endblk_size_); }
+    idx_t block_begin(idx_t jblk) const { return layout_.block_begin(jblk); }
+    idx_t block_size(idx_t jblk) const { return layout_.block_size(jblk); }
     idx_t k_begin() const { return vertical().k_begin(); }
     idx_t k_end() const { return vertical().k_end(); }
 
@@ -128,9 +137,7 @@ private:  // methods
     array::ArraySpec config_spec(const eckit::Configuration&) const;
 
 private:  // data
-    idx_t nproma_;
-    idx_t endblk_size_;
-    idx_t nblks_;
+    BlockLayout layout_;
 
     detail::StructuredColumns* structuredcolumns_;
     functionspace::StructuredColumns structuredcolumns_handle_;
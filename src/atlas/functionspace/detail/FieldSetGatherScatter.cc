@@ -0,0 +1,173 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/detail/FieldSetGatherScatter.h"
+
+#include <vector>
+
+#include "eckit/config/Resource.h"
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/DataType.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/GatherScatter.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+namespace {
+
+template <typename T, typename Field>
+array::LocalView<T, 3> make_leveled_view(Field& field) {
+    using namespace array;
+    if (field.levels()) {
+        if (field.variables()) {
+            return make_view<T, 3>(field).slice(Range::all(), Range::all(), Range::all());
+        }
+        else {
+            return make_view<T, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+        }
+    }
+    else {
+        if (field.variables()) {
+            return make_view<T, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+        }
+        else {
+            return make_view<T, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
+        }
+    }
+}
+
+bool is_supported(const array::DataType& datatype) {
+    return datatype == array::DataType::kind<int>() || datatype == array::DataType::kind<long>() ||
+           datatype == array::DataType::kind<float>() || datatype == array::DataType::kind<double>();
+}
+
+idx_t owner(const Field& global) {
+    idx_t root(0);
+    global.metadata().get("owner", root);
+    return root;
+}
+
+// Upper bound for the size in bytes of the global data of fields exchanged in one communication, which limits the
+// memory of the communication buffers
+size_t batch_bytes() {
+    static size_t bytes = size_t(eckit::Resource<long>("$ATLAS_GATHER_SCATTER_BATCH_BYTES", 256l * 1024 * 1024));
+    return bytes;
+}
+
+// Call exchange(begin, end) for consecutive ranges of fields whose global data is at most batch_bytes(),
+// unless a single field is larger. Ranges only depend on field shapes, so they are the same on every partition.
+template <typename T, typename Exchange>
+void for_each_batch(const parallel::GatherScatter& gs, const std::vector<parallel::Field<T>>& local_fields,
+                    const Exchange& exchange) {
+    const size_t nb_fields = local_fields.size();
+    size_t begin           = 0;
+    size_t bytes           = 0;
+    for (size_t f = 0; f < nb_fields; ++f) {
+        size_t field_bytes = size_t(gs.glb_dof()) * sizeof(T);
+        for (idx_t j = 0; j < local_fields[f].var_rank; ++j) {
+            field_bytes *= size_t(local_fields[f].var_shape[j]);
+        }
+        if (f > begin && bytes + field_bytes > batch_bytes()) {
+            exchange(begin, f);
+            begin = f;
+            bytes = 0;
+        }
+        bytes += field_bytes;
+    }
+    if (begin < nb_fields) {
+        exchange(begin, nb_fields);
+    }
+}
+
+template <typename T>
+void gather_fields(const parallel::GatherScatter& gather, const FieldSet& local_fieldset, FieldSet& global_fieldset) {
+    std::vector<parallel::Field<T const>> loc_fields;
+    std::vector<parallel::Field<T>> glb_fields;
+    std::vector<idx_t> roots;
+    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
+        const Field& loc = local_fieldset[f];
+        Field& glb       = global_fieldset[f];
+        if (loc.datatype() == array::DataType::kind<T>()) {
+            loc_fields.emplace_back(make_leveled_view<const T>(loc));
+            glb_fields.emplace_back(make_leveled_view<T>(glb));
+            roots.emplace_back(owner(glb));
+        }
+    }
+    for_each_batch(gather, loc_fields, [&](size_t begin, size_t end) {
+        gather.gather(loc_fields.data() + begin, glb_fields.data() + begin, static_cast<idx_t>(end - begin),
+                      roots.data() + begin);
+    });
+}
+
+template <typename T>
+void scatter_fields(const parallel::GatherScatter& scatter, const FieldSet& global_fieldset, FieldSet& local_fieldset) {
+    std::vector<parallel::Field<T const>> glb_fields;
+    std::vector<parallel::Field<T>> loc_fields;
+    std::vector<idx_t> roots;
+    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
+        const Field& glb = global_fieldset[f];
+        Field& loc       = local_fieldset[f];
+        if (loc.datatype() == array::DataType::kind<T>()) {
+            glb_fields.emplace_back(make_leveled_view<const T>(glb));
+            loc_fields.emplace_back(make_leveled_view<T>(loc));
+            roots.emplace_back(owner(glb));
+        }
+    }
+    for_each_batch(scatter, loc_fields, [&](size_t begin, size_t end) {
+        scatter.scatter(glb_fields.data() + begin, loc_fields.data() + begin, static_cast<idx_t>(end - begin),
+                        roots.data() + begin);
+    });
+}
+
+}  // namespace
+
+// -------------------------------------------------------------------
+
+void gather_fieldset(const parallel::GatherScatter& gather, const FieldSet& local_fieldset, FieldSet& global_fieldset) {
+    ATLAS_TRACE("gather_fieldset");
+    ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
+        if (not is_supported(local_fieldset[f].datatype())) {
+            throw_Exception("datatype not supported", Here());
+        }
+    }
+    gather_fields<int>(gather, local_fieldset, global_fieldset);
+    gather_fields<long>(gather, local_fieldset, global_fieldset);
+    gather_fields<float>(gather, local_fieldset, global_fieldset);
+    gather_fields<double>(gather, local_fieldset, global_fieldset);
+}
+
+void scatter_fieldset(const parallel::GatherScatter& scatter, const FieldSet& global_fieldset,
+                      FieldSet& local_fieldset) {
+    ATLAS_TRACE("scatter_fieldset");
+    ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
+    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
+        if (not is_supported(local_fieldset[f].datatype())) {
+            throw_Exception("datatype not supported", Here());
+        }
+    }
+    scatter_fields<int>(scatter, global_fieldset, local_fieldset);
+    scatter_fields<long>(scatter, global_fieldset, local_fieldset);
+    scatter_fields<float>(scatter, global_fieldset, local_fieldset);
+    scatter_fields<double>(scatter, global_fieldset, local_fieldset);
+}
+
+// -------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -0,0 +1,41 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+#pragma once
+
+namespace atlas {
+class FieldSet;
+namespace parallel {
+class GatherScatter;
+}
+}  // namespace atlas
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+// -------------------------------------------------------------------
+
+/// @brief Gather each field of local_fieldset to the corresponding field of global_fieldset on its owner partition
+///
+/// The owner partition of each field is given by the "owner" metadata of the global field (default 0).
+/// Fields of the same datatype are gathered in a single communication, so that fields owned by different
+/// partitions (e.g. I/O servers) are received concurrently.
+void gather_fieldset(const parallel::GatherScatter&, const FieldSet& local_fieldset, FieldSet& global_fieldset);
+
+/// @brief Scatter each field of global_fieldset from its owner partition to the corresponding field of local_fieldset
+///
+/// Counterpart of gather_fieldset. Field metadata is not communicated.
+void scatter_fieldset(const parallel::GatherScatter&, const FieldSet& global_fieldset, FieldSet& local_fieldset);
+
+// -------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
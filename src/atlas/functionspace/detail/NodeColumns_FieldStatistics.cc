@@ -13,9 +13,11 @@
 #include <cstdarg>
 #include <functional>
 #include <limits>
+#include <type_traits>
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/NodeColumns.h"
 #include "atlas/library/config.h"
 #include "atlas/mesh/IsGhostNode.h"
@@ -24,6 +26,7 @@
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/ReproducibleSum.h"
 
 
 #undef atlas_omp_critical_ordered
@@ -95,12 +98,57 @@ namespace {
 inline double sqr(const double& val) {
     return val * val;
 }
+
+template <typename T>
+bool use_reproducible_sums(const NodeColumns& fs) {
+    return std::is_floating_point<T>::value && fs.reproducible_sums();
+}
+
+// Exact sums of owned values for each variable, or for each level and variable when per_level is true.
+// Threads and MPI tasks are combined exactly, so the result does not depend on the decomposition.
+template <typename T>
+std::vector<util::ReproducibleSum> reproducible_sums(const NodeColumns& fs, const array::LocalView<const T, 3>& arr,
+                                                     bool per_level) {
+    const mesh::IsGhostNode is_ghost(fs.nodes());
+    const idx_t npts = std::min(arr.shape(0), fs.nb_nodes());
+    const idx_t nlev = arr.shape(1);
+    const idx_t nvar = arr.shape(2);
+    const idx_t nsum = per_level ? nlev * nvar : nvar;
+    std::vector<util::ReproducibleSum> sums(nsum);
+    atlas_omp_parallel {
+        std::vector<util::ReproducibleSum> sums_private(nsum);
+        atlas_omp_for(idx_t n = 0; n < npts; ++n) {
+            if (!is_ghost(n)) {
+                for (idx_t l = 0; l < nlev; ++l) {
+                    auto* sums_level = sums_private.data() + (per_level ? l * nvar : 0);
+                    for (idx_t j = 0; j < nvar; ++j) {
+                        sums_level[j] += static_cast<double>(arr(n, l, j));
+                    }
+                }
+            }
+        }
+        atlas_omp_critical {
+            for (idx_t j = 0; j < nsum; ++j) {
+                sums[j] += sums_private[j];
+            }
+        }
+    }
+    util::ReproducibleSum::allReduce(sums, mpi::comm(fs.mpi_comm()));
+    return sums;
+}
 }  // namespace
 
 namespace detail {  // Collectives implementation
 
 template <typename T>
 void dispatch_sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
+    if (use_reproducible_sums<T>(fs)) {
+        const auto arr = make_leveled_view<const T>(field);
+        ATLAS_ASSERT(arr.shape(2) == 1, "sum of a field with variables requires a vector result");
+        result = static_cast<T>(reproducible_sums(fs, arr, false)[0].value());
+        N              = fs.nb_nodes_global() * arr.shape(1);
+        return;
+    }
     const mesh::IsGhostNode is_ghost(fs.nodes());
     const array::LocalView<const T, 2> arr = make_leveled_scalar_view<const T>(field);
     T local_sum                            = 0;
@@ -159,6 +207,15 @@ void sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
 template <typename T>
 void dispatch_sum(const NodeColumns& fs, const Field& field, std::vector<T>& result, idx_t& N) {
     auto arr = make_leveled_view<const T>(field);
+    if (use_reproducible_sums<T>(fs)) {
+        auto sums = reproducible_sums(fs, arr, false);
+        result.resize(sums.size());
+        for (size_t j = 0; j < sums.size(); ++j) {
+            result[j] = static_cast<T>(sums[j].value());
+        }
+        N = fs.nb_nodes_global() * arr.shape(1);
+        return;
+    }
     const mesh::IsGhostNode is_ghost(fs.nodes());
     const idx_t npts = std::min(arr.shape(0), fs.nb_nodes());
     const idx_t nlev = arr.shape(1);
@@ -245,6 +302,17 @@ void dispatch_sum_per_level(const NodeColumns& fs, const Field& field, Field& su
 
     auto sum_per_level = make_per_level_view<T>(sum);
 
+    if (use_reproducible_sums<T>(fs)) {
+        auto sums = reproducible_sums(fs, arr, true);
+        for (idx_t l = 0; l < nlev; ++l) {
+            for (idx_t j = 0; j < nvar; ++j) {
+                sum_per_level(l, j) = static_cast<T>(sums[l * nvar + j].value());
+            }
+        }
+        N = fs.nb_nodes_global();
+        return;
+    }
+
     for (idx_t l = 0; l < sum_per_level.shape(0); ++l) {
         for (idx_t j = 0; j < sum_per_level.shape(1); ++j) {
             sum_per_level(l, j) = 0;
@@ -316,6 +384,11 @@ void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field
 
 template <typename T>
 void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, T& result, idx_t& N) {
+    if (use_reproducible_sums<T>(fs)) {
+        // Exact sums are order independent, and need no gathering
+        dispatch_sum(fs, field, result, N);
+        return;
+    }
     if (field.levels()) {
         auto arr = make_leveled_scalar_view<const T>(field);
 
@@ -400,6 +473,11 @@ void dispatch_order_independent_sum_2d(const NodeColumns& fs, const Field& field
 
 template <typename T>
 void dispatch_order_independent_sum(const NodeColumns& fs, const Field& field, std::vector<T>& result, idx_t& N) {
+    if (use_reproducible_sums<T>(fs)) {
+        // Exact sums are order independent, and need no gathering
+        dispatch_sum(fs, field, result, N);
+        return;
+    }
     if (field.levels()) {
         const auto arr   = make_leveled_view<const T>(field);
         const idx_t npts = std::min(arr.shape(0), fs.nb_nodes());
@@ -471,6 +549,11 @@ void order_independent_sum(const NodeColumns& fs, const Field& field, std::vecto
 
 template <typename T>
 void dispatch_order_independent_sum_per_level(const NodeColumns& fs, const Field& field, Field& sumfield, idx_t& N) {
+    if (use_reproducible_sums<T>(fs)) {
+        // Exact sums are order independent, and need no gathering
+        dispatch_sum_per_level<T>(fs, field, sumfield, N);
+        return;
+    }
     array::ArrayShape shape;
     shape.reserve(field.rank() - 1);
     for (idx_t j = 1; j < field.rank(); ++j) {
@@ -1552,6 +1635,24 @@ void NodeColumns::FieldStatistics::meanAndStandardDeviationPerLevel(const Field&
     detail::mean_and_standard_deviation_per_level(functionspace, field, mean, stddev, N);
 }
 
+std::vector<Statistics> NodeColumns::statistics(const FieldSet& fields, const eckit::Configuration& config) const {
+    const mesh::IsGhostNode is_ghost(nodes());
+    std::vector<idx_t> owned;
+    owned.reserve(nb_nodes());
+    for (idx_t n = 0; n < nb_nodes(); ++n) {
+        if (!is_ghost(n)) {
+            owned.emplace_back(n);
+        }
+    }
+    return compute_statistics(fields, owned, nodes().global_index(), mpi_comm(), config);
+}
+
+Statistics NodeColumns::statistics(const Field& field, const eckit::Configuration& config) const {
+    FieldSet fields;
+    fields.add(field);
+    return statistics(fields, config).front();
+}
+
 template struct NodeColumns::FieldStatisticsT<int>;
 template struct NodeColumns::FieldStatisticsT<long>;
 template struct NodeColumns::FieldStatisticsT<float>;
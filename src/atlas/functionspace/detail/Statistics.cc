@@ -0,0 +1,334 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/functionspace/detail/Statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+namespace functionspace {
+namespace detail {
+
+namespace {
+
+// Number of owned points per block. Fixed, so that results do not depend on the number of threads.
+constexpr idx_t block_size = 2048;
+
+struct Selection {
+    Selection(const eckit::Configuration& config) {
+        std::vector<std::string> names{"sum", "mean", "stddev", "minimum", "maximum", "location"};
+        config.get("statistics", names);
+        for (const auto& name : names) {
+            if (name == "sum") {
+                sum = true;
+            }
+            else if (name == "mean") {
+                mean = true;
+            }
+            else if (name == "stddev") {
+                stddev = true;
+            }
+            else if (name == "minimum") {
+                minimum = true;
+            }
+            else if (name == "maximum") {
+                maximum = true;
+            }
+            else if (name == "location") {
+                location = true;
+            }
+            else {
+                throw_Exception("Unknown statistic \"" + name + "\"", Here());
+            }
+        }
+    }
+    bool moments() const { return sum || mean || stddev; }
+    bool extrema() const { return minimum || maximum || location || stddev; }
+    bool sum{false};
+    bool mean{false};
+    bool stddev{false};
+    bool minimum{false};
+    bool maximum{false};
+    bool location{false};
+};
+
+// Partial result for a set of values.
+// Extrema carry a key encoding (global index, level, variable), used to break ties deterministically.
+struct Accumulator {
+    double n{0};
+    double mean{0};
+    double m2{0};  // sum of squared differences from mean
+    double minimum{std::numeric_limits<double>::max()};
+    double maximum{std::numeric_limits<double>::lowest()};
+    gidx_t minimum_key{std::numeric_limits<gidx_t>::max()};
+    gidx_t maximum_key{std::numeric_limits<gidx_t>::max()};
+
+    void merge(const Accumulator& other) {
+        if (other.n == 0) {
+            return;
+        }
+        if (n == 0) {
+            *this = other;
+            return;
+        }
+        const double total = n + other.n;
+        const double delta = other.mean - mean;
+        mean += delta * other.n / total;
+        m2 += other.m2 + delta * delta * n * other.n / total;
+        n = total;
+        if (other.minimum < minimum || (other.minimum == minimum && other.minimum_key < minimum_key)) {
+            minimum     = other.minimum;
+            minimum_key = other.minimum_key;
+        }
+        if (other.maximum > maximum || (other.maximum == maximum && other.maximum_key < maximum_key)) {
+            maximum     = other.maximum;
+            maximum_key = other.maximum_key;
+        }
+    }
+};
+
+template <typename T>
+array::LocalView<const T, 3> make_leveled_view(const Field& field) {
+    using namespace array;
+    switch (field.rank()) {
+        case 1:
+            return make_view<const T, 1>(field).slice(Range::all(), Range::dummy(), Range::dummy());
+        case 2:
+            if (field.levels()) {
+                return make_view<const T, 2>(field).slice(Range::all(), Range::all(), Range::dummy());
+            }
+            return make_view<const T, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+        case 3:
+            return make_view<const T, 3>(field).slice(Range::all(), Range::all(), Range::all());
+        default:
+            throw_Exception("Field " + field.name() + " has unsupported rank " + std::to_string(field.rank()),
+                            Here());
+    }
+}
+
+// Accumulate values of owned points owned[0:size) in a single pass.
+// Moments are computed relative to the first value, to limit cancellation.
+template <typename T>
+void accumulate(const Field& field, const array::ArrayView<const gidx_t, 1>& global_index, const idx_t owned[],
+                idx_t size, Accumulator& acc) {
+    const auto values  = make_leveled_view<T>(field);
+    const idx_t nlev   = values.shape(1);
+    const idx_t nvar   = values.shape(2);
+    const gidx_t ncol  = gidx_t(nlev) * gidx_t(nvar);
+    const double shift = values(owned[0], 0, 0);
+
+    double s = 0.;
+    double q = 0.;
+    for (idx_t i = 0; i < size; ++i) {
+        const idx_t n = owned[i];
+        for (idx_t l = 0; l < nlev; ++l) {
+            for (idx_t v = 0; v < nvar; ++v) {
+                const double value = values(n, l, v);
+                const double d     = value - shift;
+                s += d;
+                q += d * d;
+                if (value <= acc.minimum) {
+                    const gidx_t key = global_index(n) * ncol + l * nvar + v;
+                    if (value < acc.minimum || key < acc.minimum_key) {
+                        acc.minimum     = value;
+                        acc.minimum_key = key;
+                    }
+                }
+                if (value >= acc.maximum) {
+                    const gidx_t key = global_index(n) * ncol + l * nvar + v;
+                    if (value > acc.maximum || key < acc.maximum_key) {
+                        acc.maximum     = value;
+                        acc.maximum_key = key;
+                    }
+                }
+            }
+        }
+    }
+    acc.n    = double(size) * double(ncol);
+    acc.mean = shift + s / acc.n;
+    acc.m2   = std::max(0., q - s * s / acc.n);
+}
+
+void accumulate(const Field& field, const array::ArrayView<const gidx_t, 1>& global_index, const idx_t owned[],
+                idx_t size, Accumulator& acc) {
+    if (size == 0) {
+        return;
+    }
+    switch (field.datatype().kind()) {
+        case array::DataType::KIND_INT32:
+            return accumulate<int>(field, global_index, owned, size, acc);
+        case array::DataType::KIND_INT64:
+            return accumulate<long>(field, global_index, owned, size, acc);
+        case array::DataType::KIND_REAL32:
+            return accumulate<float>(field, global_index, owned, size, acc);
+        case array::DataType::KIND_REAL64:
+            return accumulate<double>(field, global_index, owned, size, acc);
+        default:
+            throw_Exception("datatype not supported", Here());
+    }
+}
+
+void column_shape(const Field& field, idx_t& nlev, idx_t& nvar) {
+    nlev = 1;
+    nvar = 1;
+    if (field.rank() == 3) {
+        nlev = field.shape(1);
+        nvar = field.shape(2);
+    }
+    else if (field.rank() == 2) {
+        (field.levels() ? nlev : nvar) = field.shape(1);
+    }
+}
+
+void decode_location(gidx_t key, gidx_t ncol, idx_t nvar, gidx_t& glb_idx, idx_t& level, idx_t& variable) {
+    glb_idx        = key / ncol;
+    const idx_t jc = idx_t(key % ncol);
+    level          = jc / nvar;
+    variable       = jc % nvar;
+}
+
+}  // namespace
+
+std::vector<Statistics> compute_statistics(const FieldSet& fields, const std::vector<idx_t>& owned,
+                                           const Field& global_index_field, const std::string& mpi_comm,
+                                           const eckit::Configuration& config) {
+    ATLAS_TRACE("compute_statistics");
+    const Selection selection(config);
+    const idx_t nb_fields   = fields.size();
+    const idx_t nb_owned    = static_cast<idx_t>(owned.size());
+    const idx_t nb_blocks   = (nb_owned + block_size - 1) / block_size;
+    const auto global_index = array::make_view<gidx_t, 1>(global_index_field);
+
+    for (idx_t f = 0; f < nb_fields; ++f) {
+        ATLAS_ASSERT(fields[f].shape(0) >= global_index.shape(0),
+                     "Field " + fields[f].name() + " is smaller than the function space");
+    }
+
+    // Single pass over the data: each block of owned points visits every field once
+    std::vector<Accumulator> blocks(size_t(nb_blocks) * size_t(nb_fields));
+    atlas_omp_parallel_for(idx_t b = 0; b < nb_blocks; ++b) {
+        const idx_t begin = b * block_size;
+        const idx_t size  = std::min(block_size, nb_owned - begin);
+        for (idx_t f = 0; f < nb_fields; ++f) {
+            accumulate(fields[f], global_index, owned.data() + begin, size, blocks[size_t(f) * nb_blocks + b]);
+        }
+    }
+
+    // Pairwise tree reduction of blocks, in fixed order
+    std::vector<Accumulator> local(nb_fields);
+    atlas_omp_parallel_for(idx_t f = 0; f < nb_fields; ++f) {
+        Accumulator* acc = blocks.data() + size_t(f) * nb_blocks;
+        for (idx_t stride = 1; stride < nb_blocks; stride *= 2) {
+            for (idx_t b = 0; b + stride < nb_blocks; b += 2 * stride) {
+                acc[b].merge(acc[b + stride]);
+            }
+        }
+        if (nb_blocks) {
+            local[f] = acc[0];
+        }
+    }
+
+    // Combine MPI tasks with batched collectives over all fields
+    const auto& comm = mpi::comm(mpi_comm);
+
+    std::vector<double> extrema(2 * nb_fields);
+    if (selection.extrema()) {
+        for (idx_t f = 0; f < nb_fields; ++f) {
+            extrema[2 * f + 0] = local[f].minimum;
+            extrema[2 * f + 1] = -local[f].maximum;
+        }
+        ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(extrema.data(), extrema.size(), eckit::mpi::min()); }
+    }
+
+    // Moments are shifted by the centre of the global range, which bounds the cancellation error
+    // when combining the partial sums of squares. The shift must be the same on every MPI task, so it is
+    // derived from the global extrema only; these are valid if any task has values.
+    std::vector<double> shift(nb_fields, 0.);
+    std::vector<double> moments(3 * nb_fields);
+    if (selection.moments()) {
+        for (idx_t f = 0; f < nb_fields; ++f) {
+            if (selection.stddev && extrema[2 * f + 0] <= -extrema[2 * f + 1]) {
+                shift[f] = 0.5 * (extrema[2 * f + 0] - extrema[2 * f + 1]);
+            }
+            const double d     = local[f].mean - shift[f];
+            moments[3 * f + 0] = local[f].n;
+            moments[3 * f + 1] = local[f].n * d;
+            moments[3 * f + 2] = local[f].m2 + local[f].n * d * d;
+        }
+        ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(moments.data(), moments.size(), eckit::mpi::sum()); }
+    }
+
+    std::vector<gidx_t> locations(2 * nb_fields, std::numeric_limits<gidx_t>::max());
+    if (selection.location) {
+        for (idx_t f = 0; f < nb_fields; ++f) {
+            if (local[f].n > 0 && local[f].minimum == extrema[2 * f + 0]) {
+                locations[2 * f + 0] = local[f].minimum_key;
+            }
+            if (local[f].n > 0 && local[f].maximum == -extrema[2 * f + 1]) {
+                locations[2 * f + 1] = local[f].maximum_key;
+            }
+        }
+        ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(locations.data(), locations.size(), eckit::mpi::min()); }
+    }
+
+    std::vector<Statistics> result(nb_fields);
+    for (idx_t f = 0; f < nb_fields; ++f) {
+        Statistics& stats = result[f];
+        if (selection.minimum) {
+            stats.minimum = extrema[2 * f + 0];
+        }
+        if (selection.maximum) {
+            stats.maximum = -extrema[2 * f + 1];
+        }
+        if (selection.moments()) {
+            const double N = moments[3 * f + 0];
+            stats.N        = static_cast<gidx_t>(N);
+            if (N > 0) {
+                const double s = moments[3 * f + 1];
+                if (selection.sum) {
+                    stats.sum = shift[f] * N + s;
+                }
+                if (selection.mean) {
+                    stats.mean = shift[f] + s / N;
+                }
+                if (selection.stddev) {
+                    stats.stddev = std::sqrt(std::max(0., moments[3 * f + 2] - s * s / N) / N);
+                }
+            }
+        }
+        if (selection.location && locations[2 * f] != std::numeric_limits<gidx_t>::max()) {
+            idx_t nlev, nvar;
+            column_shape(fields[f], nlev, nvar);
+            const gidx_t ncol = gidx_t(nlev) * gidx_t(nvar);
+            stats.minimum     = extrema[2 * f + 0];
+            stats.maximum     = -extrema[2 * f + 1];
+            decode_location(locations[2 * f + 0], ncol, nvar, stats.minimum_glb_idx, stats.minimum_level,
+                            stats.minimum_variable);
+            decode_location(locations[2 * f + 1], ncol, nvar, stats.maximum_glb_idx, stats.maximum_level,
+                            stats.maximum_variable);
+        }
+    }
+    return result;
+}
+
+}  // namespace detail
+}  // namespace functionspace
+}  // namespace atlas
@@ -0,0 +1,84 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/library/config.h"
+
+namespace eckit {
+class Configuration;
+}
+
+namespace atlas {
+class Field;
+class FieldSet;
+}  // namespace atlas
+
+namespace atlas {
+namespace functionspace {
+
+// -------------------------------------------------------------------
+
+/// @brief Statistics of a field over all owned points, levels and variables
+///
+/// Computed by NodeColumns::statistics() and StructuredColumns::statistics(). Which statistics are
+/// computed can be configured with the option "statistics", a list containing any of
+/// "sum", "mean", "stddev", "minimum", "maximum" and "location". By default all are computed.
+/// Members that were not requested are left at their default value.
+struct Statistics {
+    gidx_t N{0};        ///< Number of values, i.e. owned points * levels * variables (with sum, mean or stddev)
+    double sum{0};      ///< Sum of all values
+    double mean{0};     ///< Mean of all values
+    double stddev{0};   ///< Population standard deviation of all values
+    double minimum{0};  ///< Minimum value
+    double maximum{0};  ///< Maximum value
+
+    /// Location of the minimum ("location", which also sets minimum and maximum).
+    /// On ties, the smallest global index, level and variable.
+    gidx_t minimum_glb_idx{0};
+    idx_t minimum_level{0};
+    idx_t minimum_variable{0};
+
+    /// Location of the maximum ("location").
+    /// On ties, the smallest global index, level and variable.
+    gidx_t maximum_glb_idx{0};
+    idx_t maximum_level{0};
+    idx_t maximum_variable{0};
+};
+
+// -------------------------------------------------------------------
+
+namespace detail {
+
+/// @brief Compute statistics for all fields in a single pass over the data
+///
+/// The owned points are split in blocks of fixed size, and per-block partial results are combined
+/// with a pairwise tree reduction, so that the result does not depend on the number of threads.
+/// Partial results of all fields are combined across MPI tasks with at most three collectives in total,
+/// independent of the number of fields.
+///
+/// @param [in] fields        Fields with the points as first dimension, followed by optional levels and variables
+/// @param [in] owned         Indices of owned points
+/// @param [in] global_index  Global index of each point
+/// @param [in] mpi_comm      Name of MPI communicator
+/// @param [in] config        Option "statistics" to select a subset of statistics
+std::vector<Statistics> compute_statistics(const FieldSet& fields, const std::vector<idx_t>& owned,
+                                           const Field& global_index, const std::string& mpi_comm,
+                                           const eckit::Configuration& config);
+
+}  // namespace detail
+
+// -------------------------------------------------------------------
+
+}  // namespace functionspace
+}  // namespace atlas
@@ -13,6 +13,7 @@
 #include <fstream>
 #include <iomanip>
 #include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
 
@@ -22,6 +23,7 @@
 #include "atlas/array/MakeView.h"
 #include "atlas/domain.h"
 #include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/detail/FieldSetGatherScatter.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/grid/StructuredGrid.h"
@@ -121,7 +123,8 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
-            << ",distribution=" << funcspace.distribution() << "]";
+            << ",distribution=" << funcspace.distribution() << ",ordering=" << funcspace.ordering_ << "("
+            << funcspace.tile_size_[0] << "x" << funcspace.tile_size_[1] << ")]";
         return key.str();
     }
 
@@ -170,7 +173,8 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
-            << ",distribution=" << funcspace.distribution() << "]";
+            << ",distribution=" << funcspace.distribution() << ",ordering=" << funcspace.ordering_ << "("
+            << funcspace.tile_size_[0] << "x" << funcspace.tile_size_[1] << ")]";
         return key.str();
     }
 
@@ -219,7 +223,8 @@ private:
         std::ostringstream key;
         key << "grid[address=" << funcspace.grid().get() << ",halo=" << funcspace.halo()
             << ",periodic_points=" << std::boolalpha << funcspace.periodic_points_
-            << ",distribution=" << funcspace.distribution() << "]";
+            << ",distribution=" << funcspace.distribution() << ",ordering=" << funcspace.ordering_ << "("
+            << funcspace.tile_size_[0] << "x" << funcspace.tile_size_[1] << ")]";
         return key.str();
     }
 
@@ -235,6 +240,12 @@ private:
 
     static value_type* create(const detail::StructuredColumns* funcspace) {
         value_type* value = new value_type();
+        if (value->mode() == parallel::Checksum::Mode::reduce) {
+            value->setup(funcspace->mpi_comm(), array::make_view<int, 1>(funcspace->partition()).data(),
+                         array::make_view<idx_t, 1>(funcspace->remote_index()).data(), REMOTE_IDX_BASE,
+                         array::make_view<gidx_t, 1>(funcspace->global_index()).data(), funcspace->sizeOwned());
+            return value;
+        }
         util::ObjectHandle<parallel::GatherScatter> gather(
             StructuredColumnsGatherScatterCache::instance().get_or_create(*funcspace));
         value->setup(gather);
@@ -584,37 +595,7 @@ Field StructuredColumns::createField(const Field& other, const eckit::Configurat
 void StructuredColumns::gather(const FieldSet& local_fieldset, FieldSet& global_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
 
-    for (idx_t f = 0; f < local_fieldset.size(); ++f) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root(0);
-        glb.metadata().get("owner", root);
-
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> loc_field(make_leveled_view<const int>(loc));
-            parallel::Field<int> glb_field(make_leveled_view<int>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> loc_field(make_leveled_view<const long>(loc));
-            parallel::Field<long> glb_field(make_leveled_view<long>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> loc_field(make_leveled_view<const float>(loc));
-            parallel::Field<float> glb_field(make_leveled_view<float>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> loc_field(make_leveled_view<const double>(loc));
-            parallel::Field<double> glb_field(make_leveled_view<double>(glb));
-            gather().gather(&loc_field, &glb_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-    }
+    gather_fieldset(gather(), local_fieldset, global_fieldset);
 }
 // ----------------------------------------------------------------------------
 
@@ -636,37 +617,14 @@ void StructuredColumns::gather(const Field& local, Field& global) const {
 void StructuredColumns::scatter(const FieldSet& global_fieldset, FieldSet& local_fieldset) const {
     ATLAS_ASSERT(local_fieldset.size() == global_fieldset.size());
 
+    scatter_fieldset(scatter(), global_fieldset, local_fieldset);
+
     for (idx_t f = 0; f < local_fieldset.size(); ++f) {
         const Field& glb      = global_fieldset[f];
         Field& loc            = local_fieldset[f];
-        const idx_t nb_fields = 1;
         idx_t root(0);
         glb.metadata().get("owner", root);
 
-        if (loc.datatype() == array::DataType::kind<int>()) {
-            parallel::Field<int const> glb_field(make_leveled_view<const int>(glb));
-            parallel::Field<int> loc_field(make_leveled_view<int>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<long>()) {
-            parallel::Field<long const> glb_field(make_leveled_view<const long>(glb));
-            parallel::Field<long> loc_field(make_leveled_view<long>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<float>()) {
-            parallel::Field<float const> glb_field(make_leveled_view<const float>(glb));
-            parallel::Field<float> loc_field(make_leveled_view<float>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else if (loc.datatype() == array::DataType::kind<double>()) {
-            parallel::Field<double const> glb_field(make_leveled_view<const double>(glb));
-            parallel::Field<double> loc_field(make_leveled_view<double>(loc));
-            scatter().scatter(&glb_field, &loc_field, nb_fields, root);
-        }
-        else {
-            throw_Exception("datatype not supported", Here());
-        }
-
         glb.metadata().broadcast(loc.metadata(), root);
         loc.metadata().set("global", false);
     }
@@ -713,6 +671,19 @@ std::string StructuredColumns::checksum(const Field& field) const {
     return checksum(fieldset);
 }
 
+std::vector<Statistics> StructuredColumns::statistics(const FieldSet& fields,
+                                                      const eckit::Configuration& config) const {
+    std::vector<idx_t> owned(sizeOwned());
+    std::iota(owned.begin(), owned.end(), 0);
+    return compute_statistics(fields, owned, global_index(), mpi_comm(), config);
+}
+
+Statistics StructuredColumns::statistics(const Field& field, const eckit::Configuration& config) const {
+    FieldSet fields;
+    fields.add(field);
+    return statistics(fields, config).front();
+}
+
 const StructuredGrid& StructuredColumns::grid() const {
     return *grid_;
 }
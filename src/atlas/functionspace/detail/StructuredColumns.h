@@ -11,11 +11,13 @@
 
 #include <array>
 #include <functional>
+#include <string>
 #include <type_traits>
 
 #include "atlas/array/DataType.h"
 #include "atlas/field/Field.h"
 #include "atlas/functionspace/detail/FunctionSpaceImpl.h"
+#include "atlas/functionspace/detail/Statistics.h"
 #include "atlas/grid/StructuredGrid.h"
 #include "atlas/grid/Vertical.h"
 #include "atlas/library/config.h"
@@ -112,6 +114,10 @@ public:
     std::string checksum(const FieldSet&) const;
     std::string checksum(const Field&) const;
 
+    /// @brief Compute statistics of each field over owned points in a single pass over the data,
+    /// see functionspace::Statistics
+    std::vector<Statistics> statistics(const FieldSet&, const eckit::Configuration& = util::NoConfig()) const;
+    Statistics statistics(const Field&, const eckit::Configuration& = util::NoConfig()) const;
 
     const Vertical& vertical() const { return vertical_; }
 
@@ -139,6 +145,16 @@ public:
         return ij2gp_(i, j);
     }
 
+    /// @brief Storage order of owned points, configured with option "ordering"
+    ///
+    /// - "rows" (default): latitude row by latitude row
+    /// - "tiles": in tiles of "tile_size" = [ni,nj] points (default [16,8]), ordered row by row within
+    ///   each tile. Tiles are aligned in x across rows of different length, so that stencils spanning
+    ///   several rows touch nearby memory. Halo points follow the owned points as with "rows".
+    ///
+    /// In either case index(i,j) remains a direct lookup, and the owned points come first.
+    const std::string& ordering() const { return ordering_; }
+
     Field lonlat() const override { return field_xy_; }
     Field xy() const { return field_xy_; }
     Field z() const { return field_z_; }
@@ -210,6 +226,9 @@ private:  // data
     idx_t size_halo_;
     idx_t halo_;
 
+    std::string ordering_{"rows"};
+    std::array<idx_t, 2> tile_size_{16, 8};
+
     friend class StructuredColumnsHaloExchangeCache;
     friend class StructuredColumnsGatherScatterCache;
     friend class StructuredColumnsChecksumCache;
@@ -15,6 +15,7 @@
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 #include "atlas/array/MakeView.h"
 #include "atlas/field/FieldSet.h"
@@ -24,6 +25,7 @@
 #include "atlas/library/Library.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/omp.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -91,6 +93,18 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
         throw_Exception("Grid is not a grid::Structured type", Here());
     }
 
+    config.get("ordering", ordering_);
+    if (ordering_ != "rows" && ordering_ != "tiles") {
+        throw_Exception("StructuredColumns: unknown ordering \"" + ordering_ + "\". Expected \"rows\" or \"tiles\"",
+                        Here());
+    }
+    std::vector<long> tile_size;
+    if (config.get("tile_size", tile_size)) {
+        ATLAS_ASSERT(tile_size.size() == 2, "tile_size must be given as [ni,nj]");
+        ATLAS_ASSERT(tile_size[0] > 0 && tile_size[1] > 0, "tile_size must be positive");
+        tile_size_ = {idx_t(tile_size[0]), idx_t(tile_size[1])};
+    }
+
     bool periodic_x = false, periodic_y = false;
     config.get("periodic_x", periodic_x);
     config.get("periodic_y", periodic_y);
@@ -529,6 +543,25 @@ void StructuredColumns::setup(const grid::Distribution& distribution, const ecki
 
             ATLAS_ASSERT(gridpoints.size() == owned);
 
+            if (ordering_ == "tiles") {
+                // Renumber owned points tile by tile. Points keep row-major order within a tile, as the
+                // sort key ends with their original (row-major) position. Tile columns are computed
+                // relative to the widest row, so that tiles of rows with different nx cover the same x-range.
+                const gidx_t nx_max = grid_->nxmax();
+                const idx_t ni      = tile_size_[0];
+                const idx_t nj      = tile_size_[1];
+                std::vector<std::tuple<idx_t, idx_t, idx_t>> tiles(owned);
+                atlas_omp_parallel_for(idx_t r = 0; r < owned; ++r) {
+                    const GridPoint& gp = gridpoints[r];
+                    const idx_t tile_i  = idx_t(gidx_t(gp.i) * nx_max / grid_->nx(gp.j)) / ni;
+                    tiles[r]            = std::make_tuple((gp.j - j_begin_) / nj, tile_i, r);
+                }
+                omp::sort(tiles.begin(), tiles.end());
+                atlas_omp_parallel_for(idx_t r = 0; r < owned; ++r) {
+                    gridpoints.gp_[std::get<2>(tiles[r])].r = r;
+                }
+            }
+
             gridpoints.resize(owned + extra_halo);
             idx_t r = owned;
             for (idx_t j = j_begin_halo_; j < j_begin_; ++j) {
@@ -33,6 +33,7 @@ class Distribution : DOXYGEN_HIDE(public util::ObjectHandle<DistributionImpl>) {
 
 public:
     using Config      = DistributionImpl::Config;
+    using Range       = DistributionImpl::Range;
     using partition_t = atlas::vector<int>;
 
     using Handle::Handle;
@@ -63,6 +64,9 @@ public:
         return get()->partition(begin, end, partitions.data());
     }
 
+    /// @brief Contiguous ranges [first,second) of global indices that belong to given partition, in increasing order
+    std::vector<Range> partition_ranges(int part) const { return get()->partition_ranges(part); }
+
     size_t footprint() const { return get()->footprint(); }
 
     ATLAS_ALWAYS_INLINE idx_t nb_partitions() const { return get()->nb_partitions(); }
@@ -42,44 +42,61 @@ BandsDistribution<Int>::BandsDistribution(const atlas::Grid& grid, atlas::idx_t
     this->nb_pts_.reserve(nb_partitions_Int_);
 
     for (idx_t iproc = 0; iproc < nb_partitions; iproc++) {
-        // Approximate values
-        gidx_t imin = blocksize_ * (((iproc + 0) * nb_blocks_) / nb_partitions_Int_);
-        gidx_t imax = blocksize_ * (((iproc + 1) * nb_blocks_) / nb_partitions_Int_);
-
-        while (imin > 0) {
-            if (function(imin - blocksize_) == iproc) {
-                imin -= blocksize_;
-            }
-            else {
-                break;
-            }
-        }
+        auto r = range(iproc);
+        this->nb_pts_.push_back(r.second - r.first);
+    }
 
-        while (function(imin) < iproc) {
-            imin += blocksize_;
-        }
+    this->max_pts_ = *std::max_element(this->nb_pts_.begin(), this->nb_pts_.end());
+    this->min_pts_ = *std::min_element(this->nb_pts_.begin(), this->nb_pts_.end());
 
-        while (function(imax - 1) == iproc + 1) {
-            imax -= blocksize_;
-        }
+    ATLAS_ASSERT(detectOverflow(gridsize, nb_partitions_Int_, blocksize_) == false);
+}
+
+template <typename Int>
+DistributionImpl::Range BandsDistribution<Int>::range(idx_t iproc) const {
+    const gidx_t gridsize = this->size_;
 
-        while (imax + blocksize_ <= gridsize) {
-            if (function(imax) == iproc) {
-                imax += blocksize_;
-            }
-            else {
-                break;
-            }
+    // Approximate values
+    gidx_t imin = blocksize_ * (((iproc + 0) * nb_blocks_) / nb_partitions_Int_);
+    gidx_t imax = blocksize_ * (((iproc + 1) * nb_blocks_) / nb_partitions_Int_);
+
+    while (imin > 0) {
+        if (function(imin - blocksize_) == iproc) {
+            imin -= blocksize_;
+        }
+        else {
+            break;
         }
+    }
 
-        imax = std::min(imax, (gidx_t)gridsize);
-        this->nb_pts_.push_back(imax - imin);
+    while (function(imin) < iproc) {
+        imin += blocksize_;
     }
 
-    this->max_pts_ = *std::max_element(this->nb_pts_.begin(), this->nb_pts_.end());
-    this->min_pts_ = *std::min_element(this->nb_pts_.begin(), this->nb_pts_.end());
+    while (function(imax - 1) == iproc + 1) {
+        imax -= blocksize_;
+    }
 
-    ATLAS_ASSERT(detectOverflow(gridsize, nb_partitions_Int_, blocksize_) == false);
+    while (imax + blocksize_ <= gridsize) {
+        if (function(imax) == iproc) {
+            imax += blocksize_;
+        }
+        else {
+            break;
+        }
+    }
+
+    imax = std::min(imax, gridsize);
+    return {imin, imax};
+}
+
+template <typename Int>
+std::vector<DistributionImpl::Range> BandsDistribution<Int>::partition_ranges(int part) const {
+    auto r = range(part);
+    if (r.second > r.first) {
+        return {r};
+    }
+    return {};
 }
 
 template <typename Int>
@@ -34,7 +34,13 @@ public:
         return (iblock * nb_partitions_Int_) / nb_blocks_;
     }
 
+    std::vector<DistributionImpl::Range> partition_ranges(int part) const override;
+
     static bool detectOverflow(size_t gridsize, size_t nb_partitions, size_t blocksize);
+
+private:
+    /// @brief Range [first,second) of global indices of a partition, as bands are contiguous
+    DistributionImpl::Range range(idx_t iproc) const;
 };
 
 
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <ostream>
+#include <string>
 #include <vector>
 
 #include "eckit/types/Types.h"
@@ -20,6 +21,7 @@
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Partitioner.h"
 #include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
 #include "atlas/util/Config.h"
 
 namespace atlas {
@@ -118,6 +120,44 @@ DistributionArray::DistributionArray(int nb_partitions, partition_t&& part):
 
 DistributionArray::~DistributionArray() = default;
 
+std::vector<DistributionImpl::Range> DistributionArray::partition_ranges(int part) const {
+    ATLAS_ASSERT(part >= 0 && part < nb_partitions_, "Partition " + std::to_string(part) + " out of range");
+
+    // The partition array is scanned in one chunk per thread; ranges that touch across chunk boundaries are joined
+    const gidx_t size   = part_.size();
+    const int nb_chunks = static_cast<int>(std::max<gidx_t>(1, std::min<gidx_t>(atlas_omp_get_max_threads(), size)));
+    std::vector<std::vector<Range>> chunk_ranges(nb_chunks);
+    atlas_omp_parallel_for(int c = 0; c < nb_chunks; ++c) {
+        const gidx_t chunk_begin = size * c / nb_chunks;
+        const gidx_t chunk_end   = size * (c + 1) / nb_chunks;
+        auto& ranges             = chunk_ranges[c];
+        for (gidx_t n = chunk_begin; n < chunk_end;) {
+            if (part_[n] != part) {
+                ++n;
+                continue;
+            }
+            const gidx_t begin = n;
+            while (n < chunk_end && part_[n] == part) {
+                ++n;
+            }
+            ranges.emplace_back(begin, n);
+        }
+    }
+
+    std::vector<Range> ranges;
+    for (const auto& chunk : chunk_ranges) {
+        for (const auto& range : chunk) {
+            if (not ranges.empty() && ranges.back().second == range.first) {
+                ranges.back().second = range.second;
+            }
+            else {
+                ranges.emplace_back(range);
+            }
+        }
+    }
+    return ranges;
+}
+
 void DistributionArray::print(std::ostream& s) const {
     auto print_partition = [&](std::ostream& s) {
         eckit::output_list<int> list_printer(s);
@@ -75,6 +75,9 @@ public:
         }
     }
 
+    /// @brief Contiguous ranges of global indices of given partition, found with a threaded scan of the partition array
+    std::vector<Range> partition_ranges(int part) const override;
+
 protected:
     idx_t nb_partitions_ = 0;
 
@@ -21,6 +21,30 @@
 namespace atlas {
 namespace grid {
 
+std::vector<DistributionImpl::Range> DistributionImpl::partition_ranges(int part) const {
+    constexpr gidx_t chunk = 4096;
+    std::vector<int> partitions(chunk);
+    std::vector<Range> ranges;
+    bool in_range = false;
+    for (gidx_t begin = 0; begin < size(); begin += chunk) {
+        gidx_t end = std::min(begin + chunk, size());
+        partition(begin, end, partitions.data());
+        for (gidx_t n = begin; n < end; ++n) {
+            if (partitions[n - begin] == part) {
+                if (not in_range) {
+                    ranges.emplace_back(n, n);
+                    in_range = true;
+                }
+                ranges.back().second = n + 1;
+            }
+            else {
+                in_range = false;
+            }
+        }
+    }
+    return ranges;
+}
+
 DistributionImpl* atlas__GridDistribution__new(idx_t size, int part[], int part0) {
     return new detail::distribution::DistributionArray(0, size, part, part0);
 }
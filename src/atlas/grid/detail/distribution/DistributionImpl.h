@@ -11,6 +11,7 @@
 #pragma once
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "atlas/library/config.h"
@@ -44,6 +45,7 @@ namespace grid {
 class DistributionImpl : public util::Object {
 public:
     using Config = atlas::util::Config;
+    using Range  = std::pair<gidx_t, gidx_t>;
     virtual ~DistributionImpl() {}
     virtual int partition(const gidx_t gidx) const = 0;
     virtual bool functional() const                = 0;
@@ -64,6 +66,12 @@ public:
     virtual void hash(eckit::Hash&) const = 0;
 
     virtual void partition(gidx_t begin, gidx_t end, int partitions[]) const = 0;
+
+    /// @brief Contiguous ranges [first,second) of global indices that belong to given partition, in increasing order
+    ///
+    /// The default implementation scans all points; distributions override this when the ranges are known
+    /// without scanning the global grid.
+    virtual std::vector<Range> partition_ranges(int part) const;
 };
 
 
@@ -35,6 +35,13 @@ SerialDistribution::SerialDistribution(const Grid& grid, int part): Distribution
     part_          = part;
 }
 
+std::vector<DistributionImpl::Range> SerialDistribution::partition_ranges(int part) const {
+    if (part == part_ && size_ > 0) {
+        return {Range{0, size_}};
+    }
+    return {};
+}
+
 
 }  // namespace distribution
 }  // namespace detail
@@ -24,6 +24,8 @@ public:
 
     ATLAS_ALWAYS_INLINE int function(gidx_t gidx) const { return part_; }
 
+    std::vector<Range> partition_ranges(int part) const override;
+
 private:
     int part_{0};
 };
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <ctime>
 #include <functional>
 #include <iostream>
@@ -541,6 +542,15 @@ bool compare_WE_NS(const EqualRegionsPartitioner::NodeInt& node1, const EqualReg
     return false;
 }
 
+// Integer keys giving the same order as compare_NS_WE and compare_WE_NS, for omp::radix_sort
+std::uint64_t key_NS_WE(const EqualRegionsPartitioner::NodeInt& node) {
+    return (std::uint64_t(~(std::uint32_t(node.y) ^ 0x80000000u)) << 32) | (std::uint32_t(node.x) ^ 0x80000000u);
+}
+
+std::uint64_t key_WE_NS(const EqualRegionsPartitioner::NodeInt& node) {
+    return (std::uint64_t(std::uint32_t(node.x) ^ 0x80000000u) << 32) | ~(std::uint32_t(node.y) ^ 0x80000000u);
+}
+
 void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], int part[]) const {
     ATLAS_TRACE("EqualRegionsPartitioner::partition");
 
@@ -579,7 +589,7 @@ void EqualRegionsPartitioner::partition(int nb_nodes, NodeInt nodes[], int part[
             count.push_back(chunk_size + (remainder-- > 0 ? 1 : 0));
             end += count.back();
         }
-        std::sort(nodes + begin, nodes + end, compare_WE_NS);
+        omp::radix_sort(nodes + begin, nodes + end, key_WE_NS);
     }
 
     /*
@@ -792,7 +802,7 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                     else {
                         ATLAS_THROW_EXCEPTION("Should not be here");
                     }
-                    ATLAS_TRACE_SCOPE("sort one bit") { omp::sort(w_nodes.begin(), w_nodes.end(), compare_NS_WE); }
+                    ATLAS_TRACE_SCOPE("sort one bit") { omp::radix_sort(w_nodes.begin(), w_nodes.end(), key_NS_WE); }
                     ATLAS_TRACE_SCOPE("send to rank0") {
                         ATLAS_ASSERT(valid_mpi_size(w_size * 3));
                         comm.send(w_nodes_buffer, w_size * 3, /* dest= */ 0, /* tag= */ 0);
@@ -805,17 +815,16 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                 }
             }
             ATLAS_TRACE_SCOPE("merge sorted") {
+                std::vector<int> w_sizes(nb_workers);
                 for (int w = 0; w < nb_workers; ++w) {
                     int w_begin = w * grid.size() / N_;
                     int w_end   = (w + 1) * grid.size() / N_;
                     if (w == nb_workers - 1) {
                         w_end = grid.size();
                     }
-                    if (w != 0) {
-                        std::inplace_merge(nodes.begin(), nodes.begin() + w_begin, nodes.begin() + w_end,
-                                           compare_NS_WE);
-                    }
+                    w_sizes[w] = w_end - w_begin;
                 }
+                omp::merge_blocks(nodes.begin(), nodes.end(), w_sizes.begin(), w_sizes.end(), compare_NS_WE);
             }
             ATLAS_TRACE_MPI(BROADCAST) {
                 ATLAS_ASSERT(valid_mpi_size(grid.size() * 3));
@@ -886,7 +895,7 @@ void EqualRegionsPartitioner::partition(const Grid& grid, int part[]) const {
                     }
                     if (work_rank == mpi_rank) {
                         ATLAS_TRACE_SCOPE("sort bit of band on each MPI rank") {
-                            omp::sort(nodes.data() + w_begin, nodes.data() + w_end, compare_WE_NS);
+                            omp::radix_sort(nodes.data() + w_begin, nodes.data() + w_end, key_WE_NS);
                         }
                         if (mpi_rank != w0_work_rank) {
                             ATLAS_TRACE_SCOPE("send bit of band to band leader " + std::to_string(w0_work_rank)) {
@@ -10,6 +10,7 @@
 
 #include "ArrayAdaptor.h"
 
+#include <cstdint>
 #include <cstring>  // memcpy
 #include <sstream>
 
@@ -51,5 +52,43 @@ void decode(const atlas::io::Metadata& metadata, const atlas::io::Data& data, at
 
 //---------------------------------------------------------------------------------------------------------------------
 
+Array* wrap(const atlas::io::Metadata& metadata, const atlas::io::Data& data) {
+    atlas::io::ArrayMetadata array(metadata);
+    DataType datatype(array.datatype().str());
+
+    if (metadata.data.compressed() || data.size() != array.bytes()) {
+        throw atlas::io::Exception("Could not wrap " + metadata.json() + ": data is not uncompressed", Here());
+    }
+    if (reinterpret_cast<std::uintptr_t>(data.data()) % datatype.size() != 0) {
+        throw atlas::io::Exception("Could not wrap " + metadata.json() + ": data is not aligned", Here());
+    }
+
+    ArrayShape shape;
+    for (auto& s : array.shape()) {
+        shape.emplace_back(static_cast<idx_t>(s));
+    }
+    void* p = const_cast<void*>(data.data());
+
+    switch (datatype.kind()) {
+        case DataType::KIND_REAL64:
+            return Array::wrap<double>(static_cast<double*>(p), shape);
+        case DataType::KIND_REAL32:
+            return Array::wrap<float>(static_cast<float*>(p), shape);
+        case DataType::KIND_INT32:
+            return Array::wrap<int>(static_cast<int*>(p), shape);
+        case DataType::KIND_INT64:
+            return Array::wrap<long>(static_cast<long*>(p), shape);
+        case DataType::KIND_UINT64:
+            return Array::wrap<unsigned long>(static_cast<unsigned long*>(p), shape);
+        default: {
+            std::stringstream err;
+            err << "data kind " << datatype.kind() << " not recognised.";
+            throw atlas::io::Exception(err.str(), Here());
+        }
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 }  // namespace array
 }  // namespace atlas
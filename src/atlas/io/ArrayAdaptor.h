@@ -25,6 +25,12 @@ void interprete(const Array&, atlas::io::ArrayReference&);
 
 void decode(const atlas::io::Metadata&, const atlas::io::Data&, Array&);
 
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Create an Array that wraps uncompressed encoded data in place, without copying.
+/// The data, e.g. mapped via atlas::io::RecordItemReader::map(), must outlive the Array and be aligned to the datatype.
+Array* wrap(const atlas::io::Metadata&, const atlas::io::Data&);
+
 //---------------------------------------------------------------------------------------------------------------------
 }  // namespace array
 }  // namespace atlas
@@ -0,0 +1,278 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "DistributedRecord.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/io/atlas-io.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+
+#include "atlas_io/detail/RecordSections.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+struct DistributedItem {
+    std::string key;
+    ArrayMetadata array;
+    size_t bytes_per_point;
+    std::function<void(char*)> pack;  // packs owned points of this task
+};
+
+void pwrite_all(int fd, const void* buffer, size_t size, size_t offset, const std::string& path) {
+    const char* p = static_cast<const char*>(buffer);
+    while (size) {
+        ssize_t written = ::pwrite(fd, p, size, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_Exception("Could not write to " + path + ": " + std::strerror(errno), Here());
+        }
+        p += written;
+        offset += size_t(written);
+        size -= size_t(written);
+    }
+}
+
+template <typename Struct>
+void append_struct(std::string& out, const Struct& s) {
+    static_assert(Struct::bytes == sizeof(Struct), "");
+    out.append(reinterpret_cast<const char*>(&s), sizeof(s));
+}
+
+// Write head, metadata, index, data section markers and record end.
+// Returns the absolute file offsets of the data of each item.
+// The record is written at the start of the file.
+std::vector<size_t> write_record_layout(int fd, const std::vector<DistributedItem>& items,
+                                        const std::vector<long>& partitions, const std::string& path,
+                                        size_t& record_length) {
+    Metadata metadata;
+    for (size_t i = 0; i < items.size(); ++i) {
+        Metadata m;
+        encode_metadata(items[i].array, m);
+        if (items[i].key == "global_index") {
+            m.set("partitions", partitions);
+        }
+        else {
+            m.set("ordering", "global_index");
+        }
+        m.set("data.section", int(i + 1));
+        metadata.set(items[i].key, m);
+    }
+    std::stringstream ss;
+    atlas::io::write(metadata, ss);
+    std::string metadata_str = ss.str();
+
+    RecordHead r;
+    std::string head;
+
+    r.metadata_offset = sizeof(RecordHead);
+    r.metadata_length = sizeof(RecordMetadataSection::Begin) + metadata_str.size() + sizeof(RecordMetadataSection::End);
+    r.metadata_checksum = atlas::io::checksum(metadata_str.data(), metadata_str.size());
+    r.index_offset      = r.metadata_offset + r.metadata_length;
+    r.index_length      = sizeof(RecordDataIndexSection::Begin) + items.size() * sizeof(RecordDataIndexSection::Entry) +
+                     sizeof(RecordDataIndexSection::End);
+
+    std::vector<RecordDataIndexSection::Entry> index(items.size());
+    std::vector<size_t> data_offsets(items.size());
+    size_t position = r.index_offset + r.index_length;
+    for (size_t i = 0; i < items.size(); ++i) {
+        index[i].offset   = position;
+        index[i].length   = sizeof(RecordDataSection::Begin) + items[i].array.bytes() + sizeof(RecordDataSection::End);
+        index[i].checksum = std::string("none:");
+        data_offsets[i]   = position + sizeof(RecordDataSection::Begin);
+        position += index[i].length;
+    }
+    r.record_length = position + sizeof(RecordEnd);
+    r.time          = atlas::io::Time::now();
+    record_length   = r.record_length;
+
+    append_struct(head, r);
+    append_struct(head, RecordMetadataSection::Begin());
+    head += metadata_str;
+    append_struct(head, RecordMetadataSection::End());
+    append_struct(head, RecordDataIndexSection::Begin());
+    for (auto& entry : index) {
+        append_struct(head, entry);
+    }
+    append_struct(head, RecordDataIndexSection::End());
+    pwrite_all(fd, head.data(), head.size(), 0, path);
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        RecordDataSection::Begin section_begin;
+        RecordDataSection::End section_end;
+        pwrite_all(fd, &section_begin, sizeof(section_begin), data_offsets[i] - sizeof(section_begin), path);
+        pwrite_all(fd, &section_end, sizeof(section_end), data_offsets[i] + items[i].array.bytes(), path);
+    }
+    RecordEnd record_end;
+    pwrite_all(fd, &record_end, sizeof(record_end), r.record_length - sizeof(record_end), path);
+    return data_offsets;
+}
+
+}  // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+
+size_t write_distributed(const FieldSet& fields, const std::string& path) {
+    ATLAS_TRACE("atlas::io::write_distributed(" + path + ")");
+    ATLAS_ASSERT(fields.size() > 0);
+    FunctionSpace functionspace = fields[0].functionspace();
+    ATLAS_ASSERT(functionspace);
+    const auto& comm = mpi::comm(functionspace.mpi_comm());
+
+    auto ghost        = array::make_view<int, 1>(functionspace.ghost());
+    auto global_index = array::make_view<gidx_t, 1>(functionspace.global_index());
+
+    std::vector<idx_t> owned;
+    owned.reserve(functionspace.size());
+    for (idx_t n = 0; n < functionspace.size(); ++n) {
+        if (not ghost(n)) {
+            owned.emplace_back(n);
+        }
+    }
+
+    std::vector<size_t> counts(comm.size());
+    ATLAS_TRACE_MPI(ALLGATHER) { comm.allGather(owned.size(), counts.begin(), counts.end()); }
+    const size_t nb_points = std::accumulate(counts.begin(), counts.end(), size_t(0));
+    const size_t offset    = std::accumulate(counts.begin(), counts.begin() + comm.rank(), size_t(0));
+
+    // Items are looked up by key, so every field name must differ from each other and from "global_index"
+    std::set<std::string> keys{"global_index"};
+    std::vector<DistributedItem> items;
+    items.push_back({"global_index", ArrayMetadata(make_datatype<gidx_t>(), ArrayShape{nb_points}), sizeof(gidx_t),
+                     [&](char* out) {
+                         gidx_t* p = reinterpret_cast<gidx_t*>(out);
+                         for (size_t i = 0; i < owned.size(); ++i) {
+                             p[i] = global_index(owned[i]);
+                         }
+                     }});
+    for (const auto& field : fields) {
+        ATLAS_ASSERT(field.functionspace().get() == functionspace.get(),
+                     "All fields must be defined on the same function space");
+        ATLAS_ASSERT(field.array().contiguous());
+        ATLAS_ASSERT(keys.insert(field.name()).second,
+                     "Field name \"" + field.name() + "\" is not unique within the record, or is reserved");
+        ArrayShape shape{nb_points};
+        for (idx_t d = 1; d < field.rank(); ++d) {
+            shape.emplace_back(size_t(field.shape(d)));
+        }
+        const size_t bytes_per_point = size_t(field.stride(0)) * size_t(field.datatype().size());
+        const char* data             = static_cast<const char*>(field.array().data());
+        items.push_back({field.name(), ArrayMetadata(DataType(field.datatype().str()), shape), bytes_per_point,
+                         [&owned, data, bytes_per_point](char* out) {
+                             for (size_t i = 0; i < owned.size(); ++i) {
+                                 ::memcpy(out + i * bytes_per_point, data + size_t(owned[i]) * bytes_per_point,
+                                          bytes_per_point);
+                             }
+                         }});
+    }
+
+    std::vector<long> partitions(counts.begin(), counts.end());
+
+    // Task 0 creates the file and writes everything but the data
+    std::vector<size_t> layout(items.size() + 1);  // data offsets, followed by record length
+    if (comm.rank() == 0) {
+        ATLAS_TRACE("write record layout");
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            throw_CantOpenFile(path, Here());
+        }
+        size_t record_length;
+        auto data_offsets = write_record_layout(fd, items, partitions, path, record_length);
+        ::close(fd);
+        std::copy(data_offsets.begin(), data_offsets.end(), layout.begin());
+        layout.back() = record_length;
+    }
+    ATLAS_TRACE_MPI(BROADCAST) { comm.broadcast(layout, 0); }
+
+    // Every task writes its owned points at its offset within each data section
+    {
+        ATLAS_TRACE("write owned data");
+        int fd = ::open(path.c_str(), O_WRONLY);
+        if (fd < 0) {
+            throw_CantOpenFile(path, Here());
+        }
+        std::vector<char> buffer;
+        for (size_t i = 0; i < items.size(); ++i) {
+            buffer.resize(owned.size() * items[i].bytes_per_point);
+            items[i].pack(buffer.data());
+            pwrite_all(fd, buffer.data(), buffer.size(), layout[i] + offset * items[i].bytes_per_point, path);
+        }
+        ::close(fd);
+    }
+    ATLAS_TRACE_MPI(BARRIER) { comm.barrier(); }
+    return layout.back();
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+size_t write_distributed(const Field& field, const std::string& path) {
+    FieldSet fields;
+    fields.add(field);
+    return write_distributed(fields, path);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+Field read_global(const std::string& path, const std::string& name) {
+    ATLAS_TRACE("atlas::io::read_global(" + path + ")");
+
+    Metadata metadata;
+    RecordItemReader{"file:" + path + "?key=" + name}.read(metadata);
+    ArrayMetadata array_metadata(metadata);
+
+    array::ArrayShape shape;
+    for (auto& s : array_metadata.shape()) {
+        shape.emplace_back(static_cast<idx_t>(s));
+    }
+    Field stored(name, array::DataType(array_metadata.datatype().str()), shape);
+    std::vector<gidx_t> global_index;
+
+    RecordReader reader(path);
+    reader.read(name, stored.array());
+    reader.read("global_index", global_index);
+    reader.wait();
+
+    ATLAS_ASSERT(global_index.size() == size_t(stored.shape(0)));
+    Field field(name, stored.datatype(), shape);
+    const size_t bytes_per_point = size_t(stored.stride(0)) * size_t(stored.datatype().size());
+    const char* in               = static_cast<const char*>(stored.array().data());
+    char* out                    = static_cast<char*>(field.array().data());
+    for (size_t i = 0; i < global_index.size(); ++i) {
+        size_t n = size_t(global_index[i] - 1);
+        ATLAS_ASSERT(n < global_index.size(), "global_index is not contiguous from 1");
+        ::memcpy(out + n * bytes_per_point, in + i * bytes_per_point, bytes_per_point);
+    }
+    return field;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,52 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Write distributed fields to a single record, without gathering them to one MPI task.
+///
+/// Every MPI task writes the values of its owned (non-ghost) points directly into the shared file, at offsets
+/// computed from the owned point counts of all tasks. Only MPI task 0 writes the record head, metadata and index.
+/// The file must be accessible by all tasks, e.g. on a shared or parallel filesystem.
+///
+/// The record contains, next to one item per field named after the field:
+///   - "global_index": global index of each written point. The metadata entry "partitions" lists the number of
+///                     points written by each MPI task.
+/// Points are stored partition after partition, rather than in global order. Each field item carries the entry
+/// "ordering: global_index". Use read_global() to restore the global order.
+///
+/// Data is written uncompressed, and without checksums, as no single task holds the complete data.
+/// All fields must be defined on the same function space, and have unique names other than "global_index".
+/// This is a collective operation.
+///
+/// @return length of the written record in bytes
+size_t write_distributed(const FieldSet&, const std::string& path);
+
+/// @brief Write a distributed field to a single record, see write_distributed(const FieldSet&, ...)
+size_t write_distributed(const Field&, const std::string& path);
+
+/// @brief Read a field from a record written by write_distributed(), reordered by global index.
+/// The returned Field is not distributed; it has a first dimension equal to the number of global points.
+Field read_global(const std::string& path, const std::string& name);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,57 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "MappedField.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "atlas/array/Array.h"
+#include "atlas/field/detail/FieldImpl.h"
+#include "atlas/io/atlas-io.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+Field map_field(const std::string& uri, const std::string& name, bool copy_on_write) {
+    ATLAS_TRACE("atlas::io::map_field(" + uri + ")");
+    RecordItemReader reader(uri);
+
+    Metadata metadata;
+    auto data = std::make_shared<Data>();
+    reader.map(metadata, *data, copy_on_write ? MemoryMap::Access::copy_on_write : MemoryMap::Access::read_only);
+
+    ArrayMetadata array_metadata(metadata);
+    const bool aligned = reinterpret_cast<std::uintptr_t>(data->data()) % array_metadata.datatype().size() == 0;
+
+    if (data->external() && aligned) {
+        Field field(name, array::wrap(metadata, *data));
+        // Keep the mapping alive for as long as the field exists
+        field.get()->callbackOnDestruction([data]() {});
+        return field;
+    }
+
+    data->decompress(metadata.data.compression(), metadata.data.size(), metadata.data.chunk_size());
+    array::ArrayShape shape;
+    for (auto& s : array_metadata.shape()) {
+        shape.emplace_back(static_cast<idx_t>(s));
+    }
+    Field field(name, array::DataType(array_metadata.datatype().str()), shape);
+    array::decode(metadata, *data, field.array());
+    return field;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
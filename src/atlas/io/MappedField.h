@@ -0,0 +1,38 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "atlas/field/Field.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Create a Field from an array record item, referencing the file contents directly via a memory mapping.
+///
+/// When the item is uncompressed and its data is aligned (see RecordWriter::alignment()), no data is read or copied:
+/// pages are loaded on first access, and the mapping lives as long as the Field.
+/// Otherwise the item is read, decompressed and copied into the Field as usual.
+/// No checksum verification is performed, as that would require reading all data up front.
+///
+/// @param uri            record item URI, e.g. "file:record.atlas?key=field"
+/// @param name           name of the returned Field
+/// @param copy_on_write  if false, the mapped Field is read-only and must not be modified.
+///                       If true, the Field may be modified in memory without affecting the file.
+Field map_field(const std::string& uri, const std::string& name = "", bool copy_on_write = false);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,444 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "MeshRecord.h"
+
+#include <cstdio>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+#include "eckit/log/JSON.h"
+#include "eckit/utils/MD5.h"
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/grid/Distribution.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/io/atlas-io.h"
+#include "atlas/library/config.h"
+#include "atlas/library/git_sha1.h"
+#include "atlas/library/version.h"
+#include "atlas/mesh/ElementType.h"
+#include "atlas/mesh/Elements.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildHalo.h"
+#include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
+#include "atlas/meshgenerator/MeshGenerator.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/projection/Projection.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+constexpr int format_version = 1;
+
+using Buffers = std::map<std::string, std::vector<idx_t>>;
+
+std::string to_json(const eckit::Configuration& config) {
+    std::stringstream s;
+    eckit::JSON json(s);
+    json.precision(17);
+    json << util::Config(config);
+    return s.str();
+}
+
+util::Config from_json(const std::string& json) {
+    std::istringstream s(json);
+    return util::Config(s, "json");
+}
+
+// Mesh actions applied to a generated mesh before it is cached
+struct Setup {
+    Setup(const eckit::Configuration& config) {
+        config.get("halo", halo);
+        config.get("edges", edges);
+    }
+
+    void apply(Mesh& mesh) const {
+        ATLAS_TRACE("setup");
+        mesh::actions::build_nodes_parallel_fields(mesh);
+        mesh::actions::build_periodic_boundaries(mesh);
+        if (halo > 0) {
+            mesh::actions::build_halo(mesh, halo);
+        }
+        if (edges) {
+            mesh::actions::build_edges(mesh);
+            mesh::actions::build_edges_parallel_fields(mesh);
+        }
+    }
+
+    util::Config config() const { return util::Config("halo", halo) | util::Config("edges", edges); }
+
+    int halo{0};
+    bool edges{false};
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// Encoding. Connectivity values are stored with base 0; missing values are stored as missing_value()
+
+template <typename Container>
+std::vector<util::Config> encode_fields(const Container& container, const std::string& prefix, RecordWriter& record) {
+    std::vector<util::Config> fields;
+    for (idx_t i = 0; i < container.nb_fields(); ++i) {
+        const Field& field = container.field(i);
+        ATLAS_ASSERT(field.array().contiguous());
+        util::Config config;
+        config.set("name", field.name());
+        config.set("datatype", field.datatype().str());
+        config.set("shape", std::vector<idx_t>(field.shape().begin(), field.shape().end()));
+        config.set("metadata", field.metadata());
+        fields.emplace_back(config);
+        record.set(prefix + "." + field.name(), field.array());
+    }
+    return fields;
+}
+
+util::Config encode_connectivity(const mesh::IrregularConnectivity& connectivity, const std::string& key,
+                                 RecordWriter& record) {
+    std::vector<idx_t> counts(connectivity.rows());
+    std::vector<idx_t> values;
+    values.reserve(connectivity.size());
+    for (idx_t r = 0; r < connectivity.rows(); ++r) {
+        counts[r] = connectivity.cols(r);
+        for (idx_t c = 0; c < connectivity.cols(r); ++c) {
+            values.emplace_back(connectivity(r, c));
+        }
+    }
+    util::Config config;
+    config.set("rows", connectivity.rows());
+    config.set("size", static_cast<long>(values.size()));
+    if (not counts.empty()) {
+        record.set(key + ".counts", io::copy(std::move(counts)));
+    }
+    if (not values.empty()) {
+        record.set(key, io::copy(std::move(values)));
+    }
+    return config;
+}
+
+util::Config encode_connectivity(const mesh::MultiBlockConnectivity& connectivity, const std::string& key,
+                                 RecordWriter& record) {
+    std::vector<idx_t> rows(connectivity.blocks());
+    std::vector<idx_t> cols(connectivity.blocks());
+    std::vector<idx_t> values;
+    values.reserve(connectivity.size());
+    idx_t nb_rows = 0;
+    for (idx_t b = 0; b < connectivity.blocks(); ++b) {
+        const auto& block = connectivity.block(b);
+        rows[b]           = block.rows();
+        cols[b]           = block.cols();
+        for (idx_t r = 0; r < block.rows(); ++r) {
+            for (idx_t c = 0; c < block.cols(); ++c) {
+                values.emplace_back(block(r, c));
+            }
+        }
+        nb_rows += block.rows();
+    }
+    ATLAS_ASSERT(nb_rows == connectivity.rows(), "Connectivity " + connectivity.name() + " has rows outside blocks");
+    util::Config config;
+    config.set("rows", rows);
+    config.set("cols", cols);
+    config.set("size", static_cast<long>(values.size()));
+    if (not values.empty()) {
+        record.set(key, io::copy(std::move(values)));
+    }
+    return config;
+}
+
+util::Config encode_nodes(const mesh::Nodes& nodes, RecordWriter& record) {
+    util::Config config;
+    config.set("size", nodes.size());
+    config.set("metadata", nodes.metadata());
+    config.set("fields", encode_fields(nodes, "nodes", record));
+    config.set("edge_connectivity", encode_connectivity(nodes.edge_connectivity(), "nodes.edge_connectivity", record));
+    config.set("cell_connectivity", encode_connectivity(nodes.cell_connectivity(), "nodes.cell_connectivity", record));
+    return config;
+}
+
+util::Config encode_elements(const mesh::HybridElements& elements, const std::string& prefix, RecordWriter& record) {
+    ATLAS_ASSERT(elements.node_connectivity().blocks() == elements.nb_types());
+    std::vector<std::string> types;
+    std::vector<idx_t> sizes;
+    for (idx_t t = 0; t < elements.nb_types(); ++t) {
+        types.emplace_back(elements.element_type(t).name());
+        sizes.emplace_back(elements.elements(t).size());
+    }
+    util::Config config;
+    config.set("size", elements.size());
+    config.set("types", types);
+    config.set("elements", sizes);
+    config.set("metadata", elements.metadata());
+    config.set("fields", encode_fields(elements, prefix, record));
+    config.set("node_connectivity",
+               encode_connectivity(elements.node_connectivity(), prefix + ".node_connectivity", record));
+    config.set("edge_connectivity",
+               encode_connectivity(elements.edge_connectivity(), prefix + ".edge_connectivity", record));
+    config.set("cell_connectivity",
+               encode_connectivity(elements.cell_connectivity(), prefix + ".cell_connectivity", record));
+    return config;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Decoding
+
+template <typename Container>
+void decode_fields(const util::Config& config, const std::string& prefix, Container& container,
+                   RecordReader& reader) {
+    std::vector<util::Config> fields;
+    config.get("fields", fields);
+    for (const auto& f : fields) {
+        const std::string name = f.getString("name");
+        Field field;
+        if (container.has_field(name)) {
+            field = container.field(name);
+        }
+        else {
+            std::vector<idx_t> shape;
+            f.get("shape", shape);
+            field = container.add(Field(name, array::DataType(f.getString("datatype")), array::ArrayShape(shape)));
+        }
+        field.metadata().set(f.getSubConfiguration("metadata"));
+        reader.read(prefix + "." + name, field.array());
+    }
+}
+
+void read_connectivity(const util::Config& config, const std::string& key, RecordReader& reader, Buffers& buffers) {
+    if (config.getLong("size") > 0) {
+        reader.read(key, buffers[key]);
+    }
+}
+
+template <typename Connectivity>
+void fill_connectivity(Connectivity& connectivity, const std::vector<idx_t>& values) {
+    size_t offset = 0;
+    for (idx_t r = 0; r < connectivity.rows(); ++r) {
+        ATLAS_ASSERT(offset + connectivity.cols(r) <= values.size());
+        connectivity.set(r, values.data() + offset);
+        offset += connectivity.cols(r);
+    }
+    ATLAS_ASSERT(offset == values.size());
+}
+
+void decode_connectivity(const util::Config& config, const std::string& key, Buffers& buffers,
+                         mesh::IrregularConnectivity& connectivity) {
+    connectivity.clear();
+    const idx_t rows = config.getInt("rows");
+    if (rows > 0) {
+        const auto& counts = buffers[key + ".counts"];
+        ATLAS_ASSERT(counts.size() == size_t(rows));
+        connectivity.add(rows, counts.data());
+        fill_connectivity(connectivity, buffers[key]);
+    }
+}
+
+void decode_connectivity(const util::Config& config, const std::string& key, Buffers& buffers,
+                         mesh::MultiBlockConnectivity& connectivity) {
+    std::vector<idx_t> rows;
+    std::vector<idx_t> cols;
+    config.get("rows", rows);
+    config.get("cols", cols);
+    connectivity.clear();
+    for (size_t b = 0; b < rows.size(); ++b) {
+        connectivity.add(rows[b], cols[b]);
+    }
+    fill_connectivity(connectivity, buffers[key]);
+}
+
+void decode_elements(const util::Config& config, const std::string& prefix, Buffers& buffers,
+                     mesh::HybridElements& elements) {
+    std::vector<std::string> types;
+    std::vector<idx_t> sizes;
+    config.get("types", types);
+    config.get("elements", sizes);
+    ATLAS_ASSERT(elements.size() == 0);
+    for (size_t t = 0; t < types.size(); ++t) {
+        elements.add(mesh::ElementType::create(types[t]), sizes[t]);
+    }
+    ATLAS_ASSERT(elements.size() == config.getInt("size"));
+    elements.metadata().set(config.getSubConfiguration("metadata"));
+
+    fill_connectivity(elements.node_connectivity(), buffers[prefix + ".node_connectivity"]);
+    decode_connectivity(config.getSubConfiguration("edge_connectivity"), prefix + ".edge_connectivity", buffers,
+                        elements.edge_connectivity());
+    decode_connectivity(config.getSubConfiguration("cell_connectivity"), prefix + ".cell_connectivity", buffers,
+                        elements.cell_connectivity());
+}
+
+}  // namespace
+
+//---------------------------------------------------------------------------------------------------------------------
+
+class MeshRecordReader {
+public:
+    static Mesh read(const std::string& path);
+};
+
+Mesh MeshRecordReader::read(const std::string& path) {
+    RecordReader reader(path);
+
+    std::string json;
+    reader.read("mesh", json);
+    reader.wait("mesh");
+    util::Config structure = from_json(json);
+    if (structure.getInt("version") != format_version) {
+        throw_Exception("Mesh record " + path + " has unsupported format version", Here());
+    }
+    util::Config nodes_config = structure.getSubConfiguration("nodes");
+    util::Config cells_config = structure.getSubConfiguration("cells");
+    util::Config edges_config = structure.getSubConfiguration("edges");
+
+    // Connectivities are needed before fields can be read into the resized nodes and elements
+    Buffers buffers;
+    for (const std::string connectivity : {"edge_connectivity", "cell_connectivity"}) {
+        util::Config config = nodes_config.getSubConfiguration(connectivity);
+        read_connectivity(config, "nodes." + connectivity, reader, buffers);
+        if (config.getInt("rows") > 0) {
+            reader.read("nodes." + connectivity + ".counts", buffers["nodes." + connectivity + ".counts"]);
+        }
+    }
+    for (const std::string elements : {"cells", "edges"}) {
+        util::Config config = structure.getSubConfiguration(elements);
+        for (const std::string connectivity : {"node_connectivity", "edge_connectivity", "cell_connectivity"}) {
+            read_connectivity(config.getSubConfiguration(connectivity), elements + "." + connectivity, reader, buffers);
+        }
+    }
+    reader.wait();
+
+    Mesh mesh;
+    mesh.setProjection(Projection(structure.getSubConfiguration("projection")));
+    if (structure.has("grid")) {
+        mesh.setGrid(Grid(util::Config(structure.getSubConfiguration("grid"))));
+    }
+    mesh.metadata().set(structure.getSubConfiguration("metadata"));
+
+    auto& nodes = mesh.nodes();
+    nodes.resize(nodes_config.getInt("size"));
+    nodes.metadata().set(nodes_config.getSubConfiguration("metadata"));
+    decode_connectivity(nodes_config.getSubConfiguration("edge_connectivity"), "nodes.edge_connectivity", buffers,
+                        nodes.edge_connectivity());
+    decode_connectivity(nodes_config.getSubConfiguration("cell_connectivity"), "nodes.cell_connectivity", buffers,
+                        nodes.cell_connectivity());
+    decode_elements(cells_config, "cells", buffers, mesh.cells());
+    decode_elements(edges_config, "edges", buffers, mesh.edges());
+
+    decode_fields(nodes_config, "nodes", nodes, reader);
+    decode_fields(cells_config, "cells", mesh.cells(), reader);
+    decode_fields(edges_config, "edges", mesh.edges(), reader);
+    reader.wait();
+
+    return mesh;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+size_t write_mesh(const Mesh& mesh, const std::string& path) {
+    ATLAS_TRACE("atlas::io::write_mesh(" + path + ")");
+    RecordWriter record;
+
+    util::Config structure;
+    structure.set("version", format_version);
+    structure.set("metadata", mesh.metadata());
+    structure.set("projection", mesh.projection().spec());
+    if (mesh.grid()) {
+        structure.set("grid", mesh.grid().spec());
+    }
+    structure.set("nodes", encode_nodes(mesh.nodes(), record));
+    structure.set("cells", encode_elements(mesh.cells(), "cells", record));
+    structure.set("edges", encode_elements(mesh.edges(), "edges", record));
+    record.set("mesh", to_json(structure));
+
+    return record.write(path);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+Mesh read_mesh(const std::string& path) {
+    ATLAS_TRACE("atlas::io::read_mesh(" + path + ")");
+    return MeshRecordReader::read(path);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+MeshCache::MeshCache(const std::string& directory): directory_(directory) {}
+
+std::string MeshCache::key(const Grid& grid, const MeshGenerator& meshgenerator,
+                           const grid::Distribution& distribution, const eckit::Configuration& setup) const {
+    eckit::MD5 hash;
+    hash.add("atlas::io::MeshCache");
+    hash.add(std::to_string(format_version));
+
+    // Records are only valid for the atlas build that wrote them: index types and connectivity base are stored as is
+    hash.add(library::version());
+    hash.add(library::git_sha1(40));
+    hash.add(std::to_string(sizeof(idx_t)));
+    hash.add(std::to_string(sizeof(gidx_t)));
+    hash.add(std::to_string(ATLAS_HAVE_FORTRAN));
+
+    grid.hash(hash);
+    meshgenerator.hash(hash);
+    distribution.hash(hash);
+    hash.add(std::to_string(distribution.nb_partitions()));
+    hash.add(to_json(Setup(setup).config()));
+    return hash.digest();
+}
+
+std::string MeshCache::path(const std::string& key, idx_t part) const {
+    return directory_ + "/mesh-" + key + "-" + std::to_string(part) + ".atlas";
+}
+
+bool MeshCache::contains(const std::string& key, const std::string& mpi_comm) const {
+    const auto& comm = mpi::comm(mpi_comm);
+    int found        = eckit::PathName(path(key, comm.rank())).exists() ? 1 : 0;
+    ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(found, eckit::mpi::min()); }
+    return found;
+}
+
+Mesh MeshCache::generate(const Grid& grid, const MeshGenerator& meshgenerator,
+                         const grid::Distribution& distribution, const eckit::Configuration& setup) const {
+    ATLAS_TRACE("atlas::io::MeshCache::generate");
+    const auto& comm = mpi::comm(meshgenerator.mpi_comm());
+    ATLAS_ASSERT(distribution.nb_partitions() == idx_t(comm.size()));
+
+    const std::string k    = key(grid, meshgenerator, distribution, setup);
+    const std::string file = path(k, comm.rank());
+    if (contains(k, comm.name())) {
+        Log::debug() << "Reading mesh " << k << " from cache " << directory_ << std::endl;
+        return read_mesh(file);
+    }
+
+    Log::debug() << "Generating mesh " << k << " for cache " << directory_ << std::endl;
+    Mesh mesh = meshgenerator.generate(grid, distribution);
+    Setup(setup).apply(mesh);
+
+    eckit::PathName(directory_).mkdir();
+    const std::string tmp = file + ".tmp";
+    write_mesh(mesh, tmp);
+    if (std::rename(tmp.c_str(), file.c_str()) != 0) {
+        throw_Exception("Could not rename " + tmp + " to " + file, Here());
+    }
+    return mesh;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
@@ -0,0 +1,94 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "atlas/mesh/Mesh.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+class Grid;
+class MeshGenerator;
+namespace grid {
+class Distribution;
+}
+}  // namespace atlas
+
+namespace atlas {
+namespace io {
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Write the partition of a Mesh owned by this MPI task to a record.
+///
+/// The record contains everything needed to reconstruct the partition without regenerating it:
+///   - mesh, nodes, cells and edges metadata, e.g. halo sizes, "parallel" and "periodic" flags set by mesh actions
+///   - all node, cell and edge fields, e.g. global index, partition, remote index, ghost, halo, xy, lonlat
+///   - node-to-edge/cell, cell-to-node/edge/cell and edge-to-node/edge/cell connectivities
+///   - grid and projection specifications
+/// This is not a collective operation: every MPI task writes its own record.
+///
+/// @return length of the written record in bytes
+size_t write_mesh(const Mesh&, const std::string& path);
+
+/// @brief Read a Mesh partition from a record written by write_mesh().
+///
+/// Mesh actions (BuildParallelFields, BuildPeriodicBoundaries, BuildHalo, BuildEdges) recognise from the restored
+/// metadata that they have already been applied, so that function spaces can be created directly.
+Mesh read_mesh(const std::string& path);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+/// @brief Cache of generated meshes in a directory, with one record per MPI task.
+///
+/// Meshes are identified by a key: a hash of the atlas version and index types, the grid, the mesh generator
+/// configuration, the distribution and its number of partitions, and a setup configuration. The setup configuration
+/// lists the mesh actions applied after generation:
+///   - "halo"  : number of halo layers built with BuildHalo (default 0)
+///   - "edges" : build edges and their parallel fields (default false)
+///
+/// Example:
+///
+///     io::MeshCache cache("/path/to/cache");
+///     Mesh mesh = cache.generate(grid, meshgenerator, distribution, util::Config("halo", 2));
+///
+/// The first call generates the mesh and writes it to the cache; later calls with the same arguments, e.g. in a
+/// restarted run, read it back. The files of one mesh are written to a temporary path and renamed, so that a
+/// run interrupted while writing does not leave an incomplete mesh behind.
+class MeshCache {
+public:
+    explicit MeshCache(const std::string& directory);
+
+    /// @brief Key identifying a mesh in the cache
+    std::string key(const Grid&, const MeshGenerator&, const grid::Distribution&,
+                    const eckit::Configuration& setup = util::NoConfig()) const;
+
+    /// @brief Path of the record of given partition of a cached mesh
+    std::string path(const std::string& key, idx_t part) const;
+
+    /// @brief Check if all MPI tasks of given communicator have a cached record for given key.
+    /// This is a collective operation.
+    bool contains(const std::string& key, const std::string& mpi_comm) const;
+
+    /// @brief Read mesh from the cache, or generate, set up and cache it.
+    /// This is a collective operation over the MPI communicator of the mesh generator.
+    Mesh generate(const Grid&, const MeshGenerator&, const grid::Distribution&,
+                  const eckit::Configuration& setup = util::NoConfig()) const;
+
+private:
+    std::string directory_;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
+}  // namespace io
+}  // namespace atlas
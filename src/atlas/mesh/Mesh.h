@@ -53,6 +53,12 @@ class MeshGeneratorImpl;
 }
 }  // namespace atlas
 
+namespace atlas {
+namespace io {
+class MeshRecordReader;
+}
+}  // namespace atlas
+
 //----------------------------------------------------------------------------------------------------------------------
 
 namespace atlas {
@@ -148,6 +154,7 @@ private:  // methods
 
     friend class mesh::MeshBuilder;
     friend class meshgenerator::MeshGeneratorImpl;
+    friend class io::MeshRecordReader;
     void setProjection(const Projection& p) { get()->setProjection(p); }
     void setGrid(const Grid& p) { get()->setGrid(p); }
 };
@@ -34,6 +34,7 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/detail/AccumulateFacets.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/sort.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -96,7 +97,7 @@ void build_element_to_edge_connectivity(Mesh& mesh) {
             edge_sort.emplace_back(Sort(compute_uid(edge_node_connectivity.row(jedge)), jedge));
         }
 
-        std::sort(edge_sort.data(), edge_sort.data() + nb_edges);
+        omp::radix_sort(edge_sort.begin(), edge_sort.end(), [](const Sort& s) { return s.g; });
     }
 
     // Fill in cell_edge_connectivity
@@ -398,7 +399,9 @@ void build_edges(Mesh& mesh, const eckit::Configuration& config) {
                 idx_t lowest_node_idx = std::min(edge_nodes_data.at(2 * iedge + 0), edge_nodes_data.at(2 * iedge + 1));
                 sorted_edges_by_lowest_node_index.emplace_back(lowest_node_idx, e);
             }
-            std::sort(sorted_edges_by_lowest_node_index.begin(), sorted_edges_by_lowest_node_index.end());
+            // Stable sort on the lowest node index, with edges in increasing order as secondary key
+            omp::radix_sort(sorted_edges_by_lowest_node_index.begin(), sorted_edges_by_lowest_node_index.end(),
+                            [](const std::pair<idx_t, idx_t>& p) { return p.first; });
             for (idx_t e = edge_start; e < edge_end; ++e) {
                 const idx_t iedge = edge_halo_offsets[halo] + (e - edge_start);
                 const idx_t sedge =
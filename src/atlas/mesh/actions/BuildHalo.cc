@@ -63,6 +63,7 @@ namespace mesh {
 namespace actions {
 
 struct Entity {
+    Entity() = default;
     Entity(gidx_t gid, idx_t idx) {
         g = gid;
         i = idx;
@@ -160,7 +161,9 @@ void make_nodes_global_index_human_readable(const mesh::actions::BuildHalo& buil
         node_sort.emplace_back(glb_idx_gathered[jnode], jnode);
     }
 
-    ATLAS_TRACE_SCOPE("sort on rank 0") { std::sort(node_sort.begin(), node_sort.end()); }
+    ATLAS_TRACE_SCOPE("sort on rank 0") {
+        omp::radix_sort(node_sort.begin(), node_sort.end(), [](const Entity& e) { return e.g; });
+    }
 
     gidx_t gid               = glb_idx_max + 1;
     const idx_t nb_node_sort = static_cast<idx_t>(node_sort.size());
@@ -260,7 +263,9 @@ void make_cells_global_index_human_readable(const mesh::actions::BuildHalo& buil
         cell_sort.emplace_back(glb_idx_gathered[jcell], jcell);
     }
 
-    ATLAS_TRACE_SCOPE("sort on rank 0") { std::sort(cell_sort.begin(), cell_sort.end()); }
+    ATLAS_TRACE_SCOPE("sort on rank 0") {
+        omp::radix_sort(cell_sort.begin(), cell_sort.end(), [](const Entity& e) { return e.g; });
+    }
 
     gidx_t gid = glb_idx_max + 1;
     for (idx_t jcell = 0; jcell < glb_nb_cells; ++jcell) {
@@ -847,7 +852,7 @@ public:
             for (int jnode = 0; jnode < nb_nodes; ++jnode) {
                 node_uid[jnode] = compute_uid(jnode);
             }
-            std::sort(node_uid.begin(), node_uid.end());
+            omp::radix_sort(node_uid.begin(), node_uid.end());
         }
         auto node_already_exists = [&node_uid, &new_node_uid](uid_t uid) {
             std::vector<uid_t>::iterator it = std::lower_bound(node_uid.begin(), node_uid.end(), uid);
@@ -955,7 +960,7 @@ public:
                 elem_uid[jelem * 2 + 0] = -compute_uid(elem_nodes->row(jelem));
                 elem_uid[jelem * 2 + 1] = cell_gidx(jelem);
             }
-            omp::sort(elem_uid.begin(), elem_uid.end());
+            omp::radix_sort(elem_uid.begin(), elem_uid.end());
         }
         auto element_already_exists = [&elem_uid, &new_elem_uid](uid_t uid) -> bool {
             std::vector<uid_t>::iterator it = std::lower_bound(elem_uid.begin(), elem_uid.end(), uid);
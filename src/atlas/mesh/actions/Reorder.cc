@@ -8,14 +8,17 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <array>
 #include <bitset>
+#include <tuple>
 #include <utility>
 
 #include "atlas/mesh/actions/Reorder.h"
 
 // For static linking
 #include "atlas/mesh/actions/ReorderHilbert.h"
+#include "atlas/mesh/actions/ReorderMorton.h"
 #include "atlas/mesh/actions/ReorderReverseCuthillMckee.h"
 
 
@@ -27,6 +30,7 @@
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/CoordinateEnums.h"
 
 namespace atlas {
 namespace mesh {
@@ -41,6 +45,7 @@ struct force_link {
     }
     force_link() {
         load_builder<ReorderHilbert>();
+        load_builder<ReorderMorton>();
         load_builder<ReorderReverseCuthillMckee>();
     }
 };
@@ -145,13 +150,15 @@ std::string reorder_field(Field& field, const std::vector<idx_t>& order, idx_t b
 
 // ------------------------------------------------------------------
 
-void update_connectivity(mesh::HybridElements::Connectivity& connectivity, const std::vector<idx_t>& order) {
-    for (idx_t b = 0; b < connectivity.blocks(); ++b) {
-        auto& block = connectivity.block(b);
-        for (idx_t r = 0; r < block.rows(); ++r) {
-            for (idx_t c = 0; c < block.cols(); ++c) {
-                idx_t n = block(r, c);
-                block.set(r, c, order.at(n));
+// Renumber the values of a connectivity: value n becomes order_inverse[n]. Missing values are left untouched.
+template <typename Connectivity>
+void update_connectivity(Connectivity& connectivity, const std::vector<idx_t>& order_inverse) {
+    const idx_t missing_value = connectivity.missing_value();
+    for (idx_t r = 0; r < connectivity.rows(); ++r) {
+        for (idx_t c = 0; c < connectivity.cols(r); ++c) {
+            idx_t n = connectivity(r, c);
+            if (n != missing_value) {
+                connectivity.set(r, c, order_inverse.at(n));
             }
         }
     }
@@ -159,35 +166,91 @@ void update_connectivity(mesh::HybridElements::Connectivity& connectivity, const
 
 // ------------------------------------------------------------------
 
-void reorder_connectivity(BlockConnectivity& connectivity, const std::vector<idx_t>& order) {
-    ATLAS_ASSERT(connectivity.rows() == static_cast<idx_t>(order.size()));
-    BlockConnectivity tmp;
-    tmp.add(connectivity.rows(), connectivity.cols(), connectivity.data(), true);
-    for (idx_t r = 0; r < connectivity.rows(); ++r) {
-        for (idx_t c = 0; c < connectivity.cols(); ++c) {
-            if (connectivity(r, c) != tmp(r, c)) {
-                ATLAS_DEBUG_VAR(r);
-                ATLAS_DEBUG_VAR(c);
-                ATLAS_DEBUG_VAR(connectivity(r, c));
-                ATLAS_DEBUG_VAR(tmp(r, c));
-            }
-            ATLAS_ASSERT(connectivity(r, c) == tmp(r, c));
-            connectivity.set(r, c, tmp(order.at(r), c));
+// Copy the rows of a connectivity in a compact layout, with displs of size rows+1
+void copy_rows(const mesh::IrregularConnectivityImpl& connectivity, std::vector<idx_t>& values,
+               std::vector<idx_t>& displs) {
+    const idx_t rows = connectivity.rows();
+    displs.assign(rows + 1, 0);
+    values.clear();
+    values.reserve(connectivity.size());
+    for (idx_t r = 0; r < rows; ++r) {
+        displs[r + 1] = displs[r] + connectivity.cols(r);
+        for (idx_t c = 0; c < connectivity.cols(r); ++c) {
+            values.emplace_back(connectivity(r, c));
         }
     }
 }
 
 // ------------------------------------------------------------------
 
-void ReorderImpl::reorderNodes(Mesh& mesh, const std::vector<idx_t>& order) {
+// Reorder the rows of a connectivity: row r becomes the former row order[r].
+// Rows may have any number of columns, the connectivity is rebuilt.
+void reorder_connectivity(mesh::IrregularConnectivity& connectivity, const std::vector<idx_t>& order) {
+    const idx_t rows = connectivity.rows();
+    if (rows == 0) {
+        return;
+    }
+    ATLAS_ASSERT(rows == static_cast<idx_t>(order.size()));
+    std::vector<idx_t> values;
+    std::vector<idx_t> displs;
+    copy_rows(connectivity, values, displs);
+
+    std::vector<idx_t> cols(rows);
+    for (idx_t r = 0; r < rows; ++r) {
+        cols[r] = displs[order[r] + 1] - displs[order[r]];
+    }
+    connectivity.clear();
+    connectivity.add(rows, cols.data());
+    for (idx_t r = 0; r < rows; ++r) {
+        for (idx_t c = 0; c < cols[r]; ++c) {
+            connectivity.set(r, c, values[displs[order[r]] + c]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------
+
+// Reorder the rows of an element connectivity in place: row r becomes the former row order[r].
+// Rows r and order[r] must have the same number of columns, as is the case within an element type.
+void reorder_connectivity(mesh::HybridElements::Connectivity& connectivity, const std::vector<idx_t>& order) {
+    const idx_t rows = connectivity.rows();
+    if (rows == 0) {
+        return;
+    }
+    ATLAS_ASSERT(rows == static_cast<idx_t>(order.size()));
+    std::vector<idx_t> values;
+    std::vector<idx_t> displs;
+    copy_rows(connectivity, values, displs);
+
+    for (idx_t r = 0; r < rows; ++r) {
+        const idx_t cols = connectivity.cols(r);
+        ATLAS_ASSERT(cols == displs[order[r] + 1] - displs[order[r]]);
+        for (idx_t c = 0; c < cols; ++c) {
+            connectivity.set(r, c, values[displs[order[r]] + c]);
+        }
+    }
+}
+
+// ------------------------------------------------------------------
+
+std::vector<idx_t> inverse(const std::vector<idx_t>& order) {
     std::vector<idx_t> order_inverse(order.size());
     for (idx_t i = 0; i < static_cast<idx_t>(order.size()); ++i) {
         order_inverse[order[i]] = i;
     }
+    return order_inverse;
+}
+
+// ------------------------------------------------------------------
+
+void ReorderImpl::reorderNodes(Mesh& mesh, const std::vector<idx_t>& order) {
+    std::vector<idx_t> order_inverse = inverse(order);
 
     for (idx_t ifield = 0; ifield < mesh.nodes().nb_fields(); ++ifield) {
         reorder_field(mesh.nodes().field(ifield), order);
     }
+    reorder_connectivity(mesh.nodes().edge_connectivity(), order);
+    reorder_connectivity(mesh.nodes().cell_connectivity(), order);
 
     if (mesh.cells().size()) {
         update_connectivity(mesh.cells().node_connectivity(), order_inverse);
@@ -199,14 +262,60 @@ void ReorderImpl::reorderNodes(Mesh& mesh, const std::vector<idx_t>& order) {
 
 // ------------------------------------------------------------------
 
-void reorder_elements_using_nodes(Mesh& mesh, Mesh::HybridElements& elements) {
+// Reorder elements, and their fields and connectivities. The order must map each element type onto itself.
+void reorder_elements(HybridElements& elements, const std::vector<idx_t>& order) {
+    ATLAS_ASSERT(elements.size() == static_cast<idx_t>(order.size()));
+    for (idx_t t = 0; t < elements.nb_types(); ++t) {
+        const auto& elems = elements.elements(t);
+        const idx_t begin = elems.begin();
+        const idx_t end   = elems.end();
+        std::vector<idx_t> type_order(end - begin);
+        for (idx_t e = begin; e < end; ++e) {
+            ATLAS_ASSERT(order[e] >= begin && order[e] < end, "Elements can only be reordered within their type");
+            type_order[e - begin] = order[e] - begin;
+        }
+        for (idx_t ifield = 0; ifield < elements.nb_fields(); ++ifield) {
+            reorder_field(elements.field(ifield), type_order, begin, end);
+        }
+    }
+    reorder_connectivity(elements.node_connectivity(), order);
+    reorder_connectivity(elements.edge_connectivity(), order);
+    reorder_connectivity(elements.cell_connectivity(), order);
+}
+
+// ------------------------------------------------------------------
+
+void ReorderImpl::reorderCells(Mesh& mesh, const std::vector<idx_t>& order) {
+    reorder_elements(mesh.cells(), order);
+
+    std::vector<idx_t> order_inverse = inverse(order);
+    update_connectivity(mesh.cells().cell_connectivity(), order_inverse);
+    update_connectivity(mesh.edges().cell_connectivity(), order_inverse);
+    update_connectivity(mesh.nodes().cell_connectivity(), order_inverse);
+}
+
+// ------------------------------------------------------------------
+
+void ReorderImpl::reorderEdges(Mesh& mesh, const std::vector<idx_t>& order) {
+    reorder_elements(mesh.edges(), order);
+
+    std::vector<idx_t> order_inverse = inverse(order);
+    update_connectivity(mesh.edges().edge_connectivity(), order_inverse);
+    update_connectivity(mesh.cells().edge_connectivity(), order_inverse);
+    update_connectivity(mesh.nodes().edge_connectivity(), order_inverse);
+}
+
+// ------------------------------------------------------------------
+
+std::vector<idx_t> order_elements_using_nodes(const HybridElements& elements) {
+    std::vector<idx_t> order(elements.size());
     for (idx_t t = 0; t < elements.nb_types(); ++t) {
-        auto& elems        = elements.elements(t);
-        auto& connectivity = elems.node_connectivity();
-        idx_t nb_nodes     = elems.nb_nodes();
-        idx_t nb_elems     = elems.size();
+        const auto& elems        = elements.elements(t);
+        const auto& connectivity = elems.node_connectivity();
+        idx_t nb_nodes           = elems.nb_nodes();
+        idx_t nb_elems           = elems.size();
         std::vector<std::pair<idx_t, idx_t>> node_lowest_index;
-        node_lowest_index.reserve(elems.size());
+        node_lowest_index.reserve(nb_elems);
         for (idx_t e = 0; e < nb_elems; ++e) {
             idx_t lowest = std::numeric_limits<idx_t>::max();
             for (idx_t n = 0; n < nb_nodes; ++n) {
@@ -215,29 +324,61 @@ void reorder_elements_using_nodes(Mesh& mesh, Mesh::HybridElements& elements) {
             node_lowest_index.emplace_back(lowest, e);
         }
         std::sort(node_lowest_index.begin(), node_lowest_index.end());
-        std::vector<idx_t> order;
-        order.reserve(nb_elems);
-        for (const auto& pair : node_lowest_index) {
-            order.emplace_back(pair.second);
-        }
-        for (idx_t ifield = 0; ifield < mesh.edges().nb_fields(); ++ifield) {
-            reorder_field(elements.field(ifield), order, elems.begin(), elems.end());
+        for (idx_t e = 0; e < nb_elems; ++e) {
+            order[elems.begin() + e] = elems.begin() + node_lowest_index[e].second;
         }
-
-        reorder_connectivity(elems.node_connectivity(), order);
     }
+    return order;
 }
 
 // ------------------------------------------------------------------
 
 void ReorderImpl::reorderCellsUsingNodes(Mesh& mesh) {
-    reorder_elements_using_nodes(mesh, mesh.cells());
+    reorderCells(mesh, order_elements_using_nodes(mesh.cells()));
 }
 
 // ------------------------------------------------------------------
 
 void ReorderImpl::reorderEdgesUsingNodes(Mesh& mesh) {
-    reorder_elements_using_nodes(mesh, mesh.edges());
+    reorderEdges(mesh, order_elements_using_nodes(mesh.edges()));
+}
+
+// ------------------------------------------------------------------
+
+std::vector<idx_t> ReorderImpl::computeElementsOrder(const Mesh& mesh, const HybridElements& elements,
+                                                     const std::function<gidx_t(double, double)>& key,
+                                                     bool ghost_at_end) {
+    const auto xy   = array::make_view<double, 2>(mesh.nodes().xy());
+    const auto halo = array::make_view<int, 1>(elements.halo());
+
+    std::vector<idx_t> order(elements.size());
+    for (idx_t t = 0; t < elements.nb_types(); ++t) {
+        const auto& elems        = elements.elements(t);
+        const auto& connectivity = elems.node_connectivity();
+        const idx_t nb_nodes     = elems.nb_nodes();
+        const idx_t nb_elems     = elems.size();
+
+        // (ghost, key, element)
+        std::vector<std::tuple<int, gidx_t, idx_t>> keys;
+        keys.reserve(nb_elems);
+        for (idx_t e = 0; e < nb_elems; ++e) {
+            double x = 0.;
+            double y = 0.;
+            for (idx_t n = 0; n < nb_nodes; ++n) {
+                x += xy(connectivity(e, n), XX);
+                y += xy(connectivity(e, n), YY);
+            }
+            x /= double(nb_nodes);
+            y /= double(nb_nodes);
+            const int ghost = (ghost_at_end && halo(elems.begin() + e)) ? 1 : 0;
+            keys.emplace_back(ghost, key(x, y), e);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (idx_t e = 0; e < nb_elems; ++e) {
+            order[elems.begin() + e] = elems.begin() + std::get<2>(keys[e]);
+        }
+    }
+    return order;
 }
 
 // ------------------------------------------------------------------
@@ -246,8 +387,22 @@ void ReorderImpl::operator()(Mesh& mesh) {
     ATLAS_TRACE("ReorderImpl(mesh)");
 
     reorderNodes(mesh, computeNodesOrder(mesh));
-    reorderCellsUsingNodes(mesh);
-    reorderEdgesUsingNodes(mesh);
+
+    auto cells_order = computeCellsOrder(mesh);
+    if (cells_order.empty()) {
+        reorderCellsUsingNodes(mesh);
+    }
+    else {
+        reorderCells(mesh, cells_order);
+    }
+
+    auto edges_order = computeEdgesOrder(mesh);
+    if (edges_order.empty()) {
+        reorderEdgesUsingNodes(mesh);
+    }
+    else {
+        reorderEdges(mesh, edges_order);
+    }
 }
 
 // ------------------------------------------------------------------
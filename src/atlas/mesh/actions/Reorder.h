@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,8 @@ namespace atlas {
 class Mesh;
 
 namespace mesh {
+class HybridElements;
+
 namespace actions {
 
 // ------------------------------------------------------------------
@@ -35,10 +38,23 @@ public:
 public:  // -- static functions --
     /// Reorder the nodes in the given mesh using a given order
     /// - All fields in mesh.nodes() are reordered.
+    /// - mesh.nodes().edge_connectivity() and mesh.nodes().cell_connectivity() rows are reordered, if present
     /// - mesh.cells().node_connectivity() gets updated
     /// - mesh.edges().node_connectivity() gets updated
     static void reorderNodes(Mesh& mesh, const std::vector<idx_t>& order);
 
+    /// Reorder the cells in the given mesh using a given order
+    /// The order must map the range of each element type onto itself.
+    /// - All fields in mesh.cells() are reordered, as well as the rows of its connectivities
+    /// - All connectivities referring to cells get updated
+    static void reorderCells(Mesh& mesh, const std::vector<idx_t>& order);
+
+    /// Reorder the edges in the given mesh using a given order
+    /// The order must map the range of each element type onto itself.
+    /// - All fields in mesh.edges() are reordered, as well as the rows of its connectivities
+    /// - All connectivities referring to edges get updated
+    static void reorderEdges(Mesh& mesh, const std::vector<idx_t>& order);
+
     /// Reorder the cells by lowest node local index within each cell
     static void reorderCellsUsingNodes(Mesh& mesh);
 
@@ -46,11 +62,25 @@ public:  // -- static functions --
     static void reorderEdgesUsingNodes(Mesh& mesh);
 
 public:  // -- member functions --
-    /// Reorder the nodes in the given mesh using the order computed with the computeNodesOrder function
-    /// Then apply reorderCellsUsingNodes and reorderEdgesUsingNodes
+    /// Reorder the nodes in the given mesh using the order computed with the computeNodesOrder function.
+    /// Then reorder cells and edges using computeCellsOrder and computeEdgesOrder, or when these return
+    /// an empty order, using reorderCellsUsingNodes and reorderEdgesUsingNodes
     virtual void operator()(Mesh&);
 
     virtual std::vector<idx_t> computeNodesOrder(Mesh&) = 0;
+
+    /// Order of the cells, or empty to order the cells following their nodes (default)
+    virtual std::vector<idx_t> computeCellsOrder(Mesh&) { return {}; }
+
+    /// Order of the edges, or empty to order the edges following their nodes (default)
+    virtual std::vector<idx_t> computeEdgesOrder(Mesh&) { return {}; }
+
+protected:
+    /// Order the elements of each type by ascending key, computed from the element centroid (x,y).
+    /// If ghost_at_end, halo elements are placed after all other elements of the same type.
+    static std::vector<idx_t> computeElementsOrder(const Mesh&, const HybridElements&,
+                                                   const std::function<gidx_t(double x, double y)>& key,
+                                                   bool ghost_at_end);
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -245,6 +245,11 @@ gidx_t Hilbert::recursive_algorithm(const PointXY& p, const box_t& box, idx_t le
 ReorderHilbert::ReorderHilbert(const eckit::Parametrisation& config) {
     config.get("recursion", recursion_);
     config.get("ghost_at_end", ghost_at_end_);
+    config.get("elements", elements_);
+    if (elements_ != "nodes" && elements_ != "curve") {
+        throw_Exception("ReorderHilbert: \"elements\" must be \"nodes\" or \"curve\", got \"" + elements_ + "\"",
+                        Here());
+    }
 }
 
 
@@ -309,81 +314,25 @@ std::vector<idx_t> ReorderHilbert::computeNodesOrder(Mesh& mesh) {
 }
 
 
-#if 0
-// Reorder elements
-if ( 0 ) {
-    hilbert_reordering_t hilbert_reordering;
-    std::vector<idx_t> order;
-    std::vector<idx_t> order_inverse;
-
-    auto cell_centres =
-        Field( "cell_centres", array::make_datatype<double>(), array::make_shape( mesh.cells().size(), 2 ) );
-    auto nodes_xy = array::make_view<double, 2>( mesh.nodes().xy() );
-    for ( idx_t t = 0; t < mesh.cells().nb_types(); ++t ) {
-        auto& cells = mesh.cells().elements( t );
-        auto xy     = cells.view<double, 2>( cell_centres );
-        auto flags  = cells.view<int, 1>( mesh.cells().flags() );
-        auto halo   = cells.view<idx_t, 1>( mesh.cells().halo() );
-
-        // Compute cell-centres
-        {
-            const auto& node_connectivity = cells.node_connectivity();
-            const idx_t nb_nodes          = cells.nb_nodes();
-            const double nb_nodes_double  = nb_nodes;
-            for ( idx_t e = 0; e < cells.size(); ++e ) {
-                double x{0};
-                double y{0};
-                for ( idx_t c = 0; c < nb_nodes; ++c ) {
-                    idx_t n = node_connectivity( e, c );
-                    x += nodes_xy( n, XX );
-                    y += nodes_xy( n, YY );
-                }
-                xy( e, XX ) = x / nb_nodes_double;
-                xy( e, YY ) = y / nb_nodes_double;
-            }
-        }
-
-
-        auto skip = [&]( idx_t n ) {
-            if ( halo( n ) || mesh::Nodes::Topology::check( flags( n ), mesh::Nodes::Topology::PATCH ) ) {
-                return true;
-            }
-            return false;
-        };
-        idx_t size = xy.shape( 0 );
-        hilbert_reordering.clear();
-        hilbert_reordering.reserve( size );
-        ATLAS_TRACE_SCOPE( "hilbert elements[" + std::to_string( t ) + "]" ) {
-            for ( idx_t n = 0; n < size; ++n ) {
-                PointXY p{xy( n, XX ), xy( n, YY )};
-                if ( not skip( n ) ) {
-                    hilbert_reordering.emplace_back( hilbert( p ), n );
-                }
-                else {  // halo elements get a fake "hilbert_idx" at the end
-                    hilbert_reordering.emplace_back( hilbert.nb_keys() + n, n );
-                }
-            }
-        }
-        ATLAS_ASSERT( hilbert_reordering.size() == size );
-        std::sort( hilbert_reordering.begin(), hilbert_reordering.end() );
-        order.clear();
-        order.reserve( size );
-        order_inverse.resize( size );
-        idx_t c{0};
-        for ( const auto& pair : hilbert_reordering ) {
-            order.emplace_back( pair.second );
-            order_inverse[pair.second] = c++;
-            ATLAS_ASSERT( pair.second < size );
-        }
-
-        for ( idx_t ifield = 0; ifield < mesh.cells().nb_fields(); ++ifield ) {
-            reorder_field( mesh.cells().field( ifield ), order, cells.begin(), cells.end() );
-        }
+std::vector<idx_t> ReorderHilbert::computeCellsOrder(Mesh& mesh) {
+    if (elements_ == "nodes") {
+        return {};
+    }
+    ATLAS_TRACE("hilbert cells");
+    Hilbert hilbert{global_bounding_box(mesh), recursion_};
+    return computeElementsOrder(
+        mesh, mesh.cells(), [&](double x, double y) { return hilbert(PointXY{x, y}); }, ghost_at_end_);
+}
 
-        reorder_connectivity( cells.node_connectivity(), order );
+std::vector<idx_t> ReorderHilbert::computeEdgesOrder(Mesh& mesh) {
+    if (elements_ == "nodes") {
+        return {};
     }
+    ATLAS_TRACE("hilbert edges");
+    Hilbert hilbert{global_bounding_box(mesh), recursion_};
+    return computeElementsOrder(
+        mesh, mesh.edges(), [&](double x, double y) { return hilbert(PointXY{x, y}); }, ghost_at_end_);
 }
-#endif
 
 namespace {
 static ReorderBuilder<ReorderHilbert> __ReorderHilbert("hilbert");
@@ -19,7 +19,7 @@ namespace actions {
 //----------------------------------------------------------------------------------------------------------------------
 
 /// Reorder implementation that reorders nodes of a mesh following a Hilbert Space-filling curve.
-/// Cells and edges are reordered to follow lowest node index.
+/// Cells and edges are reordered to follow lowest node index, or following the same curve.
 ///
 /// Usage:
 ///     auto reorder = Reorder{ option::type("hilbert") | config };
@@ -32,15 +32,24 @@ namespace actions {
 ///
 ///    - "ghost_at_end" : <bool> (default=true) // Determines if ghost nodes should be reordered in between
 ///                                             // internal nodes or added/remain at the end
+///
+///    - "elements"     : <str>  (default="nodes") // "nodes": cells and edges follow lowest node index
+///                                               // "curve": cells and edges follow the Hilbert curve
+///                                               //          through their centroids
 class ReorderHilbert : public ReorderImpl {
 public:
     ReorderHilbert(const eckit::Parametrisation& config = util::NoConfig());
 
     std::vector<idx_t> computeNodesOrder(Mesh&) override;
 
+    std::vector<idx_t> computeCellsOrder(Mesh&) override;
+
+    std::vector<idx_t> computeEdgesOrder(Mesh&) override;
+
 private:
     idx_t recursion_{30};
     bool ghost_at_end_{true};
+    std::string elements_{"nodes"};
 };
 
 // ------------------------------------------------------------------
@@ -0,0 +1,175 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/ReorderMorton.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/CoordinateEnums.h"
+
+namespace atlas {
+namespace mesh {
+namespace actions {
+
+namespace {
+
+// -------------------------------------------------------------------------------------
+
+/// @brief Morton (Z-order) code of a coordinate in a bounding box
+///
+/// The bounding box is divided in 2^levels x 2^levels equally spaced cells. A coordinate falling in
+/// a cell gets the code obtained by interleaving the bits of the cell's column and row index.
+class Morton {
+public:
+    Morton(const std::array<double, 4>& bounding_box, idx_t levels): levels_(levels) {
+        ATLAS_ASSERT(levels_ > 0 && levels_ < 32, "Morton: recursion must be in range [1,31]");
+        xmin_           = bounding_box[0];
+        ymin_           = bounding_box[2];
+        const double nx = std::max(bounding_box[1] - xmin_, std::numeric_limits<double>::min());
+        const double ny = std::max(bounding_box[3] - ymin_, std::numeric_limits<double>::min());
+        max_            = (std::uint64_t(1) << levels_) - 1;
+        xscale_         = double(max_) / nx;
+        yscale_         = double(max_) / ny;
+    }
+
+    gidx_t operator()(double x, double y) const {
+        return static_cast<gidx_t>(spread(cell(x, xmin_, xscale_)) | (spread(cell(y, ymin_, yscale_)) << 1));
+    }
+
+    /// Return the maximum morton code possible with the initialized levels
+    gidx_t nb_keys() const { return gidx_t(1) << (2 * levels_); }
+
+private:
+    std::uint64_t cell(double v, double vmin, double scale) const {
+        const double c = (v - vmin) * scale;
+        return c <= 0. ? 0 : std::min(static_cast<std::uint64_t>(c), max_);
+    }
+
+    // Spread the lower 32 bits of v to the even bit positions
+    static std::uint64_t spread(std::uint64_t v) {
+        v &= 0xFFFFFFFFull;
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    }
+
+    idx_t levels_;
+    std::uint64_t max_;
+    double xmin_;
+    double ymin_;
+    double xscale_;
+    double yscale_;
+};
+
+// -------------------------------------------------------------------------------------
+
+/// Global bounding box {xmin, xmax, ymin, ymax} of the mesh nodes, with a single collective
+std::array<double, 4> bounding_box(const Mesh& mesh) {
+    auto xy = array::make_view<double, 2>(mesh.nodes().xy());
+
+    // minimum of {xmin, -xmax, ymin, -ymax}
+    std::array<double, 4> bbox;
+    bbox.fill(std::numeric_limits<double>::max());
+    for (idx_t i = 0; i < xy.shape(0); ++i) {
+        bbox[0] = std::min(bbox[0], xy(i, XX));
+        bbox[1] = std::min(bbox[1], -xy(i, XX));
+        bbox[2] = std::min(bbox[2], xy(i, YY));
+        bbox[3] = std::min(bbox[3], -xy(i, YY));
+    }
+    atlas::mpi::comm().allReduceInPlace(bbox.data(), bbox.size(), eckit::mpi::min());
+    bbox[1] = -bbox[1];
+    bbox[3] = -bbox[3];
+    return bbox;
+}
+
+}  // namespace
+
+// ------------------------------------------------------------------
+
+ReorderMorton::ReorderMorton(const eckit::Parametrisation& config) {
+    config.get("recursion", recursion_);
+    config.get("ghost_at_end", ghost_at_end_);
+    config.get("elements", elements_);
+    if (elements_ != "nodes" && elements_ != "curve") {
+        throw_Exception("ReorderMorton: \"elements\" must be \"nodes\" or \"curve\", got \"" + elements_ + "\"",
+                        Here());
+    }
+}
+
+std::vector<idx_t> ReorderMorton::computeNodesOrder(Mesh& mesh) {
+    ATLAS_TRACE("morton nodes");
+    const Morton morton{bounding_box(mesh), recursion_};
+
+    auto xy    = array::make_view<double, 2>(mesh.nodes().xy());
+    auto ghost = array::make_view<int, 1>(mesh.nodes().ghost());
+
+    const idx_t size = xy.shape(0);
+    std::vector<std::pair<gidx_t, idx_t>> morton_reordering;
+    morton_reordering.reserve(size);
+    for (idx_t n = 0; n < size; ++n) {
+        if (ghost(n) && ghost_at_end_) {
+            // ghost nodes get a fake "morton_idx" at the end
+            morton_reordering.emplace_back(morton.nb_keys() + n, n);
+        }
+        else {
+            morton_reordering.emplace_back(morton(xy(n, XX), xy(n, YY)), n);
+        }
+    }
+
+    std::sort(morton_reordering.begin(), morton_reordering.end());
+    std::vector<idx_t> order;
+    order.reserve(size);
+    for (const auto& pair : morton_reordering) {
+        order.emplace_back(pair.second);
+    }
+    return order;
+}
+
+std::vector<idx_t> ReorderMorton::computeCellsOrder(Mesh& mesh) {
+    if (elements_ == "nodes") {
+        return {};
+    }
+    ATLAS_TRACE("morton cells");
+    const Morton morton{bounding_box(mesh), recursion_};
+    return computeElementsOrder(mesh, mesh.cells(), morton, ghost_at_end_);
+}
+
+std::vector<idx_t> ReorderMorton::computeEdgesOrder(Mesh& mesh) {
+    if (elements_ == "nodes") {
+        return {};
+    }
+    ATLAS_TRACE("morton edges");
+    const Morton morton{bounding_box(mesh), recursion_};
+    return computeElementsOrder(mesh, mesh.edges(), morton, ghost_at_end_);
+}
+
+namespace {
+static ReorderBuilder<ReorderMorton> __ReorderMorton("morton");
+}  // namespace
+
+// ------------------------------------------------------------------
+
+}  // namespace actions
+}  // namespace mesh
+}  // namespace atlas
@@ -65,6 +65,10 @@ std::string MeshGenerator::type() const {
     return get()->type();
 }
 
+std::string MeshGenerator::mpi_comm() const {
+    return get()->mpi_comm();
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 
 }  // namespace atlas
@@ -61,6 +61,8 @@ public:
     Mesh operator()(const Grid&) const;
 
     std::string type() const;
+
+    std::string mpi_comm() const;
 };
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -32,6 +32,8 @@ public:
 
     std::string type() const override { return "delaunay"; }
 
+    std::string mpi_comm() const override { return mpi_comm_; }
+
 private:  // methods
     virtual void hash(eckit::Hash&) const override;
 
@@ -33,6 +33,10 @@ MeshGeneratorImpl::MeshGeneratorImpl() = default;
 
 MeshGeneratorImpl::~MeshGeneratorImpl() = default;
 
+std::string MeshGeneratorImpl::mpi_comm() const {
+    return mpi::comm().name();
+}
+
 Mesh MeshGeneratorImpl::operator()(const Grid& grid) const {
     Mesh mesh;
     generate(grid, mesh);
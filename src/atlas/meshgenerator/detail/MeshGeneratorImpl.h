@@ -57,6 +57,9 @@ public:
 
     virtual std::string type() const = 0;
 
+    /// Name of the MPI communicator of the generated meshes
+    virtual std::string mpi_comm() const;
+
 protected:
     void generateGlobalElementNumbering(Mesh& mesh) const;
     void setProjection(Mesh&, const Projection&) const;
@@ -9,13 +9,13 @@
  */
 #include <algorithm>
 #include <cmath>
+#include <exception>
 #include <iomanip>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <vector>
 
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/types/FloatCompare.h"
 #include "eckit/utils/Hash.h"
 
@@ -35,6 +35,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/StructuredMeshGenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -51,6 +52,24 @@ namespace meshgenerator {
 namespace {
 static double to_rad = M_PI / 180.;
 static double to_deg = 180. * M_1_PI;
+
+// Elements generated between latitudes jlat and jlat+1, and the range of columns they use on both latitudes
+struct RowElements {
+    idx_t nb_elems{0};
+    idx_t nquads{0};
+    idx_t ntriags{0};
+    idx_t beginN{std::numeric_limits<idx_t>::max()};
+    idx_t endN{-1};
+    idx_t beginS{std::numeric_limits<idx_t>::max()};
+    idx_t endS{-1};
+
+    void add(idx_t ipN_begin, idx_t ipN_end, idx_t ipS_begin, idx_t ipS_end) {
+        beginN = std::min(beginN, ipN_begin);
+        endN   = std::max(endN, ipN_end);
+        beginS = std::min(beginS, ipS_begin);
+        endS   = std::max(endS, ipS_end);
+    }
+};
 }  // namespace
 
 struct Region {
@@ -63,6 +82,7 @@ struct Region {
     std::vector<idx_t> lat_begin;
     std::vector<idx_t> lat_end;
     std::vector<idx_t> nb_lat_elems;
+    std::vector<idx_t> nb_lat_quads;
 };
 
 StructuredMeshGenerator::StructuredMeshGenerator(const eckit::Parametrisation& p) {
@@ -285,83 +305,38 @@ void StructuredMeshGenerator::generate_region(const StructuredGrid& rg, const gr
     region.lat_begin.resize(rg.ny(), -1);
     region.lat_end.resize(rg.ny(), -1);
     region.nb_lat_elems.resize(rg.ny(), 0);
+    region.nb_lat_quads.resize(rg.ny(), 0);
 
     idx_t lat_north = -1;
     idx_t lat_south = -1;
 
+    std::vector<idx_t> offset(rg.ny(), 0);
+
+    int n = 0;
+    for (idx_t jlat = 0; jlat < rg.ny(); ++jlat) {
+        offset.at(jlat) = n;
+        n += rg.nx(jlat);
+    }
+
+    // Latitude containing global index
+    auto latitude = [&](gidx_t index) -> idx_t {
+        return static_cast<idx_t>(std::upper_bound(offset.begin(), offset.end(), index) - offset.begin()) - 1;
+    };
+
+    // The points of this part are enumerated from the contiguous ranges of the distribution. Analytic
+    // distributions (e.g. bands) provide these directly; distributions stored as an array of partitions
+    // (e.g. equal_regions) still find them with a (threaded) scan over all points, so that step remains O(N).
+    std::vector<grid::Distribution::Range> ranges;
+    ATLAS_TRACE_SCOPE("partition ranges") { ranges = distribution.partition_ranges(mypart); }
+
     if (distribution.nb_partitions() == 1) {
         lat_north = 0;
         lat_south = rg.ny() - 1;
     }
-    else {
-        ATLAS_TRACE_SCOPE("compute bounds") {
-            // This part does not scale
-            /*
-Find min and max latitudes used by this part.
-*/
-
-            size_t num_threads = atlas_omp_get_max_threads();
-            if (num_threads == 1) {
-                int n = 0;
-                for (idx_t jlat = 0; jlat < rg.ny(); ++jlat) {
-                    for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon) {
-                        if (distribution.partition(n) == mypart) {
-                            lat_north = jlat;
-                            goto end_north;
-                        }
-                        ++n;
-                    }
-                }
-            end_north:;
-
-                n = rg.size() - 1;
-                for (idx_t jlat = rg.ny() - 1; jlat >= 0; --jlat) {
-                    for (idx_t jlon = rg.nx(jlat) - 1; jlon >= 0; --jlon) {
-                        if (distribution.partition(n) == mypart) {
-                            lat_south = jlat;
-                            goto end_south;
-                        }
-                        --n;
-                    }
-                }
-            end_south:;
-            }
-            else {
-                std::vector<idx_t> thread_reduce_lat_north(num_threads, std::numeric_limits<idx_t>::max());
-                std::vector<idx_t> thread_reduce_lat_south(num_threads, std::numeric_limits<idx_t>::min());
-
-                atlas_omp_parallel {
-                    const idx_t thread_num = atlas_omp_get_thread_num();
-                    const idx_t jbegin = static_cast<int>(size_t(thread_num) * size_t(rg.ny()) / size_t(num_threads));
-                    const idx_t jend = static_cast<int>(size_t(thread_num + 1) * size_t(rg.ny()) / size_t(num_threads));
-
-                    auto& thread_lat_north = thread_reduce_lat_north[thread_num];
-                    auto& thread_lat_south = thread_reduce_lat_south[thread_num];
-
-                    for (idx_t jlat = jbegin; jlat < jend && thread_lat_north > jend; ++jlat) {
-                        int n = rg.index(0, jlat);
-                        for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon, ++n) {
-                            if (distribution.partition(n) == mypart) {
-                                thread_lat_north = jlat;
-                                break;
-                            }
-                        }
-                    }
-
-                    for (idx_t jlat = jend - 1; jlat >= jbegin && thread_lat_south < jbegin; --jlat) {
-                        int n = rg.index(0, jlat);
-                        for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon, ++n) {
-                            if (distribution.partition(n) == mypart) {
-                                thread_lat_south = jlat;
-                                break;
-                            }
-                        }
-                    }
-                }
-                lat_north = *std::min_element(thread_reduce_lat_north.begin(), thread_reduce_lat_north.end());
-                lat_south = *std::max_element(thread_reduce_lat_south.begin(), thread_reduce_lat_south.end());
-            }
-        }
+    else if (not ranges.empty()) {
+        // Find min and max latitudes used by this part.
+        lat_north = latitude(ranges.front().first);
+        lat_south = latitude(ranges.back().second - 1);
     }
 
     if (lat_north == -1 && lat_south == -1 ) {
@@ -371,14 +346,6 @@ Find min and max latitudes used by this part.
     ATLAS_ASSERT(lat_north >= 0);
     ATLAS_ASSERT(lat_south < rg.ny() );
 
-    std::vector<idx_t> offset(rg.ny(), 0);
-
-    int n = 0;
-    for (idx_t jlat = 0; jlat < rg.ny(); ++jlat) {
-        offset.at(jlat) = n;
-        n += rg.nx(jlat);
-    }
-
     /*
 We need to connect to next region
 */
@@ -396,23 +363,23 @@ We need to connect to next region
 
     region.elems.reset(array::Array::create<int>(shape));
 
-    int nelems     = 0;
     region.nquads  = 0;
     region.ntriags = 0;
 
     array::ArrayView<int, 3> elemview = array::make_view<int, 3>(*region.elems);
     elemview.assign(-1);
 
-    ATLAS_TRACE_SCOPE("generate elements") {
-        eckit::Channel blackhole;
-
-        eckit::ProgressTimer progress("Generating elements for " + std::to_string(lat_south - lat_north) + " rows",
-                                      lat_south - lat_north, " row", 5.,
-                                      lat_south - lat_north > 1280 ? Log::trace() : blackhole);
-
-        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat, ++progress) {
-            //    std::stringstream filename; filename << "/tmp/debug/"<<jlat;
+    std::vector<RowElements> rows(lat_south - lat_north);
 
+    ATLAS_TRACE_SCOPE("generate elements") {
+        // Rows of elements are generated independently, and merged into the region in order afterwards
+        std::exception_ptr row_exception;
+
+        // Each row is walked from its western end over its full length, so the work is O(nx) per row of
+        // the region rather than O(N/P). The walk cannot start at the first owned column: which of the
+        // north/south points advances, and the owner of triangles (inherited from the previous element),
+        // depend on the state accumulated from the start of the row.
+        auto generate_row = [&](idx_t jlat, RowElements& row) {
             idx_t ilat, latN, latS;
             idx_t ipN1, ipN2, ipS1, ipS2;
             double xN1, xN2, yN, xS1, xS2, yS;
@@ -420,7 +387,7 @@ We need to connect to next region
             bool try_make_triangle_up, try_make_triangle_down, try_make_quad;
             bool add_triag, add_quad;
 
-            ilat = jlat - region.north;
+            ilat = jlat - lat_north;
 
             auto lat_elems_view = elemview.slice(ilat, Range::all(), Range::all());
 
@@ -678,20 +645,9 @@ We need to connect to next region
                     }
                     add_quad = (pE == mypart);
                     if (add_quad) {
-                        ++region.nquads;
+                        ++row.nquads;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS2);
+                        row.add(ipN1, ipN2, ipS1, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -721,20 +677,9 @@ We need to connect to next region
 
                     if (add_triag) {
                         ATLAS_ASSERT(ipN1 != ipN2, "Faulty triangle with latN = "+std::to_string(latN)+"("+std::to_string(rg.y(latN))+")");
-                        ++region.ntriags;
+                        ++row.ntriags;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min<int>(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min<int>(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max<int>(region.lat_end.at(latN), ipN2);
-                        region.lat_end.at(latS)   = std::max<int>(region.lat_end.at(latS), ipS1);
+                        row.add(ipN1, ipN2, ipS1, ipS1);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -775,20 +720,9 @@ We need to connect to next region
                     add_triag = (mypart == pE);
 
                     if (add_triag) {
-                        ++region.ntriags;
+                        ++row.ntriags;
                         ++jelem;
-                        ++nelems;
-
-                        if (region.lat_begin.at(latN) == -1) {
-                            region.lat_begin.at(latN) = ipN1;
-                        }
-                        if (region.lat_begin.at(latS) == -1) {
-                            region.lat_begin.at(latS) = ipS1;
-                        }
-                        region.lat_begin.at(latN) = std::min(region.lat_begin.at(latN), ipN1);
-                        region.lat_begin.at(latS) = std::min(region.lat_begin.at(latS), ipS1);
-                        region.lat_end.at(latN)   = std::max(region.lat_end.at(latN), ipN1);
-                        region.lat_end.at(latS)   = std::max(region.lat_end.at(latS), ipS2);
+                        row.add(ipN1, ipN1, ipS1, ipS2);
                     }
                     else {
 #if DEBUG_OUTPUT
@@ -804,48 +738,111 @@ We need to connect to next region
                 ipN2 = std::min(endN, ipN1 + 1);
                 ipS2 = std::min(endS, ipS1 + 1);
             }
-            region.nb_lat_elems.at(jlat) = jelem;
+            row.nb_elems = jelem;
 #if DEBUG_OUTPUT
-            ATLAS_DEBUG_VAR(region.nb_lat_elems.at(jlat));
+            ATLAS_DEBUG_VAR(row.nb_elems);
 #endif
-            if (region.nb_lat_elems.at(jlat) == 0 && latN == region.north) {
+        };
+
+        atlas_omp_parallel_for(idx_t jlat = lat_north; jlat < lat_south; ++jlat) {
+            try {
+                generate_row(jlat, rows[jlat - lat_north]);
+            }
+            catch (...) {
+                atlas_omp_critical {
+                    if (not row_exception) {
+                        row_exception = std::current_exception();
+                    }
+                }
+            }
+        }  // for jlat
+
+        if (row_exception) {
+            std::rethrow_exception(row_exception);
+        }
+    }
+
+    ATLAS_TRACE_SCOPE("merge rows") {
+        // Merge in order of latitude, as rows without elements trim the region
+        for (idx_t jlat = lat_north; jlat < lat_south; ++jlat) {
+            const idx_t latN = jlat;
+            const idx_t latS = jlat + 1;
+            const auto& row  = rows[jlat - lat_north];
+
+            region.nquads += row.nquads;
+            region.ntriags += row.ntriags;
+            region.nb_lat_elems.at(jlat) = row.nb_elems;
+            region.nb_lat_quads.at(jlat) = row.nquads;
+
+            if (row.nb_elems > 0) {
+                auto merge_begin = [](idx_t& begin, idx_t row_begin) {
+                    begin = (begin == -1) ? row_begin : std::min(begin, row_begin);
+                };
+                merge_begin(region.lat_begin.at(latN), row.beginN);
+                merge_begin(region.lat_begin.at(latS), row.beginS);
+                region.lat_end.at(latN) = std::max(region.lat_end.at(latN), row.endN);
+                region.lat_end.at(latS) = std::max(region.lat_end.at(latS), row.endS);
+
+                // Rows are stored relative to the final north of the region
+                const idx_t ilat_row    = jlat - lat_north;
+                const idx_t ilat_region = jlat - region.north;
+                if (ilat_region != ilat_row) {
+                    for (idx_t jelem = 0; jelem < row.nb_elems; ++jelem) {
+                        for (idx_t jnode = 0; jnode < 4; ++jnode) {
+                            elemview(ilat_region, jelem, jnode) = elemview(ilat_row, jelem, jnode);
+                        }
+                    }
+                }
+            }
+
+            if (row.nb_elems == 0 && latN == region.north) {
                 ++region.north;
             }
-            if (region.nb_lat_elems.at(jlat) == 0 && latS == region.south) {
+            if (row.nb_elems == 0 && latS == region.south) {
                 --region.south;
             }
             //    region.lat_end.at(latN) = std::min(region.lat_end.at(latN),
             //    int(rg.nx(latN)-1));
             //    region.lat_end.at(latS) = std::min(region.lat_end.at(latS),
             //    int(rg.nx(latS)-1));
-            if (yN == 90 && unique_pole) {
+            if (rg.y(latN) == 90 && unique_pole) {
                 region.lat_end.at(latN) = rg.nx(latN) - 1;
             }
-            if (yS == -90 && unique_pole) {
+            if (rg.y(latS) == -90 && unique_pole) {
                 region.lat_end.at(latS) = rg.nx(latS) - 1;
             }
 
-            if (region.nb_lat_elems.at(jlat) > 0) {
+            if (row.nb_elems > 0) {
                 region.lat_end.at(latN) = std::max(region.lat_end.at(latN), region.lat_begin.at(latN));
                 region.lat_end.at(latS) = std::max(region.lat_end.at(latS), region.lat_begin.at(latS));
             }
-        }  // for jlat
+        }
     }
 
     //  Log::info()  << "nb_triags = " << region.ntriags << std::endl;
     //  Log::info()  << "nb_quads = " << region.nquads << std::endl;
     //  Log::info()  << "nb_elems = " << nelems << std::endl;
 
+    // Columns owned by this part on each latitude
+    std::vector<idx_t> owned_begin(rg.ny(), std::numeric_limits<idx_t>::max());
+    std::vector<idx_t> owned_end(rg.ny(), -1);
+    for (const auto& range : ranges) {
+        for (idx_t jlat = latitude(range.first); jlat < rg.ny() && offset[jlat] < range.second; ++jlat) {
+            const gidx_t begin = std::max<gidx_t>(range.first, offset[jlat]) - offset[jlat];
+            const gidx_t end   = std::min<gidx_t>(range.second, offset[jlat] + rg.nx(jlat)) - offset[jlat];
+            if (end > begin) {
+                owned_begin[jlat] = std::min<idx_t>(owned_begin[jlat], begin);
+                owned_end[jlat]   = std::max<idx_t>(owned_end[jlat], end - 1);
+            }
+        }
+    }
+
     int nb_region_nodes = 0;
     for (int jlat = region.north; jlat <= region.south; ++jlat) {
-        n                         = offset.at(jlat);
         region.lat_begin.at(jlat) = std::max<idx_t>(0, region.lat_begin.at(jlat));
-        for (idx_t jlon = 0; jlon < rg.nx(jlat); ++jlon) {
-            if (distribution.partition(n) == mypart) {
-                region.lat_begin.at(jlat) = std::min(region.lat_begin.at(jlat), jlon);
-                region.lat_end.at(jlat)   = std::max(region.lat_end.at(jlat), jlon);
-            }
-            ++n;
+        if (owned_end[jlat] >= 0) {
+            region.lat_begin.at(jlat) = std::min(region.lat_begin.at(jlat), owned_begin[jlat]);
+            region.lat_end.at(jlat)   = std::max(region.lat_end.at(jlat), owned_end[jlat]);
         }
         nb_region_nodes += region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1;
 
@@ -866,19 +863,6 @@ We need to connect to next region
 #endif
 }
 
-namespace {
-struct GhostNode {
-    GhostNode(int _jlat, int _jlon, int _jnode) {
-        jlat  = _jlat;
-        jlon  = _jlon;
-        jnode = _jnode;
-    }
-    int jlat;
-    int jlon;
-    int jnode;
-};
-}  // namespace
-
 void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid::Distribution& distribution,
                                             const Region& region, Mesh& mesh) const {
     ATLAS_TRACE();
@@ -1031,54 +1015,77 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
 
     std::vector<idx_t> node_numbering(node_numbering_size, -1);
     if (nnodes > 0) {
+    ATLAS_ASSERT(region.south >= region.north);
+
+    // Rows of nodes are numbered and filled independently, starting at offset_loc in the region
+    const idx_t nb_rows = region.south - region.north + 1;
+    std::vector<idx_t> nb_lat_nodes(nb_rows);
+    l = 0;
+    for (idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+        idx_t jlat = region.north + ilat;
+        if (region.lat_end.at(jlat) < region.lat_begin.at(jlat)) {
+            ATLAS_DEBUG_VAR(jlat);
+            ATLAS_DEBUG_VAR(region.lat_begin[jlat]);
+            ATLAS_DEBUG_VAR(region.lat_end[jlat]);
+        }
+        nb_lat_nodes[ilat] = std::max<idx_t>(0, region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1);
+        if (!include_periodic_ghost_points) {
+            nb_lat_nodes[ilat] -=
+                std::max<idx_t>(0, region.lat_end.at(jlat) - std::max(region.lat_begin.at(jlat), rg.nx(jlat)) + 1);
+        }
+        offset_loc.at(ilat) = l;
+        l += nb_lat_nodes[ilat];
+    }
+    const idx_t nb_region_nodes = l;
+
     if (options.getBool("ghost_at_end")) {
-        std::vector<GhostNode> ghost_nodes;
-        ghost_nodes.reserve(nnodes);
-        idx_t node_number = 0;
-        idx_t jnode       = 0;
-        l                 = 0;
-        ATLAS_ASSERT(region.south >= region.north);
-        for (int jlat = region.north; jlat <= region.south; ++jlat) {
-            int ilat            = jlat - region.north;
-            offset_loc.at(ilat) = l;
-            l += region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1;
-
-            if (region.lat_end.at(jlat) < region.lat_begin.at(jlat)) {
-                ATLAS_DEBUG_VAR(jlat);
-                ATLAS_DEBUG_VAR(region.lat_begin[jlat]);
-                ATLAS_DEBUG_VAR(region.lat_end[jlat]);
+        // Owned nodes are numbered first, followed by ghost nodes, both in order of rows
+        std::vector<idx_t> nb_lat_owned(nb_rows, 0);
+        atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+            idx_t jlat     = region.north + ilat;
+            idx_t jlon_end = std::min(region.lat_end.at(jlat), rg.nx(jlat) - 1);
+            for (idx_t jlon = region.lat_begin.at(jlat); jlon <= jlon_end; ++jlon) {
+                if (distribution.partition(offset_glb[jlat] + jlon) == mypart) {
+                    ++nb_lat_owned[ilat];
+                }
             }
+        }
+        std::vector<idx_t> owned_begin(nb_rows);
+        std::vector<idx_t> ghost_begin(nb_rows);
+        idx_t nb_owned = 0;
+        for (idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+            owned_begin[ilat] = nb_owned;
+            nb_owned += nb_lat_owned[ilat];
+        }
+        idx_t nb_ghost = 0;
+        for (idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+            ghost_begin[ilat] = nb_owned + nb_ghost;
+            nb_ghost += nb_lat_nodes[ilat] - nb_lat_owned[ilat];
+        }
+
+        atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+            idx_t jlat         = region.north + ilat;
+            idx_t owned_number = owned_begin[ilat];
+            idx_t ghost_number = ghost_begin[ilat];
+            idx_t jnode        = offset_loc[ilat];
             for (idx_t jlon = region.lat_begin.at(jlat); jlon <= region.lat_end.at(jlat); ++jlon) {
                 if (jlon < rg.nx(jlat)) {
-                    n = offset_glb.at(jlat) + jlon;
-                    if (distribution.partition(n) == mypart) {
-                        node_numbering.at(jnode) = node_number;
-                        ++node_number;
+                    if (distribution.partition(offset_glb[jlat] + jlon) == mypart) {
+                        node_numbering.at(jnode) = owned_number++;
                     }
                     else {
-                        ghost_nodes.emplace_back(jlat, jlon, jnode);
+                        node_numbering.at(jnode) = ghost_number++;
                     }
                     ++jnode;
                 }
                 else if (include_periodic_ghost_points)  // add periodic point
                 {
-                    //#warning TODO: use commented approach
-                    part(jnode) = mypart;
-                    // part(jnode)      = parts.at( offset_glb.at(jlat) );
-                    ghost(jnode) = 1;
-                    halo(jnode)  = 0;
-                    ghost_nodes.emplace_back(jlat, rg.nx(jlat), jnode);
+                    node_numbering.at(jnode) = ghost_number++;
                     ++jnode;
                 }
-                else {
-                    --l;
-                }
             }
         }
-        for (size_t jghost = 0; jghost < ghost_nodes.size(); ++jghost) {
-            node_numbering.at(ghost_nodes.at(jghost).jnode) = node_number;
-            ++node_number;
-        }
+        idx_t jnode = nb_region_nodes;
         if (include_north_pole) {
             node_numbering.at(jnode) = jnode;
             ++jnode;
@@ -1096,18 +1103,15 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
         }
     }
 
-    idx_t jnode = 0;
-    l           = 0;
-    for (idx_t jlat = region.north; jlat <= region.south; ++jlat) {
-        idx_t ilat          = jlat - region.north;
-        offset_loc.at(ilat) = l;
-        l += region.lat_end.at(jlat) - region.lat_begin.at(jlat) + 1;
+    atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_rows; ++ilat) {
+        idx_t jlat  = region.north + ilat;
+        idx_t jnode = offset_loc[ilat];
 
         double y = rg.y(jlat);
         for (idx_t jlon = region.lat_begin.at(jlat); jlon <= region.lat_end.at(jlat); ++jlon) {
             if (jlon < rg.nx(jlat)) {
                 idx_t inode = node_numbering.at(jnode);
-                n           = offset_glb.at(jlat) + jlon;
+                gidx_t n    = offset_glb.at(jlat) + jlon;
 
                 double x = rg.x(jlon, jlat);
                 // std::cout << "jlat = " << jlat << "; jlon = " << jlon << "; x = " <<
@@ -1195,12 +1199,10 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
                 }
                 ++jnode;
             }
-            else {
-                --l;
-            }
         }
     }
 
+    idx_t jnode = nb_region_nodes;
     if (include_north_pole) {
         idx_t inode   = node_numbering.at(jnode);
         jnorth        = jnode;
@@ -1304,14 +1306,32 @@ void StructuredMeshGenerator::generate_mesh(const StructuredGrid& rg, const grid
     }
 
     if ((region.nquads + region.ntriags) > 0) {
-    for (idx_t jlat = region.north; jlat < region.south; ++jlat) {
-        idx_t ilat  = jlat - region.north;
-        idx_t jlatN = jlat;
-        idx_t jlatS = jlat + 1;
-        idx_t ilatN = ilat;
-        idx_t ilatS = ilat + 1;
+    // Cells of each row are filled independently, starting at the cumulative number of quads and triangles
+    const idx_t nb_elem_rows = region.south - region.north;
+    std::vector<idx_t> quad_row_begin(nb_elem_rows);
+    std::vector<idx_t> triag_row_begin(nb_elem_rows);
+    for (idx_t ilat = 0; ilat < nb_elem_rows; ++ilat) {
+        idx_t jlat            = region.north + ilat;
+        quad_row_begin[ilat]  = jquad;
+        triag_row_begin[ilat] = jtriag;
+        jquad += region.nb_lat_quads.at(jlat);
+        jtriag += region.nb_lat_elems.at(jlat) - region.nb_lat_quads.at(jlat);
+    }
+
+    const auto elems = array::make_view<int, 3>(*region.elems);
+    atlas_omp_parallel_for(idx_t ilat = 0; ilat < nb_elem_rows; ++ilat) {
+        idx_t jlat   = region.north + ilat;
+        idx_t jlatN  = jlat;
+        idx_t jlatS  = jlat + 1;
+        idx_t ilatN  = ilat;
+        idx_t ilatS  = ilat + 1;
+        idx_t jquad  = quad_row_begin[ilat];
+        idx_t jtriag = triag_row_begin[ilat];
+        idx_t jcell;
+        idx_t quad_nodes[4];
+        idx_t triag_nodes[3];
         for (idx_t jelem = 0; jelem < region.nb_lat_elems.at(jlat); ++jelem) {
-            const auto elem = array::make_view<int, 3>(*region.elems).slice(ilat, jelem, Range::all());
+            const auto elem = elems.slice(ilat, jelem, Range::all());
 
             if (elem(2) >= 0 && elem(3) >= 0)  // This is a quad
             {
@@ -52,6 +52,8 @@ public:
 
     std::string type() const override { return "structured"; }
 
+    std::string mpi_comm() const override { return options.getString("mpi_comm"); }
+
 private:
     virtual void hash(eckit::Hash&) const override;
 
@@ -16,6 +16,7 @@
 #include "eckit/thread/AutoLock.h"
 #include "eckit/thread/Mutex.h"
 
+#include "atlas/field/FieldSet.h"
 #include "atlas/library/config.h"
 #include "atlas/numerics/Method.h"
 #include "atlas/numerics/Nabla.h"
@@ -44,6 +45,22 @@ NablaImpl::NablaImpl(const Method& method, const eckit::Parametrisation&): metho
 
 NablaImpl::~NablaImpl() = default;
 
+void NablaImpl::gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                         FieldSet& divergences, FieldSet& curls) const {
+    ATLAS_ASSERT(gradients.size() == 0 || gradients.size() == scalars.size());
+    ATLAS_ASSERT(divergences.size() == 0 || divergences.size() == vectors.size());
+    ATLAS_ASSERT(curls.size() == 0 || curls.size() == vectors.size());
+    for (idx_t j = 0; j < gradients.size(); ++j) {
+        gradient(scalars[j], gradients[j]);
+    }
+    for (idx_t j = 0; j < divergences.size(); ++j) {
+        divergence(vectors[j], divergences[j]);
+    }
+    for (idx_t j = 0; j < curls.size(); ++j) {
+        curl(vectors[j], curls[j]);
+    }
+}
+
 Nabla::Nabla(const Method& method, const eckit::Parametrisation& p): Handle(NablaFactory::build(method, p)) {}
 
 Nabla::Nabla(const Method& method): Nabla(method, util::NoConfig()) {}
@@ -64,6 +81,11 @@ void Nabla::laplacian(const Field& scalar, Field& laplacian) const {
     get()->laplacian(scalar, laplacian);
 }
 
+void Nabla::gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                     FieldSet& divergences, FieldSet& curls) const {
+    get()->gradient_divergence_curl(scalars, gradients, vectors, divergences, curls);
+}
+
 namespace {
 
 template <typename T>
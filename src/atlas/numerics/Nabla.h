@@ -33,6 +33,7 @@ class FunctionSpaceImpl;
 }  // namespace atlas
 namespace atlas {
 class Field;
+class FieldSet;
 class FunctionSpace;
 }  // namespace atlas
 
@@ -50,6 +51,13 @@ public:
     virtual void curl(const Field& vector, Field& curl) const           = 0;
     virtual void laplacian(const Field& scalar, Field& laplacian) const = 0;
 
+    /// Gradients of scalar fields, and divergence and curl of vector fields, in a single call.
+    /// Each output set is either empty, to skip that operator, or matches its input set in size.
+    /// The default implementation applies the operators field by field; implementations may
+    /// fuse them into a single traversal of the mesh.
+    virtual void gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                          FieldSet& divergences, FieldSet& curls) const;
+
     virtual const FunctionSpace& functionspace() const = 0;
 
 private:
@@ -70,6 +78,8 @@ public:
     void divergence(const Field& vector, Field& div) const;
     void curl(const Field& vector, Field& curl) const;
     void laplacian(const Field& scalar, Field& laplacian) const;
+    void gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                  FieldSet& divergences, FieldSet& curls) const;
 };
 
 // ------------------------------------------------------------------
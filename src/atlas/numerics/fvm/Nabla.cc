@@ -13,6 +13,7 @@
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
@@ -34,8 +35,32 @@ namespace fvm {
 
 namespace {
 static NablaBuilder<Nabla> __fvm_nabla("fvm");
+
+template <typename Value>
+array::LocalView<const Value, 2> make_scalar_view(const Field& field) {
+    return field.levels() ? array::make_view<Value, 2>(field).slice(Range::all(), Range::all())
+                          : array::make_view<Value, 1>(field).slice(Range::all(), Range::dummy());
+}
+
+template <typename Value>
+array::LocalView<Value, 2> make_scalar_view(Field& field) {
+    return field.levels() ? array::make_view<Value, 2>(field).slice(Range::all(), Range::all())
+                          : array::make_view<Value, 1>(field).slice(Range::all(), Range::dummy());
+}
+
+template <typename Value>
+array::LocalView<const Value, 3> make_vector_view(const Field& field) {
+    return field.levels() ? array::make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all())
+                          : array::make_view<Value, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
 }
 
+template <typename Value>
+array::LocalView<Value, 3> make_vector_view(Field& field) {
+    return field.levels() ? array::make_view<Value, 3>(field).slice(Range::all(), Range::all(), Range::all())
+                          : array::make_view<Value, 2>(field).slice(Range::all(), Range::dummy(), Range::all());
+}
+}  // namespace
+
 Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): atlas::numerics::NablaImpl(method, p) {
     fvm_ = dynamic_cast<const fvm::Method*>(&method);
     if (!fvm_) {
@@ -56,6 +81,13 @@ Nabla::Nabla(const numerics::Method& method, const eckit::Parametrisation& p): a
     // Results seem to indicate that approach=0 is overall better, although approach=1
     // seems to handle pole slightly better (error factor 2 to 4 times lower)
 
+    p.get("fused", fused_);
+    // fused = true  DEFAULT
+    //   gradient of scalar, divergence and curl accumulate edge contributions per node, computing
+    //   edge averages on the fly for all levels, without temporary storage per edge
+    // fused = false
+    //   edge averages are first stored for all edges and levels, then gathered per node
+
     setup();
 }
 
@@ -82,8 +114,177 @@ void Nabla::setup() {
     for (idx_t jedge = 0; jedge < c; ++jedge) {
         pole_edges_.push_back(tmp[jedge]);
     }
+
+    // Edges of each node in compressed sparse row layout, skipping edges that are not part of edge_columns.
+    // Only used by the fused kernels.
+    if (!fused_) {
+        return;
+    }
+    const mesh::Nodes& nodes = fvm_->mesh().nodes();
+
+    const idx_t nnodes = fvm_->node_columns().nb_nodes();
+    const double deg2rad = M_PI / 180.;
+
+    const auto lonlat_deg     = array::make_view<double, 2>(nodes.lonlat());
+    const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
+    const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
+
+    const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
+    const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
+
+    auto& offset = node_edges_.offset;
+    offset.resize(nnodes + 1);
+    offset[0] = 0;
+    for (idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        idx_t n = 0;
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            n += (node2edge(jnode, jedge) < nedges);
+        }
+        offset[jnode + 1] = offset[jnode] + n;
+    }
+    const idx_t nnz = offset[nnodes];
+    node_edges_.node.resize(2 * nnz);
+    node_edges_.weight.resize(2 * nnz);
+    node_edges_.cosy.resize(2 * nnz);
+
+    atlas_omp_parallel_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+        idx_t j = offset[jnode];
+        for (idx_t jedge = 0; jedge < node2edge.cols(jnode); ++jedge) {
+            const idx_t iedge = node2edge(jnode, jedge);
+            if (iedge < nedges) {
+                const idx_t ip1   = edge2node(iedge, 0);
+                const idx_t ip2   = edge2node(iedge, 1);
+                const double sign = node2edge_sign(jnode, jedge);
+                const double pbc  = 1 - is_pole_edge(iedge);
+                const double y1   = lonlat_deg(ip1, LAT) * deg2rad;
+                const double y2   = lonlat_deg(ip2, LAT) * deg2rad;
+
+                node_edges_.node[2 * j + 0]     = ip1;
+                node_edges_.node[2 * j + 1]     = ip2;
+                node_edges_.weight[2 * j + LON] = sign * (dual_normals(iedge, LON) * deg2rad);
+                node_edges_.weight[2 * j + LAT] = sign * (dual_normals(iedge, LAT) * deg2rad);
+                if (metric_approach_ == 0) {
+                    node_edges_.cosy[2 * j + 0] = std::cos(y1) * pbc;
+                    node_edges_.cosy[2 * j + 1] = std::cos(y2) * pbc;
+                }
+                else {
+                    node_edges_.cosy[2 * j + 0] = node_edges_.cosy[2 * j + 1] = std::cos(0.5 * (y1 + y2)) * pbc;
+                }
+                ++j;
+            }
+        }
+    }
 }
 
+// Operators on the edges of each node, as stored by setup() in compressed sparse row layout.
+// Edge averages are computed on the fly and accumulated per node, vectorised over levels, so that
+// no temporary per edge is required and nodes can be processed concurrently without atomics.
+// Views are indexed (node, level[, variable]).
+template <typename Value>
+class Nabla::FusedKernels {
+public:
+    FusedKernels(const Nabla& nabla):
+        offset_(nabla.node_edges_.offset.data()),
+        node_(nabla.node_edges_.node.data()),
+        weight_(nabla.node_edges_.weight.data()),
+        cosy_(nabla.node_edges_.cosy.data()),
+        lonlat_deg_(array::make_view<double, 2>(nabla.fvm_->mesh().nodes().lonlat())),
+        dual_volumes_(array::make_view<double, 1>(nabla.fvm_->mesh().nodes().field("dual_volumes"))),
+        scale_(deg2rad_ * deg2rad_ * static_cast<Value>(nabla.fvm_->radius())) {}
+
+    // Gradient of a scalar at node jnode, with work of size 2*nlev
+    void gradient(idx_t jnode, const array::LocalView<const Value, 2>& scalar, Value* work,
+                  array::LocalView<Value, 3>& grad) const {
+        const idx_t nlev       = scalar.shape(1);
+        const idx_t lev_stride = scalar.stride(1);
+        Value* sum_lon         = work;
+        Value* sum_lat         = work + nlev;
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            sum_lon[jlev] = 0.;
+            sum_lat[jlev] = 0.;
+        }
+        for (idx_t j = offset_[jnode]; j < offset_[jnode + 1]; ++j) {
+            const Value* s1   = &scalar(node_[2 * j + 0], 0);
+            const Value* s2   = &scalar(node_[2 * j + 1], 0);
+            const Value w_lon = weight_[2 * j + LON];
+            const Value w_lat = weight_[2 * j + LAT];
+            atlas_omp_pragma(omp simd)
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                const Value avg = (s1[jlev * lev_stride] + s2[jlev * lev_stride]) * Value{0.5};
+                sum_lon[jlev] += w_lon * avg;
+                sum_lat[jlev] += w_lat * avg;
+            }
+        }
+
+        const Value y        = lonlat_deg_(jnode, LAT) * deg2rad_;
+        const Value metric_y = Value{1.} / (static_cast<Value>(dual_volumes_(jnode)) * scale_);
+        const Value metric_x = metric_y / std::cos(y);
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            grad(jnode, jlev, LON) = sum_lon[jlev] * metric_x;
+            grad(jnode, jlev, LAT) = sum_lat[jlev] * metric_y;
+        }
+    }
+
+    // Divergence and/or curl of a vector at node jnode, with work of size 2*nlev
+    template <bool Div, bool Curl>
+    void divergence_curl(idx_t jnode, const array::LocalView<const Value, 3>& vector, Value* work,
+                         array::LocalView<Value, 2>* div, array::LocalView<Value, 2>* curl) const {
+        const idx_t nlev       = vector.shape(1);
+        const idx_t lev_stride = vector.stride(1);
+        const idx_t var_stride = vector.stride(2);
+        Value* sum_div         = work;
+        Value* sum_curl        = work + nlev;
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            sum_div[jlev]  = 0.;
+            sum_curl[jlev] = 0.;
+        }
+        for (idx_t j = offset_[jnode]; j < offset_[jnode + 1]; ++j) {
+            const Value* x1   = &vector(node_[2 * j + 0], 0, 0);
+            const Value* x2   = &vector(node_[2 * j + 1], 0, 0);
+            const Value w_lon = weight_[2 * j + LON];
+            const Value w_lat = weight_[2 * j + LAT];
+            const Value cosy1 = cosy_[2 * j + 0];
+            const Value cosy2 = cosy_[2 * j + 1];
+            atlas_omp_pragma(omp simd)
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                const idx_t ilon = jlev * lev_stride;
+                const idx_t ilat = ilon + var_stride;
+                if constexpr (Div) {
+                    const Value avg_lon = (x1[ilon] + x2[ilon]) * Value{0.5};
+                    const Value avg_lat = (x1[ilat] * cosy1 + x2[ilat] * cosy2) * Value{0.5};
+                    sum_div[jlev] += avg_lon * w_lon + avg_lat * w_lat;
+                }
+                if constexpr (Curl) {
+                    const Value avg_lon = (x1[ilon] * cosy1 + x2[ilon] * cosy2) * Value{0.5};
+                    const Value avg_lat = (x1[ilat] + x2[ilat]) * Value{0.5};
+                    sum_curl[jlev] += avg_lat * w_lon - avg_lon * w_lat;
+                }
+            }
+        }
+
+        const Value y      = lonlat_deg_(jnode, LAT) * deg2rad_;
+        const Value metric = Value{1.} / (static_cast<Value>(dual_volumes_(jnode)) * scale_ * std::cos(y));
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            if constexpr (Div) {
+                (*div)(jnode, jlev) = sum_div[jlev] * metric;
+            }
+            if constexpr (Curl) {
+                (*curl)(jnode, jlev) = sum_curl[jlev] * metric;
+            }
+        }
+    }
+
+private:
+    const idx_t* offset_;
+    const idx_t* node_;
+    const double* weight_;
+    const double* cosy_;
+    const array::ArrayView<const double, 2> lonlat_deg_;
+    const array::ArrayView<const double, 1> dual_volumes_;
+    const Value deg2rad_ = M_PI / 180.;
+    const Value scale_;
+};
+
 void Nabla::gradient(const Field& field, Field& grad_field) const {
     if (field.variables() > 1) {
         return gradient_of_vector(field, grad_field);
@@ -125,14 +326,25 @@ void Nabla::gradient_of_scalar(const Field& scalar_field, Field& grad_field) con
         const auto dual_normals   = array::make_view<double, 2>(edges.field("dual_normals"));
         const auto node2edge_sign = array::make_view<double, 2>(nodes.field("node2edge_sign"));
 
+        const Value scale = deg2rad * deg2rad * radius;
+
+        if (fused_) {
+            const FusedKernels<Value> kernels(*this);
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.gradient(jnode, scalar, work.data(), grad);
+                }
+            }
+            return;
+        }
+
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
         array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
         auto avgS = array::make_view<Value, 3>(avgS_arr);
 
-        const Value scale = deg2rad * deg2rad * radius;
-
         atlas_omp_parallel {
             atlas_omp_for(idx_t jedge = 0; jedge < nedges; ++jedge) {
                 idx_t ip1 = edge2node(jedge, 0);
@@ -290,15 +502,18 @@ void Nabla::gradient_of_vector(const Field& vector_field, Field& grad_field) con
                     grad(jnode, jlev, LATdLAT) *= metric_y;
                 }
             }
-        }
-        // Fix wrong node2edge_sign for vector quantities
-        for (size_t jedge = 0; jedge < pole_edges_.size(); ++jedge) {
-            const idx_t iedge     = pole_edges_[jedge];
-            const idx_t jnode     = edge2node(iedge, 1);
-            const Value metric_y = Value{1.} / (static_cast<Value>(dual_volumes(jnode)) * scale);
-            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
-                grad(jnode, jlev, LONdLAT) -= 2. * avgS(iedge, jlev, LONdLAT) * metric_y;
-                grad(jnode, jlev, LATdLAT) -= 2. * avgS(iedge, jlev, LATdLAT) * metric_y;
+
+            // Fix wrong node2edge_sign for vector quantities.
+            // Pole edges may share nodes, so work is distributed over levels instead of edges.
+            const idx_t npole_edges = static_cast<idx_t>(pole_edges_.size());
+            atlas_omp_for(idx_t jlev = 0; jlev < nlev; ++jlev) {
+                for (idx_t jedge = 0; jedge < npole_edges; ++jedge) {
+                    const idx_t iedge    = pole_edges_[jedge];
+                    const idx_t jnode    = edge2node(iedge, 1);
+                    const Value metric_y = Value{1.} / (static_cast<Value>(dual_volumes(jnode)) * scale);
+                    grad(jnode, jlev, LONdLAT) -= 2. * avgS(iedge, jlev, LONdLAT) * metric_y;
+                    grad(jnode, jlev, LATdLAT) -= 2. * avgS(iedge, jlev, LATdLAT) * metric_y;
+                }
             }
         }
     };
@@ -355,11 +570,22 @@ void Nabla::divergence(const Field& vector_field, Field& div_field) const {
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
+        const Value scale = deg2rad * deg2rad * radius;
+
+        if (fused_) {
+            const FusedKernels<Value> kernels(*this);
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.template divergence_curl<true, false>(jnode, vector, work.data(), &div, nullptr);
+                }
+            }
+            return;
+        }
+
         array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
         array::ArrayView<Value, 3> avgS = array::make_view<Value, 3>(avgS_arr);
 
-        const Value scale = deg2rad * deg2rad * radius;
-
         enum
         {
             LONdLON = 0,
@@ -474,11 +700,22 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
         const mesh::Connectivity& node2edge           = nodes.edge_connectivity();
         const mesh::MultiBlockConnectivity& edge2node = edges.node_connectivity();
 
+        const Value scale = deg2rad * deg2rad * radius;
+
+        if (fused_) {
+            const FusedKernels<Value> kernels(*this);
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.template divergence_curl<false, true>(jnode, vector, work.data(), nullptr, &curl);
+                }
+            }
+            return;
+        }
+
         array::ArrayT<Value> avgS_arr(nedges, nlev, 2ul);
         array::ArrayView<Value, 3> avgS = array::make_view<Value, 3>(avgS_arr);
 
-        const Value scale = deg2rad * deg2rad * radius;
-
         enum
         {
             LONdLAT = 0,
@@ -557,14 +794,178 @@ void Nabla::curl(const Field& vector_field, Field& curl_field) const {
     }
 }
 
-void Nabla::laplacian(const Field& scalar, Field& lapl) const {
-    Field grad(fvm_->node_columns().createField(option::name("grad") | option::levels(scalar.levels()) |
-                                                option::variables(2) | option::datatype(scalar.datatype())));
-    gradient(scalar, grad);
-    if (fvm_->node_columns().halo().size() < 2) {
-        fvm_->node_columns().haloExchange(grad);
+void Nabla::laplacian(const Field& scalar_field, Field& lapl_field) const {
+    const bool halo_exchange = fvm_->node_columns().halo().size() < 2;
+    if (!fused_) {
+        Field grad(fvm_->node_columns().createField(option::name("grad") | option::levels(scalar_field.levels()) |
+                                                    option::variables(2) | option::datatype(scalar_field.datatype())));
+        gradient(scalar_field, grad);
+        if (halo_exchange) {
+            fvm_->node_columns().haloExchange(grad);
+        }
+        divergence(grad, lapl_field);
+        return;
+    }
+
+    auto dispatch = [&](auto value) {
+        using Value = std::decay_t<decltype(value)>;
+
+        const idx_t nnodes = fvm_->node_columns().nb_nodes();
+
+        const auto scalar = make_scalar_view<Value>(scalar_field);
+        auto lapl         = make_scalar_view<Value>(lapl_field);
+
+        const idx_t nlev = scalar.shape(1);
+        if (lapl.shape(1) != nlev) {
+            throw_AssertionFailed("laplacian field should have same number of levels", Here());
+        }
+
+        const FusedKernels<Value> kernels(*this);
+
+        if (halo_exchange) {
+            // The gradient is needed in the halo, so it is stored in a field that can be exchanged
+            Field grad_field(fvm_->node_columns().createField(option::name("grad") | option::levels(scalar_field.levels()) |
+                                                              option::variables(2) | option::datatype(scalar_field.datatype())));
+            auto grad = make_vector_view<Value>(grad_field);
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.gradient(jnode, scalar, work.data(), grad);
+                }
+            }
+            fvm_->node_columns().haloExchange(grad_field);
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.template divergence_curl<true, false>(jnode, grad, work.data(), &lapl, nullptr);
+                }
+            }
+        }
+        else {
+            // The halo is wide enough to compute the gradient wherever it is needed, so both operators
+            // are applied in a single parallel region, with the gradient in scratch storage
+            array::ArrayT<Value> grad_arr(nnodes, nlev, 2ul);
+            auto grad = array::make_view<Value, 3>(grad_arr).slice(Range::all(), Range::all(), Range::all());
+            atlas_omp_parallel {
+                std::vector<Value> work(2 * nlev);
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.gradient(jnode, scalar, work.data(), grad);
+                }
+                atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                    kernels.template divergence_curl<true, false>(jnode, grad, work.data(), &lapl, nullptr);
+                }
+            }
+        }
+    };
+    ATLAS_ASSERT( scalar_field.datatype() == lapl_field.datatype() );
+    switch (scalar_field.datatype().kind()) {
+        case (DataType::KIND_REAL32): {
+            dispatch(float{});
+            break;
+        }
+        case (DataType::KIND_REAL64): {
+            dispatch(double{});
+            break;
+        }
+        default:
+            ATLAS_NOTIMPLEMENTED;
+    }
+}
+
+void Nabla::gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                     FieldSet& divergences, FieldSet& curls) const {
+    if (!fused_) {
+        NablaImpl::gradient_divergence_curl(scalars, gradients, vectors, divergences, curls);
+        return;
+    }
+    ATLAS_ASSERT(gradients.size() == 0 || gradients.size() == scalars.size());
+    ATLAS_ASSERT(divergences.size() == 0 || divergences.size() == vectors.size());
+    ATLAS_ASSERT(curls.size() == 0 || curls.size() == vectors.size());
+
+    const idx_t nscalars = gradients.size();
+    const idx_t nvectors = std::max(divergences.size(), curls.size());
+    if (nscalars + nvectors == 0) {
+        return;
+    }
+    const DataType datatype = nscalars ? scalars[0].datatype() : vectors[0].datatype();
+
+    auto dispatch = [&](auto value) {
+        using Value = std::decay_t<decltype(value)>;
+
+        const idx_t nnodes = fvm_->node_columns().nb_nodes();
+
+        std::vector<array::LocalView<const Value, 2>> scalar;
+        std::vector<array::LocalView<Value, 3>> grad;
+        std::vector<array::LocalView<const Value, 3>> vector;
+        std::vector<array::LocalView<Value, 2>> div;
+        std::vector<array::LocalView<Value, 2>> curl;
+        idx_t nlev_max = 0;
+
+        for (idx_t j = 0; j < nscalars; ++j) {
+            ATLAS_ASSERT(scalars[j].datatype() == datatype && gradients[j].datatype() == datatype);
+            ATLAS_ASSERT(scalars[j].variables() <= 1, "Gradient of vector fields is not supported here");
+            scalar.emplace_back(make_scalar_view<Value>(scalars[j]));
+            grad.emplace_back(make_vector_view<Value>(gradients[j]));
+            if (grad[j].shape(1) != scalar[j].shape(1)) {
+                throw_AssertionFailed("gradient field should have same number of levels", Here());
+            }
+            nlev_max = std::max(nlev_max, scalar[j].shape(1));
+        }
+        for (idx_t j = 0; j < nvectors; ++j) {
+            ATLAS_ASSERT(vectors[j].datatype() == datatype);
+            vector.emplace_back(make_vector_view<Value>(vectors[j]));
+            const idx_t nlev = vector[j].shape(1);
+            if (divergences.size()) {
+                ATLAS_ASSERT(divergences[j].datatype() == datatype);
+                div.emplace_back(make_scalar_view<Value>(divergences[j]));
+                if (div[j].shape(1) != nlev) {
+                    throw_AssertionFailed("div_field should have same number of levels", Here());
+                }
+            }
+            if (curls.size()) {
+                ATLAS_ASSERT(curls[j].datatype() == datatype);
+                curl.emplace_back(make_scalar_view<Value>(curls[j]));
+                if (curl[j].shape(1) != nlev) {
+                    throw_AssertionFailed("curl field should have same number of levels", Here());
+                }
+            }
+            nlev_max = std::max(nlev_max, nlev);
+        }
+
+        const FusedKernels<Value> kernels(*this);
+
+        atlas_omp_parallel {
+            std::vector<Value> work(2 * nlev_max);
+            atlas_omp_for(idx_t jnode = 0; jnode < nnodes; ++jnode) {
+                for (idx_t j = 0; j < nscalars; ++j) {
+                    kernels.gradient(jnode, scalar[j], work.data(), grad[j]);
+                }
+                for (idx_t j = 0; j < nvectors; ++j) {
+                    if (div.size() && curl.size()) {
+                        kernels.template divergence_curl<true, true>(jnode, vector[j], work.data(), &div[j], &curl[j]);
+                    }
+                    else if (div.size()) {
+                        kernels.template divergence_curl<true, false>(jnode, vector[j], work.data(), &div[j], nullptr);
+                    }
+                    else {
+                        kernels.template divergence_curl<false, true>(jnode, vector[j], work.data(), nullptr, &curl[j]);
+                    }
+                }
+            }
+        }
+    };
+    switch (datatype.kind()) {
+        case (DataType::KIND_REAL32): {
+            dispatch(float{});
+            break;
+        }
+        case (DataType::KIND_REAL64): {
+            dispatch(double{});
+            break;
+        }
+        default:
+            ATLAS_NOTIMPLEMENTED;
     }
-    divergence(grad, lapl);
 }
 
 const FunctionSpace& Nabla::functionspace() const {
@@ -25,6 +25,7 @@ class Method;
 
 namespace atlas {
 class Field;
+class FieldSet;
 }
 
 namespace atlas {
@@ -41,6 +42,8 @@ public:
     virtual void divergence(const Field& vector, Field& div) const override;
     virtual void curl(const Field& vector, Field& curl) const override;
     virtual void laplacian(const Field& scalar, Field& laplacian) const override;
+    virtual void gradient_divergence_curl(const FieldSet& scalars, FieldSet& gradients, const FieldSet& vectors,
+                                          FieldSet& divergences, FieldSet& curls) const override;
 
     virtual const FunctionSpace& functionspace() const override;
 
@@ -50,10 +53,23 @@ private:
     void gradient_of_scalar(const Field& scalar, Field& grad) const;
     void gradient_of_vector(const Field& vector, Field& grad) const;
 
+    template <typename Value>
+    class FusedKernels;
+
 private:
     fvm::Method const* fvm_;
     std::vector<idx_t> pole_edges_;
     int metric_approach_{0};
+    bool fused_{true};
+
+    // Edges of each node in compressed sparse row layout, with the node2edge sign folded into the weights.
+    // Used by the fused operators, which evaluate edge averages on the fly instead of storing them per edge.
+    struct NodeEdges {
+        std::vector<idx_t> offset;   // [nnodes+1], entries of node n are in [offset[n], offset[n+1])
+        std::vector<idx_t> node;     // [2*nnz], both nodes of the edge, in edge2node order
+        std::vector<double> weight;  // [2*nnz], sign * dual_normal * deg2rad, for LON and LAT
+        std::vector<double> cosy;    // [2*nnz], metric term cos(y) at both nodes, zero for pole edges
+    } node_edges_;
 };
 #endif
 // ------------------------------------------------------------------
@@ -0,0 +1,30 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/output/VTK.h"
+#include "atlas/output/detail/VTKImpl.h"
+
+namespace atlas {
+namespace output {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+VTK::VTK(const Output& output): Output(output) {}
+
+VTK::VTK(std::ostream& s): Output(new detail::VTKImpl(s)) {}
+
+VTK::VTK(std::ostream& s, const eckit::Parametrisation& c): Output(new detail::VTKImpl(s, c)) {}
+
+VTK::VTK(const eckit::PathName& p): Output(new detail::VTKImpl(p)) {}
+
+VTK::VTK(const eckit::PathName& p, const eckit::Parametrisation& c): Output(new detail::VTKImpl(p, c)) {}
+
+}  // namespace output
+}  // namespace atlas
@@ -0,0 +1,52 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/output/Output.h"
+#include "atlas/util/Config.h"
+
+namespace eckit {
+class Parametrisation;
+class PathName;
+}  // namespace eckit
+
+namespace atlas {
+namespace output {
+
+// -----------------------------------------------------------------------------
+
+/// @brief Output of meshes and fields as VTK unstructured grids with appended raw binary data
+///
+/// Each MPI task writes its own piece ("<file basename>_p<rank>.vtu") in parallel, and task 0 writes the
+/// index file ("<file basename>.pvtu") that references all pieces. With a single task, only the given file is
+/// written. The same file name, e.g. "output.vtu", can therefore be used regardless of the number of tasks.
+/// Every write produces a complete data set: the mesh of the function space together with the given fields,
+/// as point data for NodeColumns and as cell data for CellColumns.
+///
+/// Options:
+///   - "coordinates" : "xy" (default), "lonlat" or "xyz"
+///   - "ghost"       : include halo cells (default false)
+///   - "levels"      : levels of fields to write (default all)
+///   - "file"        : output file, overriding the one given at construction
+class VTK : public Output {
+public:
+    VTK(const Output& output);
+    VTK(std::ostream&);
+    VTK(std::ostream&, const eckit::Parametrisation&);
+
+    VTK(const eckit::PathName&);
+    VTK(const eckit::PathName&, const eckit::Parametrisation&);
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace output
+}  // namespace atlas
@@ -10,11 +10,16 @@
 
 // file deepcode ignore MissingOpenCheckOnFile: False positive
 
+#include <charconv>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 #include "eckit/filesystem/PathName.h"
 #include "eckit/config/Resource.h"
@@ -108,6 +113,106 @@ void write_header_binary(std::ostream& out) {
 
 namespace {  // anonymous
 
+// Buffered writer for the data lines of Gmsh sections ($Nodes, $Elements, $NodeData, $ElementData).
+// ASCII numbers are formatted with std::to_chars; binary records hold node/element numbers as int and values
+// as double, as declared by write_header_binary. The buffer is written to the stream in large blocks.
+class GmshBuffer {
+public:
+    GmshBuffer(std::ostream& out, bool binary): out_(out), binary_(binary) { buffer_.resize(capacity_); }
+    ~GmshBuffer() { flush(); }
+
+    template <typename T>
+    void index(T i) {
+        if (binary_) {
+            put_bytes(static_cast<int>(i));
+        }
+        else {
+            put_text(i);
+        }
+    }
+
+    template <typename T>
+    void value(T v) {
+        if (binary_) {
+            put_bytes(static_cast<double>(v));
+        }
+        else {
+            put_text(v);
+        }
+    }
+
+    void end_record() {
+        if (not binary_) {
+            reserve(1);
+            buffer_[size_++] = '\n';
+            record_begin_    = true;
+        }
+    }
+
+    /// @brief Terminate the binary data of a section, so that the "$End..." tag starts on a new line
+    void end_section() {
+        if (binary_) {
+            reserve(1);
+            buffer_[size_++] = '\n';
+        }
+    }
+
+    void flush() {
+        out_.write(buffer_.data(), size_);
+        size_ = 0;
+    }
+
+private:
+    static constexpr size_t capacity_    = 1 << 20;
+    static constexpr size_t max_number_ = 32;
+
+    void reserve(size_t n) {
+        if (size_ + n > capacity_) {
+            flush();
+        }
+    }
+
+    template <typename T>
+    void put_bytes(T v) {
+        reserve(sizeof(T));
+        std::memcpy(buffer_.data() + size_, &v, sizeof(T));
+        size_ += sizeof(T);
+    }
+
+    template <typename T>
+    void put_text(T v) {
+        reserve(max_number_ + 1);
+        if (not record_begin_) {
+            buffer_[size_++] = ' ';
+        }
+        record_begin_ = false;
+        size_ += format(buffer_.data() + size_, v);
+    }
+
+    template <typename T>
+    static size_t format(char* first, T v) {
+        static_assert(std::is_arithmetic<T>::value, "Only numbers can be formatted");
+#if defined(__cpp_lib_to_chars)
+        return std::to_chars(first, first + max_number_, v).ptr - first;
+#else
+        if constexpr (std::is_integral<T>::value) {
+            return std::to_chars(first, first + max_number_, v).ptr - first;
+        }
+        else {
+            // Floating point std::to_chars is not available in this standard library
+            return std::snprintf(first, max_number_, "%.*g", std::numeric_limits<T>::max_digits10,
+                                 static_cast<double>(v));
+        }
+#endif
+    }
+
+    std::ostream& out_;
+    bool binary_;
+    bool record_begin_{true};
+    size_t size_{0};
+    std::vector<char> buffer_;
+};
+
 template <typename T>
 array::LocalView<const T, 2> make_level_view(const Field& field, int ndata, int jlev) {
     using namespace array;
@@ -130,14 +235,24 @@ array::LocalView<const T, 2> make_level_view(const Field& field, int ndata, int
 }
 
 template <typename Value, typename GlobalIndex, typename IncludeIndex>
-void write_level(std::ostream& out, GlobalIndex gidx, const array::LocalView<Value, 2>& data, IncludeIndex include) {
+void write_level(std::ostream& out, bool binary, GlobalIndex gidx, const array::LocalView<Value, 2>& data,
+                 IncludeIndex include) {
     using value_type = typename std::remove_const<Value>::type;
     int ndata        = data.shape(0);
     int nvars        = data.shape(1);
+    GmshBuffer buffer(out, binary);
+    auto write_record = [&](idx_t n, const value_type values[], int ncomp) {
+        buffer.index(gidx(n));
+        for (int v = 0; v < ncomp; ++v) {
+            buffer.value(values[v]);
+        }
+        buffer.end_record();
+    };
     if (nvars == 1) {
         for (idx_t n = 0; n < ndata; ++n) {
             if (include(n)) {
-                out << gidx(n) << " " << data(n, 0) << "\n";
+                const value_type value = data(n, 0);
+                write_record(n, &value, 1);
             }
         }
     }
@@ -149,60 +264,34 @@ void write_level(std::ostream& out, GlobalIndex gidx, const array::LocalView<Val
                 for (idx_t v = 0; v < nvars; ++v) {
                     data_vec[v] = data(n, v);
                 }
-                out << gidx(n);
-                for (int v = 0; v < 3; ++v) {
-                    out << " " << data_vec[v];
-                }
-                out << "\n";
+                write_record(n, data_vec.data(), 3);
             }
         }
     }
-    else if (nvars <= 9) {
+    else if (nvars == 4 || nvars == 9) {
+        // 2x2 or 3x3 tensors, written as 3x3 tensors
+        const int dim = (nvars == 4 ? 2 : 3);
         std::array<value_type, 9> data_vec;
         data_vec.fill(static_cast<value_type>(0));
-        if (nvars == 4) {
-            for (int n = 0; n < ndata; ++n) {
-                if (include(n)) {
-                    for (int i = 0; i < 2; ++i) {
-                        for (int j = 0; j < 2; ++j) {
-                            data_vec[i * 3 + j] = data(n, i * 2 + j);
-                        }
-                    }
-                    out << gidx(n);
-                    for (int v = 0; v < 9; ++v) {
-                        out << " " << data_vec[v];
-                    }
-                    out << "\n";
-                }
-            }
-        }
-        else if (nvars == 9) {
-            for (int n = 0; n < ndata; ++n) {
-                if (include(n)) {
-                    for (int i = 0; i < 3; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            data_vec[i * 3 + j] = data(n, i * 2 + j);
-                        }
-                    }
-                    out << gidx(n);
-                    for (int v = 0; v < 9; ++v) {
-                        out << " " << data_vec[v];
+        for (idx_t n = 0; n < ndata; ++n) {
+            if (include(n)) {
+                for (int i = 0; i < dim; ++i) {
+                    for (int j = 0; j < dim; ++j) {
+                        data_vec[i * 3 + j] = data(n, i * dim + j);
                     }
-                    out << "\n";
                 }
+                write_record(n, data_vec.data(), 9);
             }
         }
-        else {
-            ATLAS_NOTIMPLEMENTED;
-        }
     }
     else {
         ATLAS_NOTIMPLEMENTED;
     }
+    buffer.end_section();
 }
 template <typename Value, typename GlobalIndex>
-void write_level(std::ostream& out, GlobalIndex gidx, const array::LocalView<Value, 2>& data) {
-    write_level(out, gidx, data, [](idx_t) { return true; });
+void write_level(std::ostream& out, bool binary, GlobalIndex gidx, const array::LocalView<Value, 2>& data) {
+    write_level(out, binary, gidx, data, [](idx_t) { return true; });
 }
 
 std::vector<int> get_levels(int nlev, const Metadata& gmsh_options) {
@@ -265,7 +354,7 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::NodeCo
     Log::debug() << "writing NodeColumns field " << field.name() << " defined in NodeColumns..." << std::endl;
 
     bool gather(gmsh_options.get<bool>("gather") && mpi::size() > 1);
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary(!gmsh_options.get<bool>("ascii"));
     idx_t nlev  = std::max<idx_t>(1, field.levels());
     idx_t ndata = std::min<idx_t>(function_space.nb_nodes(), field.shape(0));
     idx_t nvars = std::max<idx_t>(1, field.variables());
@@ -320,10 +409,10 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::NodeCo
             out << ndata_nonmissing << "\n";
             out << mpi::rank() << "\n";
             if (missing) {
-                write_level(out, gidx, data, include_idx);
+                write_level(out, binary, gidx, data, include_idx);
             }
             else {
-                write_level(out, gidx, data);
+                write_level(out, binary, gidx, data);
             }
             out << "$EndNodeData\n";
         }
@@ -336,7 +425,7 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::NoFunc
                        const Field& field, std::ostream& out) {
     Log::debug() << "writing field " << field.name() << " defined without functionspace..." << std::endl;
 
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary(!gmsh_options.get<bool>("ascii"));
     idx_t nlev  = std::max<idx_t>(1, field.levels());
     idx_t ndata = field.shape(0);
     idx_t nvars = std::max<idx_t>(1, field.variables());
@@ -379,10 +468,10 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::NoFunc
         out << ndata_nonmissing << "\n";
         out << mpi::rank() << "\n";
         if (missing) {
-            write_level(out, gidx, data, include_idx);
+            write_level(out, binary, gidx, data, include_idx);
         }
         else {
-            write_level(out, gidx, data);
+            write_level(out, binary, gidx, data);
         }
         out << "$EndNodeData\n";
     }
@@ -414,7 +503,7 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::Struct
     Log::debug() << "writing StructuredColumns field " << field.name() << "..." << std::endl;
 
     bool gather(gmsh_options.get<bool>("gather") && mpi::size() > 1);
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary(!gmsh_options.get<bool>("ascii"));
     idx_t nlev  = std::max<idx_t>(1, field.levels());
     idx_t ndata = std::min<idx_t>(function_space.sizeOwned(), field.shape(0));
     idx_t nvars = std::max<idx_t>(1, field.variables());
@@ -453,7 +542,7 @@ void write_field_nodes(const Metadata& gmsh_options, const functionspace::Struct
         out << mpi::rank() << "\n";
         auto data =
             gather ? make_level_view<DATATYPE>(field_glb, ndata, jlev) : make_level_view<DATATYPE>(field, ndata, jlev);
-        write_level(out, gidx, data);
+        write_level(out, binary, gidx, data);
         out << "$EndNodeData\n";
     }
 }
@@ -466,7 +555,7 @@ void write_field_elems(const Metadata& gmsh_options, const functionspace::CellCo
     Log::debug() << "writing CellColumns field " << field.name() << "..." << std::endl;
 
     bool gather(gmsh_options.get<bool>("gather") && mpi::size() > 1);
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary(!gmsh_options.get<bool>("ascii"));
     idx_t nlev  = std::max<idx_t>(1, field.levels());
     idx_t ndata = std::min<idx_t>(function_space.nb_cells(), field.shape(0));
     idx_t nvars = std::max<idx_t>(1, field.variables());
@@ -500,7 +589,7 @@ void write_field_elems(const Metadata& gmsh_options, const functionspace::CellCo
             out << mpi::rank() << "\n";
             auto data = gather ? make_level_view<DATATYPE>(field_glb, ndata, jlev)
                                : make_level_view<DATATYPE>(field, ndata, jlev);
-            write_level(out, gidx, data);
+            write_level(out, binary, gidx, data);
             out << "$EndElementData\n";
         }
     }
@@ -951,31 +1040,27 @@ void GmshIO::write(const Mesh& mesh, const PathName& file_path) const {
     const idx_t nb_nodes = nodes.size();
     file << "$Nodes\n";
     file << nb_nodes << "\n";
-    double xyz[3] = {0., 0., 0.};
-    for (idx_t n = 0; n < nb_nodes; ++n) {
-        gidx_t g = glb_idx(n);
-
-        if (coords_is_idx) {
-            for (idx_t d = 0; d < surfdim; ++d) {
-                xyz[d] = coords_idx(n, d);
+    {
+        GmshBuffer buffer(file, binary);
+        double xyz[3] = {0., 0., 0.};
+        for (idx_t n = 0; n < nb_nodes; ++n) {
+            if (coords_is_idx) {
+                for (idx_t d = 0; d < surfdim; ++d) {
+                    xyz[d] = coords_idx(n, d);
+                }
             }
-        }
-        else {
-            for (idx_t d = 0; d < surfdim; ++d) {
-                xyz[d] = coords(n, d);
+            else {
+                for (idx_t d = 0; d < surfdim; ++d) {
+                    xyz[d] = coords(n, d);
+                }
             }
+            buffer.index(glb_idx(n));
+            buffer.value(xyz[XX]);
+            buffer.value(xyz[YY]);
+            buffer.value(xyz[ZZ]);
+            buffer.end_record();
         }
-
-        if (binary) {
-            file.write(reinterpret_cast<const char*>(&g), sizeof(gidx_t));
-            file.write(reinterpret_cast<const char*>(&xyz), sizeof(double) * 3);
-        }
-        else {
-            file << g << " " << xyz[XX] << " " << xyz[YY] << " " << xyz[ZZ] << "\n";
-        }
-    }
-    if (binary) {
-        file << "\n";
+        buffer.end_section();
     }
     file << "$EndNodes\n";
 
@@ -1153,49 +1238,36 @@ void GmshIO::write(const Mesh& mesh, const PathName& file_path) const {
                     }
                     return true;
                 };
+                idx_t nb_elems = 0;
+                for (idx_t elem = 0; elem < elements.size(); ++elem) {
+                    nb_elems += include(elem);
+                }
+                if (nb_elems == 0) {
+                    continue;
+                }
+                const int tags[] = {1, 1, 1};
+                GmshBuffer buffer(file, binary);
                 if (binary) {
-                    idx_t nb_elems = elements.size();
-                    if (!include_ghost) {
-                        for (idx_t elem = 0; elem < elements.size(); ++elem) {
-                            if (elems_halo(elem)) {
-                                --nb_elems;
-                            }
+                    // Binary elements are written in blocks of one element type
+                    buffer.index(gmsh_elem_type);
+                    buffer.index(nb_elems);
+                    buffer.index(4);  // nb_tags
+                }
+                for (idx_t elem = 0; elem < elements.size(); ++elem) {
+                    if (include(elem)) {
+                        buffer.index(elems_glb_idx(elem));
+                        if (not binary) {
+                            buffer.index(gmsh_elem_type);
+                            buffer.index(4);  // nb_tags
                         }
-                    }
-
-                    int header[3];
-                    int data[9];
-                    header[0] = gmsh_elem_type;
-                    header[1] = nb_elems;
-                    header[2] = 4;  // nb_tags
-                    file.write(reinterpret_cast<const char*>(&header), sizeof(int) * 3);
-                    data[1]         = 1;
-                    data[2]         = 1;
-                    data[3]         = 1;
-                    size_t datasize = sizeof(int) * (5 + nb_nodes);
-                    for (idx_t elem = 0; elem < nb_elems; ++elem) {
-                        if (include_ghost || !elems_halo(elem)) {
-                            data[0] = elems_glb_idx(elem);
-                            data[4] = elems_partition(elem);
-                            for (idx_t n = 0; n < nb_nodes; ++n) {
-                                data[5 + n] = glb_idx(node_connectivity(elem, n));
-                            }
-                            file.write(reinterpret_cast<const char*>(&data), datasize);
+                        for (int tag : tags) {
+                            buffer.index(tag);
                         }
-                    }
-                }
-                else {
-                    std::stringstream ss_elem_info;
-                    ss_elem_info << " " << gmsh_elem_type << " 4 1 1 1 ";
-                    std::string elem_info = ss_elem_info.str();
-                    for (idx_t elem = 0; elem < elements.size(); ++elem) {
-                        if (include(elem)) {
-                            file << elems_glb_idx(elem) << elem_info << elems_partition(elem);
-                            for (idx_t n = 0; n < nb_nodes; ++n) {
-                                file << " " << glb_idx(node_connectivity(elem, n));
-                            }
-                            file << "\n";
+                        buffer.index(elems_partition(elem));
+                        for (idx_t n = 0; n < nb_nodes; ++n) {
+                            buffer.index(glb_idx(node_connectivity(elem, n)));
                         }
+                        buffer.end_record();
                     }
                 }
             }
@@ -1341,7 +1413,12 @@ void GmshIO::write_delegate(const FieldSet& fieldset, const functionspace::NodeC
 
     // Header
     if (is_new_file) {
-        write_header_ascii(file);
+        if (binary) {
+            write_header_binary(file);
+        }
+        else {
+            write_header_ascii(file);
+        }
     }
 
     // field::Fields
@@ -1379,7 +1456,12 @@ void GmshIO::write_delegate(const FieldSet& fieldset, const functionspace::NoFun
 
     // Header
     if (is_new_file) {
-        write_header_ascii(file);
+        if (binary) {
+            write_header_binary(file);
+        }
+        else {
+            write_header_ascii(file);
+        }
     }
 
     // field::Fields
@@ -1417,7 +1499,12 @@ void GmshIO::write_delegate(const FieldSet& fieldset, const functionspace::CellC
 
     // Header
     if (is_new_file) {
-        write_header_ascii(file);
+        if (binary) {
+            write_header_binary(file);
+        }
+        else {
+            write_header_ascii(file);
+        }
     }
 
     // field::Fields
@@ -1460,7 +1547,12 @@ void GmshIO::write_delegate(const FieldSet& fieldset, const functionspace::Struc
 
     // Header
     if (is_new_file) {
-        write_header_ascii(file);
+        if (binary) {
+            write_header_binary(file);
+        }
+        else {
+            write_header_ascii(file);
+        }
     }
 
     // field::Fields
@@ -0,0 +1,517 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/FunctionSpace.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/BuildXYZField.h"
+#include "atlas/output/detail/VTKImpl.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Topology.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+// -----------------------------------------------------------------------------
+
+namespace /*anonymous*/ {
+
+// -----------------------------------------------------------------------------
+
+void merge(VTKImpl::Configuration& present, const eckit::Parametrisation& update) {
+    update.get("ghost", present.ghost);
+    update.get("levels", present.levels);
+    update.get("file", present.file);
+    update.get("coordinates", present.coordinates);
+}
+
+// -----------------------------------------------------------------------------
+
+/// Data array of a VTK piece, stored as one block of the appended raw data
+struct DataArray {
+    std::string name;  // empty for point coordinates
+    std::string type;
+    idx_t components;
+    size_t bytes;
+    std::function<void(char*)> pack;  // fills the block of given number of bytes
+};
+
+/// Mesh and field data of the piece of one MPI task.
+/// The pack functions refer to members, so a Piece is constructed in place and not moved.
+struct Piece {
+    Piece()             = default;
+    Piece(const Piece&) = delete;
+
+    idx_t nb_points{0};
+    std::vector<idx_t> cells;  // mesh cells included in the piece
+    DataArray points;
+    std::vector<DataArray> cell_arrays;
+    std::vector<DataArray> point_data;
+    std::vector<DataArray> cell_data;
+};
+
+template <typename T>
+std::string vtk_type() {
+    static_assert(std::is_arithmetic<T>::value, "VTK data arrays hold numbers");
+    std::string type = std::is_floating_point<T>::value ? "Float" : (std::is_signed<T>::value ? "Int" : "UInt");
+    return type + std::to_string(8 * sizeof(T));
+}
+
+const char* byte_order() {
+    const std::uint16_t one = 1;
+    return *reinterpret_cast<const unsigned char*>(&one) == 1 ? "LittleEndian" : "BigEndian";
+}
+
+std::string escape(const std::string& str) {
+    std::string escaped;
+    escaped.reserve(str.size());
+    for (char c : str) {
+        switch (c) {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+unsigned char vtk_cell_type(idx_t nb_nodes) {
+    switch (nb_nodes) {
+        case 2:
+            return 3;  // VTK_LINE
+        case 3:
+            return 5;  // VTK_TRIANGLE
+        case 4:
+            return 9;  // VTK_QUAD
+        default:
+            return 7;  // VTK_POLYGON
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+/// Points [0,nb_points) of the mesh, and the cells [0,nb_cells) that only connect these points
+void setup_mesh(Piece& piece, const Mesh& mesh, idx_t nb_points, idx_t nb_cells, const VTKImpl::Configuration& c) {
+    const mesh::Nodes& nodes = mesh.nodes();
+    if (c.coordinates == "xyz" and not nodes.has_field("xyz")) {
+        Log::debug() << "Building xyz representation for nodes" << std::endl;
+        mesh::actions::BuildXYZField("xyz")(const_cast<Mesh&>(mesh));
+    }
+    if (c.coordinates != "xy" && c.coordinates != "lonlat" && c.coordinates != "xyz") {
+        throw_Exception("VTK output: coordinates \"" + c.coordinates + "\" not supported", Here());
+    }
+    auto coords = array::make_view<double, 2>(nodes.field(c.coordinates));
+
+    piece.nb_points = nb_points;
+    piece.points    = {"", vtk_type<double>(), 3, sizeof(double) * 3 * nb_points, [coords, nb_points](char* data) {
+                        double* xyz = reinterpret_cast<double*>(data);
+                        for (idx_t n = 0; n < nb_points; ++n) {
+                            for (idx_t d = 0; d < 3; ++d) {
+                                xyz[3 * n + d] = d < coords.shape(1) ? coords(n, d) : 0.;
+                            }
+                        }
+                    }};
+
+    const mesh::HybridElements& cells = mesh.cells();
+    const auto& node_connectivity     = cells.node_connectivity();
+    auto halo                         = array::make_view<int, 1>(cells.halo());
+    auto flags                        = array::make_view<int, 1>(cells.flags());
+    size_t nb_connections             = 0;
+    piece.cells.reserve(nb_cells);
+    for (idx_t e = 0; e < nb_cells; ++e) {
+        if ((halo(e) && not c.ghost) || util::Topology::view(flags(e)).check(util::Topology::INVALID)) {
+            continue;
+        }
+        bool include = true;
+        for (idx_t n = 0; n < node_connectivity.cols(e); ++n) {
+            include = include && node_connectivity(e, n) < nb_points;
+        }
+        if (include) {
+            piece.cells.emplace_back(e);
+            nb_connections += node_connectivity.cols(e);
+        }
+    }
+
+    const std::vector<idx_t>& included = piece.cells;
+    piece.cell_arrays.push_back(
+        {"connectivity", vtk_type<std::int64_t>(), 1, sizeof(std::int64_t) * nb_connections, [&](char* data) {
+             std::int64_t* connectivity = reinterpret_cast<std::int64_t*>(data);
+             for (idx_t e : included) {
+                 for (idx_t n = 0; n < node_connectivity.cols(e); ++n) {
+                     *connectivity++ = node_connectivity(e, n);
+                 }
+             }
+         }});
+    piece.cell_arrays.push_back(
+        {"offsets", vtk_type<std::int64_t>(), 1, sizeof(std::int64_t) * included.size(), [&](char* data) {
+             std::int64_t* offsets = reinterpret_cast<std::int64_t*>(data);
+             std::int64_t offset   = 0;
+             for (idx_t e : included) {
+                 offset += node_connectivity.cols(e);
+                 *offsets++ = offset;
+             }
+         }});
+    piece.cell_arrays.push_back({"types", vtk_type<unsigned char>(), 1, included.size(), [&](char* data) {
+                                     for (idx_t e : included) {
+                                         *data++ = vtk_cell_type(node_connectivity.cols(e));
+                                     }
+                                 }});
+}
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+array::LocalView<const T, 2> make_level_view(const Field& field, idx_t jlev) {
+    using namespace array;
+    if (field.levels()) {
+        if (field.variables()) {
+            return make_view<const T, 3>(field).slice(Range::all(), jlev, Range::all());
+        }
+        return make_view<const T, 2>(field).slice(Range::all(), jlev, Range::dummy());
+    }
+    if (field.variables()) {
+        return make_view<const T, 2>(field).slice(Range::all(), Range::all());
+    }
+    return make_view<const T, 1>(field).slice(Range::all(), Range::dummy());
+}
+
+/// One data array per level of the field, for the given rows of the field, or rows [0,size) if rows is null.
+/// The rows must outlive the data arrays.
+template <typename T>
+void add_field(std::vector<DataArray>& arrays, const Field& field, const std::vector<idx_t>* rows, idx_t size,
+               const VTKImpl::Configuration& c) {
+    std::vector<idx_t> levels;
+    if (field.levels() && not c.levels.empty()) {
+        for (long jlev : c.levels) {
+            ATLAS_ASSERT(jlev >= 0 && jlev < field.levels());
+            levels.emplace_back(jlev);
+        }
+    }
+    else {
+        for (idx_t jlev = 0; jlev < std::max<idx_t>(1, field.levels()); ++jlev) {
+            levels.emplace_back(jlev);
+        }
+    }
+    const idx_t nvars = std::max<idx_t>(1, field.variables());
+    const idx_t nrows = rows ? static_cast<idx_t>(rows->size()) : size;
+    ATLAS_ASSERT(rows || size <= field.shape(0));
+    for (idx_t jlev : levels) {
+        std::string name = field.name();
+        if (field.levels()) {
+            char lev[8];
+            std::snprintf(lev, sizeof(lev), "[%03d]", static_cast<int>(jlev));
+            name += lev;
+        }
+        auto view = make_level_view<T>(field, jlev);
+        auto pack = [view, rows, nrows, nvars](char* data) {
+            T* values = reinterpret_cast<T*>(data);
+            for (idx_t i = 0; i < nrows; ++i) {
+                const idx_t row = rows ? (*rows)[i] : i;
+                for (idx_t v = 0; v < nvars; ++v) {
+                    *values++ = view(row, v);
+                }
+            }
+        };
+        arrays.push_back({name, vtk_type<T>(), nvars, sizeof(T) * nvars * nrows, pack});
+    }
+}
+
+void add_field(std::vector<DataArray>& arrays, const Field& field, const std::vector<idx_t>* rows, idx_t size,
+               const VTKImpl::Configuration& c) {
+    const auto kind = field.datatype().kind();
+    if (kind == array::DataType::kind<int>()) {
+        add_field<int>(arrays, field, rows, size, c);
+    }
+    else if (kind == array::DataType::kind<long>()) {
+        add_field<long>(arrays, field, rows, size, c);
+    }
+    else if (kind == array::DataType::kind<float>()) {
+        add_field<float>(arrays, field, rows, size, c);
+    }
+    else if (kind == array::DataType::kind<double>()) {
+        add_field<double>(arrays, field, rows, size, c);
+    }
+    else {
+        throw_Exception("VTK output: datatype of field " + field.name() + " not supported", Here());
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void write_piece(const Piece& piece, const std::string& path) {
+    std::ofstream out(path, std::ios_base::out | std::ios_base::binary);
+    if (!out.is_open()) {
+        throw_CantOpenFile(path, Here());
+    }
+
+    size_t offset          = 0;
+    auto write_data_arrays = [&](const std::string& tag, const std::vector<DataArray>& arrays) {
+        if (arrays.empty()) {
+            return;
+        }
+        out << "<" << tag << ">\n";
+        for (const auto& a : arrays) {
+            out << "<DataArray type=\"" << a.type << "\"";
+            if (not a.name.empty()) {
+                out << " Name=\"" << escape(a.name) << "\"";
+            }
+            out << " NumberOfComponents=\"" << a.components << "\" format=\"appended\" offset=\"" << offset
+                << "\"/>\n";
+            offset += sizeof(std::uint64_t) + a.bytes;
+        }
+        out << "</" << tag << ">\n";
+    };
+
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << byte_order()
+        << "\" header_type=\"UInt64\">\n";
+    out << "<UnstructuredGrid>\n";
+    out << "<Piece NumberOfPoints=\"" << piece.nb_points << "\" NumberOfCells=\"" << piece.cells.size() << "\">\n";
+    write_data_arrays("Points", {piece.points});
+    write_data_arrays("Cells", piece.cell_arrays);
+    write_data_arrays("PointData", piece.point_data);
+    write_data_arrays("CellData", piece.cell_data);
+    out << "</Piece>\n";
+    out << "</UnstructuredGrid>\n";
+    out << "<AppendedData encoding=\"raw\">\n_";
+
+    // Each block is packed into a reused buffer and written at once
+    std::vector<char> buffer;
+    auto append = [&](const DataArray& a) {
+        const std::uint64_t bytes = a.bytes;
+        out.write(reinterpret_cast<const char*>(&bytes), sizeof(bytes));
+        buffer.resize(a.bytes);
+        a.pack(buffer.data());
+        out.write(buffer.data(), a.bytes);
+    };
+    append(piece.points);
+    for (const auto* arrays : {&piece.cell_arrays, &piece.point_data, &piece.cell_data}) {
+        for (const auto& a : *arrays) {
+            append(a);
+        }
+    }
+    out << "\n</AppendedData>\n";
+    out << "</VTKFile>\n";
+    out.close();
+}
+
+void write_index(const Piece& piece, const std::string& path, const std::vector<std::string>& sources) {
+    std::ofstream out(path, std::ios_base::out);
+    if (!out.is_open()) {
+        throw_CantOpenFile(path, Here());
+    }
+    auto write_data_arrays = [&](const std::string& tag, const std::vector<DataArray>& arrays) {
+        if (arrays.empty()) {
+            return;
+        }
+        out << "<" << tag << ">\n";
+        for (const auto& a : arrays) {
+            out << "<PDataArray type=\"" << a.type << "\"";
+            if (not a.name.empty()) {
+                out << " Name=\"" << escape(a.name) << "\"";
+            }
+            out << " NumberOfComponents=\"" << a.components << "\"/>\n";
+        }
+        out << "</" << tag << ">\n";
+    };
+
+    out << "<?xml version=\"1.0\"?>\n";
+    out << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << byte_order()
+        << "\" header_type=\"UInt64\">\n";
+    out << "<PUnstructuredGrid GhostLevel=\"0\">\n";
+    write_data_arrays("PPoints", {piece.points});
+    write_data_arrays("PPointData", piece.point_data);
+    write_data_arrays("PCellData", piece.cell_data);
+    for (const auto& source : sources) {
+        out << "<Piece Source=\"" << escape(source) << "\"/>\n";
+    }
+    out << "</PUnstructuredGrid>\n";
+    out << "</VTKFile>\n";
+    out.close();
+}
+
+/// Every task writes its own piece; with more than one task, task 0 also writes the index file "<basename>.pvtu"
+void write_data_set(const Piece& piece, const std::string& file) {
+    ATLAS_TRACE("VTK::write");
+    const idx_t nb_parts = mpi::comm().size();
+    const idx_t part     = mpi::comm().rank();
+    if (nb_parts == 1) {
+        write_piece(piece, file);
+        return;
+    }
+
+    eckit::PathName path(file);
+    const std::string dir      = path.dirName().asString() + "/";
+    const std::string basename = path.baseName(false).asString();
+    auto source                = [&](idx_t p) { return basename + "_p" + std::to_string(p) + ".vtu"; };
+    write_piece(piece, dir + source(part));
+    if (part == 0) {
+        std::vector<std::string> sources;
+        sources.reserve(nb_parts);
+        for (idx_t p = 0; p < nb_parts; ++p) {
+            sources.emplace_back(source(p));
+        }
+        write_index(piece, dir + basename + ".pvtu", sources);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+}  // anonymous namespace
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::defaults() {
+    config_.ghost       = false;
+    config_.file        = "output.vtu";
+    config_.coordinates = "xy";
+    config_.levels.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+VTKImpl::VTKImpl(std::ostream&) {
+    defaults();
+    ATLAS_NOTIMPLEMENTED;
+}
+
+// -----------------------------------------------------------------------------
+
+VTKImpl::VTKImpl(std::ostream&, const eckit::Parametrisation& config) {
+    defaults();
+    merge(config_, config);
+    ATLAS_NOTIMPLEMENTED;
+}
+
+// -----------------------------------------------------------------------------
+
+VTKImpl::VTKImpl(const eckit::PathName& file) {
+    defaults();
+    config_.file = file.asString();
+}
+
+// -----------------------------------------------------------------------------
+
+VTKImpl::VTKImpl(const eckit::PathName& file, const eckit::Parametrisation& config) {
+    defaults();
+    merge(config_, config);
+    config_.file = file.asString();
+}
+
+// -----------------------------------------------------------------------------
+
+VTKImpl::~VTKImpl() = default;
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::write(const Mesh& mesh, const eckit::Parametrisation& config) const {
+    VTKImpl::Configuration c = config_;
+    merge(c, config);
+    mpi::Scope scope(mesh.mpi_comm());
+
+    Piece piece;
+    setup_mesh(piece, mesh, mesh.nodes().size(), mesh.cells().size(), c);
+    write_data_set(piece, c.file);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::write(const Field& field, const eckit::Parametrisation& config) const {
+    write(field, field.functionspace(), config);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::write(const FieldSet& fields, const eckit::Parametrisation& config) const {
+    ATLAS_ASSERT(fields.size() > 0);
+    write(fields, fields.field(0).functionspace(), config);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::write(const Field& field, const FunctionSpace& functionspace,
+                    const eckit::Parametrisation& config) const {
+    FieldSet fields;
+    fields.add(field);
+    write(fields, functionspace, config);
+}
+
+// -----------------------------------------------------------------------------
+
+void VTKImpl::write(const FieldSet& fields, const FunctionSpace& functionspace,
+                    const eckit::Parametrisation& config) const {
+    VTKImpl::Configuration c = config_;
+    merge(c, config);
+    mpi::Scope scope(functionspace.mpi_comm());
+
+    Piece piece;
+    if (functionspace::NodeColumns nodes = functionspace) {
+        const Mesh& mesh = nodes.mesh();
+        setup_mesh(piece, mesh, nodes.nb_nodes(), mesh.cells().size(), c);
+        for (idx_t f = 0; f < fields.size(); ++f) {
+            add_field(piece.point_data, fields[f], nullptr, piece.nb_points, c);
+        }
+    }
+    else if (functionspace::CellColumns cells = functionspace) {
+        const Mesh& mesh = cells.mesh();
+        setup_mesh(piece, mesh, mesh.nodes().size(), cells.nb_cells(), c);
+        for (idx_t f = 0; f < fields.size(); ++f) {
+            add_field(piece.cell_data, fields[f], &piece.cells, 0, c);
+        }
+    }
+    else {
+        throw_Exception("VTK output requires fields on functionspace::NodeColumns or functionspace::CellColumns",
+                        Here());
+    }
+    write_data_set(piece, c.file);
+}
+
+// -----------------------------------------------------------------------------
+
+static OutputBuilder<detail::VTKImpl> __vtk("vtk");
+
+// -----------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
@@ -0,0 +1,68 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/output/Output.h"
+#include "atlas/util/Config.h"
+
+namespace atlas {
+namespace output {
+namespace detail {
+
+// -----------------------------------------------------------------------------
+
+class VTKImpl : public OutputImpl {
+public:
+    VTKImpl(std::ostream&);
+    VTKImpl(std::ostream&, const eckit::Parametrisation&);
+
+    VTKImpl(const eckit::PathName&);
+    VTKImpl(const eckit::PathName&, const eckit::Parametrisation&);
+
+    virtual ~VTKImpl();
+
+    /// Write mesh file
+    virtual void write(const Mesh&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write field, together with the mesh of its function space
+    virtual void write(const Field&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write fieldset, together with the mesh of the function space of its fields
+    virtual void write(const FieldSet&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write field, together with the mesh of the function space
+    virtual void write(const Field&, const FunctionSpace&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+    /// Write fieldset, together with the mesh of the function space
+    virtual void write(const FieldSet&, const FunctionSpace&, const eckit::Parametrisation& = util::NoConfig()) const;
+
+public:
+    struct Configuration {
+        bool ghost;
+        std::vector<long> levels;
+        std::string file;
+        std::string coordinates;
+    };
+
+private:
+    Configuration config_;
+
+    void defaults();
+};
+
+// -----------------------------------------------------------------------------
+
+}  // namespace detail
+}  // namespace output
+}  // namespace atlas
@@ -10,25 +10,38 @@
 
 #include <cstring>
 
+#include "eckit/config/Resource.h"
+
 #include "atlas/parallel/Checksum.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 
 namespace atlas {
 namespace parallel {
 
-Checksum::Checksum(): name_() {
-    is_setup_ = false;
+Checksum::Mode Checksum::default_mode() {
+    static Mode mode = [] {
+        std::string mode = eckit::Resource<std::string>("$ATLAS_CHECKSUM_MODE", "gather");
+        return mode == "reduce" ? Mode::reduce : Mode::gather;
+    }();
+    return mode;
 }
 
-Checksum::Checksum(const std::string& name): name_(name) {
+Checksum::Checksum(): Checksum(std::string()) {}
+
+Checksum::Checksum(const std::string& name): Checksum(name, default_mode()) {}
+
+Checksum::Checksum(const std::string& name, Mode mode): name_(name), mode_(mode) {
     is_setup_ = false;
 }
 
 void Checksum::setup(const std::string& mpi_comm, const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                      const int parsize) {
-    parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>(new GatherScatter());
-    gather_->setup(mpi_comm, part, remote_idx, base, glb_idx, parsize);
-    is_setup_ = true;
+    std::vector<int> mask(parsize);
+    detail::IsGhostPoint is_ghost(mpi::comm(mpi_comm).rank(), part, remote_idx, base);
+    for (int n = 0; n < parsize; ++n) {
+        mask[n] = is_ghost(n) ? 1 : 0;
+    }
+    setup(mpi_comm, part, remote_idx, base, glb_idx, mask.data(), parsize);
 }
 
 void Checksum::setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
@@ -39,8 +52,22 @@ void Checksum::setup(const int part[], const idx_t remote_idx[], const int base,
 void Checksum::setup(const std::string& mpi_comm, const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                      const int mask[], const int parsize) {
     parsize_ = parsize;
-    gather_  = util::ObjectHandle<GatherScatter>(new GatherScatter());
-    gather_->setup(mpi_comm, part, remote_idx, base, glb_idx, mask, parsize);
+    if (mode_ == Mode::reduce) {
+        // Only owned points contribute, so that no communication is needed to set up
+        comm_ = &mpi::comm(mpi_comm);
+        owned_.clear();
+        owned_glb_idx_.clear();
+        for (int n = 0; n < parsize; ++n) {
+            if (not mask[n]) {
+                owned_.emplace_back(n);
+                owned_glb_idx_.emplace_back(glb_idx[n]);
+            }
+        }
+    }
+    else {
+        gather_ = util::ObjectHandle<GatherScatter>(new GatherScatter());
+        gather_->setup(mpi_comm, part, remote_idx, base, glb_idx, mask, parsize);
+    }
     is_setup_ = true;
 }
 
@@ -50,6 +77,7 @@ void Checksum::setup(const int part[], const idx_t remote_idx[], const int base,
 }
 
 void Checksum::setup(const util::ObjectHandle<GatherScatter>& gather) {
+    ATLAS_ASSERT(mode_ == Mode::gather, "Checksum in reduce mode cannot be setup from a GatherScatter");
     gather_   = gather;
     parsize_  = gather->parsize_;
     is_setup_ = true;
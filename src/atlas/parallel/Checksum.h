@@ -26,13 +26,32 @@ namespace parallel {
 
 class Checksum : public util::Object {
 public:
+    /// @brief How contributions of all partitions are combined into one checksum
+    enum class Mode
+    {
+        /// Gather a checksum per point to the root partition in global order, and checksum these.
+        /// Requires O(global points) memory and communication on the root partition.
+        gather,
+        /// Sum hashes of owned points, each seeded with its global index, and reduce the sum with allReduce.
+        /// Independent of partitioning, with O(local points) work and a single small collective.
+        /// The resulting checksums differ from those in gather mode.
+        reduce
+    };
+
+    /// @brief Mode of default constructed Checksum: Mode::gather, unless environment variable
+    /// ATLAS_CHECKSUM_MODE is set to "reduce"
+    static Mode default_mode();
+
     Checksum();
     Checksum(const std::string& name);
+    Checksum(const std::string& name, Mode);
     virtual ~Checksum() {}
 
 public:  // methods
     std::string name() const { return name_; }
 
+    Mode mode() const { return mode_; }
+
     /// @brief Setup
     /// @param [in] mpi_comm     MPI communicator
     /// @param [in] part         List of partitions
@@ -79,7 +98,8 @@ public:  // methods
     void setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[], const int mask[],
                const int parsize);
 
-    /// @brief Setup
+    /// @brief Setup from existing GatherScatter
+    /// @pre mode() == Mode::gather
     void setup(const util::ObjectHandle<GatherScatter>&);
 
     template <typename DATA_TYPE>
@@ -96,11 +116,21 @@ public:  // methods
     void var_info(const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<int>& varstrides,
                   std::vector<int>& varextents) const;
 
+private:  // methods
+    template <typename DATA_TYPE>
+    std::string reduce(const DATA_TYPE data[], int var_size) const;
+
 private:  // data
     std::string name_;
+    Mode mode_;
     util::ObjectHandle<GatherScatter> gather_;
     bool is_setup_;
     size_t parsize_;
+
+    // Used in Mode::reduce
+    const mpi::Comm* comm_{nullptr};
+    std::vector<idx_t> owned_;
+    std::vector<gidx_t> owned_glb_idx_;
 };
 
 template <typename DATA_TYPE>
@@ -111,9 +141,14 @@ std::string Checksum::execute(const DATA_TYPE data[], const int var_strides[], c
     if (!is_setup_) {
         throw_Exception("Checksum was not setup", Here());
     }
-    std::vector<util::checksum_t> local_checksums(parsize_);
     int var_size = var_extents[0] * var_strides[0];
 
+    if (mode_ == Mode::reduce) {
+        return reduce(data, var_size);
+    }
+
+    std::vector<util::checksum_t> local_checksums(parsize_);
+
     for (size_t pp = 0; pp < parsize_; ++pp) {
         local_checksums[pp] = util::checksum(data + pp * var_size, var_size);
     }
@@ -130,6 +165,17 @@ std::string Checksum::execute(const DATA_TYPE data[], const int var_strides[], c
     return eckit::Translator<util::checksum_t, std::string>()(glb_checksum);
 }
 
+template <typename DATA_TYPE>
+std::string Checksum::reduce(const DATA_TYPE data[], int var_size) const {
+    const size_t var_bytes = size_t(var_size) * sizeof(DATA_TYPE);
+    util::checksum_t sum   = 0;
+    for (size_t j = 0; j < owned_.size(); ++j) {
+        sum += util::hash(data + owned_[j] * var_size, var_bytes, static_cast<util::checksum_t>(owned_glb_idx_[j]));
+    }
+    ATLAS_TRACE_MPI(ALLREDUCE) { comm_->allReduceInPlace(sum, eckit::mpi::sum()); }
+    return eckit::Translator<util::checksum_t, std::string>()(sum);
+}
+
 template <typename DATA_TYPE>
 std::string Checksum::execute(DATA_TYPE lfield[], const int nb_vars) const {
     int strides[] = {1};
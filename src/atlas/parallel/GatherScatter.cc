@@ -10,15 +10,15 @@
 
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
 
-#include "eckit/log/Bytes.h"
-
 #include "atlas/array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/parallel/GatherScatter.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -29,29 +29,6 @@ namespace atlas {
 namespace parallel {
 
 namespace {
-struct IsGhostPoint {
-    IsGhostPoint(const int mypart, const int part[], const idx_t ridx[], const idx_t base, const int N) {
-        part_   = part;
-        ridx_   = ridx;
-        base_   = base;
-        mypart_ = mypart;
-    }
-
-    bool operator()(idx_t idx) {
-        if (part_[idx] != mypart_) {
-            return true;
-        }
-        if (ridx_[idx] != base_ + idx) {
-            return true;
-        }
-        return false;
-    }
-    int mypart_;
-    const int* part_;
-    const idx_t* ridx_;
-    idx_t base_;
-};
-
 struct Node {
     int p;
     idx_t i;
@@ -90,127 +67,89 @@ void GatherScatter::setup(const std::string& mpi_comm, const int part[], const i
     nproc  = comm().size();
     parsize_ = parsize;
 
-    glbcounts_.resize(nproc);
     glbcounts_.assign(nproc, 0);
-    glbdispls_.resize(nproc);
     glbdispls_.assign(nproc, 0);
+    glbmap_.clear();
+    glbmap_roots_.assign(nproc, 0);
 
-    std::vector<gidx_t> sendnodes_gidx(parsize_);
-    std::vector<int> sendnodes_part(parsize_);
-    std::vector<idx_t> sendnodes_ridx(parsize_);
-
-    loccnt_ = 0;
+    // Range of global indices of included points
+    gidx_t glb_idx_min = std::numeric_limits<gidx_t>::max();
+    gidx_t glb_idx_max = std::numeric_limits<gidx_t>::min();
+    size_t nb_included = 0;
     for (idx_t n = 0; n < parsize_; ++n) {
         if (!mask[n]) {
-            sendnodes_gidx[loccnt_] = glb_idx[n];
-            sendnodes_part[loccnt_] = part[n];
-            sendnodes_ridx[loccnt_] = remote_idx[n] - base;
-            ++loccnt_;
+            glb_idx_min = std::min(glb_idx_min, glb_idx[n]);
+            glb_idx_max = std::max(glb_idx_max, glb_idx[n]);
+            ++nb_included;
         }
     }
-
-    ATLAS_TRACE_MPI(ALLGATHER) {
-        comm().allGather(loccnt_, glbcounts_.begin(), glbcounts_.end());
+    ATLAS_TRACE_MPI(ALLREDUCE) {
+        comm().allReduceInPlace(nb_included, eckit::mpi::sum());
+        comm().allReduceInPlace(glb_idx_min, eckit::mpi::min());
+        comm().allReduceInPlace(glb_idx_max, eckit::mpi::max());
     }
-
-    size_t glbcnt_size_t = std::accumulate(glbcounts_.begin(), glbcounts_.end(), size_t(0));
-    if (glbcnt_size_t > std::numeric_limits<int>::max()) {
+    if (nb_included > std::numeric_limits<int>::max()) {
         ATLAS_THROW_EXCEPTION("Due to limitation of MPI we cannot use larger counts");
     }
 
-    glbcnt_ = std::accumulate(glbcounts_.begin(), glbcounts_.end(), size_t(0));
+    // Send included points to the directory partition owning a contiguous range of global indices
+    const gidx_t directory_chunk = nb_included ? (glb_idx_max - glb_idx_min) / nproc + 1 : 1;
+    auto directory = [&](gidx_t gidx) -> idx_t { return static_cast<idx_t>((gidx - glb_idx_min) / directory_chunk); };
 
-    glbdispls_[0] = 0;
-    for (idx_t jproc = 1; jproc < nproc; ++jproc)  // start at 1
-    {
-        glbdispls_[jproc] = glbcounts_[jproc - 1] + glbdispls_[jproc - 1];
-    }
-
-    idx_t nb_recv_nodes = glbcnt_;
     std::vector<Node> node_sort;
-
-    try {
-        node_sort.resize(nb_recv_nodes);
-    }
-    catch (const std::bad_alloc& e) {
-        ATLAS_THROW_EXCEPTION("Could not allocate node_sort with size " << eckit::Bytes(nb_recv_nodes * sizeof(Node)));
-    }
-
     {
-        std::vector<gidx_t> recvnodes_gidx;
-        try {
-            recvnodes_gidx.resize(glbcnt_);
+        std::vector<std::vector<gidx_t>> send_gidx(nproc);
+        std::vector<std::vector<int>> send_part(nproc);
+        std::vector<std::vector<idx_t>> send_ridx(nproc);
+        for (idx_t n = 0; n < parsize_; ++n) {
+            if (!mask[n]) {
+                idx_t jproc = directory(glb_idx[n]);
+                send_gidx[jproc].emplace_back(glb_idx[n]);
+                send_part[jproc].emplace_back(part[n]);
+                send_ridx[jproc].emplace_back(remote_idx[n] - base);
+            }
         }
-        catch (const std::bad_alloc& e) {
-            ATLAS_THROW_EXCEPTION("Could not allocate recvnodes_gidx with size "
-                                  << eckit::Bytes(glbcnt_ * sizeof(gidx_t)));
+        std::vector<std::vector<gidx_t>> recv_gidx(nproc);
+        std::vector<std::vector<int>> recv_part(nproc);
+        std::vector<std::vector<idx_t>> recv_ridx(nproc);
+        ATLAS_TRACE_MPI(ALLTOALL) {
+            comm().allToAll(send_gidx, recv_gidx);
+            comm().allToAll(send_part, recv_part);
+            comm().allToAll(send_ridx, recv_ridx);
         }
-        ATLAS_TRACE_MPI(ALLGATHER) {
-            comm().allGatherv(sendnodes_gidx.begin(), sendnodes_gidx.begin() + loccnt_, recvnodes_gidx.data(),
-                              glbcounts_.data(), glbdispls_.data());
+        size_t nb_recv = 0;
+        for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+            nb_recv += recv_gidx[jproc].size();
         }
-        atlas_omp_parallel_for(idx_t n = 0; n < nb_recv_nodes; ++n) {
-            node_sort[n].g = recvnodes_gidx[n];
+        node_sort.reserve(nb_recv);
+        for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+            for (size_t j = 0; j < recv_gidx[jproc].size(); ++j) {
+                node_sort.emplace_back(recv_gidx[jproc][j], recv_part[jproc][j], recv_ridx[jproc][j]);
+            }
         }
-        sendnodes_gidx.clear();
     }
 
-
-    {
-        std::vector<int> recvnodes_part;
-        try {
-            recvnodes_part.resize(glbcnt_);
-        }
-        catch (const std::bad_alloc& e) {
-            ATLAS_THROW_EXCEPTION("Could not allocate recvnodes_part with size "
-                                  << eckit::Bytes(glbcnt_ * sizeof(int)));
-        }
-        ATLAS_TRACE_MPI(ALLGATHER) {
-            comm().allGatherv(sendnodes_part.begin(), sendnodes_part.begin() + loccnt_, recvnodes_part.data(),
-                              glbcounts_.data(), glbdispls_.data());
-        }
-        atlas_omp_parallel_for(idx_t n = 0; n < nb_recv_nodes; ++n) {
-            node_sort[n].p = recvnodes_part[n];
-        }
-        sendnodes_part.clear();
-    }
-
-    {
-        std::vector<idx_t> recvnodes_ridx;
-        try {
-            recvnodes_ridx.resize(glbcnt_);
-        }
-        catch (const std::bad_alloc& e) {
-            ATLAS_THROW_EXCEPTION("Could not allocate recvnodes_ridx with size "
-                                  << eckit::Bytes(glbcnt_ * sizeof(idx_t)));
-        }
-        ATLAS_TRACE_MPI(ALLGATHER) {
-            comm().allGatherv(sendnodes_ridx.begin(), sendnodes_ridx.begin() + loccnt_, recvnodes_ridx.data(),
-                              glbcounts_.data(), glbdispls_.data());
-        }
-        atlas_omp_parallel_for(idx_t n = 0; n < nb_recv_nodes; ++n) {
-            node_sort[n].i = recvnodes_ridx[n];
-        }
-        sendnodes_ridx.clear();
-    }
-
-
     // Sort on "g" member, and remove duplicates
     ATLAS_TRACE_SCOPE("sorting") {
-        //        omp::sort(node_sort.begin(), node_sort.end());
-        std::sort(node_sort.begin(), node_sort.end());
+        omp::radix_sort(node_sort.begin(), node_sort.end(), [](const Node& node) { return node.g; });
         node_sort.erase(std::unique(node_sort.begin(), node_sort.end()), node_sort.end());
     }
 
-    glbcounts_.assign(nproc, 0);
-    glbdispls_.assign(nproc, 0);
+    // Position in global order of the first point of each directory partition
+    std::vector<int> directory_counts(nproc);
+    ATLAS_TRACE_MPI(ALLGATHER) {
+        comm().allGather(static_cast<int>(node_sort.size()), directory_counts.begin(), directory_counts.end());
+    }
+    const int directory_offset = std::accumulate(directory_counts.begin(), directory_counts.begin() + myproc, 0);
 
-    for (size_t n = 0; n < node_sort.size(); ++n) {
-        ++glbcounts_[node_sort[n].p];
+    for (const auto& node : node_sort) {
+        ++glbcounts_[node.p];
+    }
+    ATLAS_TRACE_MPI(ALLREDUCE) {
+        comm().allReduceInPlace(glbcounts_.data(), glbcounts_.size(), eckit::mpi::sum());
     }
 
     glbdispls_[0] = 0;
-
     for (idx_t jproc = 1; jproc < nproc; ++jproc)  // start at 1
     {
         glbdispls_[jproc] = glbcounts_[jproc - 1] + glbdispls_[jproc - 1];
@@ -219,27 +158,88 @@ void GatherScatter::setup(const std::string& mpi_comm, const int part[], const i
     glbcnt_ = std::accumulate(glbcounts_.begin(), glbcounts_.end(), size_t(0));
     loccnt_ = glbcounts_[myproc];
 
-    glbmap_.clear();
-    glbmap_.resize(glbcnt_);
-    locmap_.clear();
-    locmap_.resize(loccnt_);
-    std::vector<int> idx(nproc, 0);
+    // Return the position in global order of each point to its partition
+    std::vector<std::vector<int>> send_pos(nproc);
+    std::vector<std::vector<idx_t>> send_ridx(nproc);
+    for (size_t n = 0; n < node_sort.size(); ++n) {
+        send_pos[node_sort[n].p].emplace_back(directory_offset + static_cast<int>(n));
+        send_ridx[node_sort[n].p].emplace_back(node_sort[n].i);
+    }
+    node_sort.clear();
+    node_sort.shrink_to_fit();
 
-    size_t n{0};
-    for (const auto& node : node_sort) {
-        idx_t jproc                             = node.p;
-        glbmap_[glbdispls_[jproc] + idx[jproc]] = n++;
+    std::vector<std::vector<int>> recv_pos(nproc);
+    std::vector<std::vector<idx_t>> recv_ridx(nproc);
+    ATLAS_TRACE_MPI(ALLTOALL) {
+        comm().allToAll(send_pos, recv_pos);
+        comm().allToAll(send_ridx, recv_ridx);
+    }
 
-        if (jproc == myproc) {
-            locmap_[idx[jproc]] = node.i;
+    std::vector<std::pair<int, idx_t>> local;
+    local.reserve(loccnt_);
+    for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+        for (size_t j = 0; j < recv_pos[jproc].size(); ++j) {
+            local.emplace_back(recv_pos[jproc][j], recv_ridx[jproc][j]);
         }
+    }
+    ATLAS_ASSERT(local.size() == size_t(loccnt_));
+    omp::radix_sort(local.begin(), local.end(), [](const std::pair<int, idx_t>& p) { return p.first; });
 
-        ++idx[jproc];
+    glbpos_.resize(loccnt_);
+    locmap_.resize(loccnt_);
+    for (int j = 0; j < loccnt_; ++j) {
+        glbpos_[j] = local[j].first;
+        locmap_[j] = local[j].second;
     }
 
     is_setup_ = true;
 }
 
+const std::vector<int>& GatherScatter::glbmap(const idx_t roots[], idx_t nb_roots) const {
+    std::vector<char> missing(nproc, 0);
+    idx_t nb_missing = 0;
+    idx_t root       = -1;
+    for (idx_t j = 0; j < nb_roots; ++j) {
+        ATLAS_ASSERT(roots[j] >= 0 && roots[j] < nproc);
+        if (not glbmap_roots_[roots[j]] && not missing[roots[j]]) {
+            missing[roots[j]] = 1;
+            root              = roots[j];
+            ++nb_missing;
+        }
+    }
+    if (nb_missing == 0) {
+        return glbmap_;
+    }
+
+    ATLAS_TRACE("GatherScatter::glbmap");
+    if (missing[myproc]) {
+        glbmap_.resize(glbcnt_);
+    }
+    if (nb_missing == 1) {
+        ATLAS_TRACE_MPI(GATHER) {
+            comm().gatherv(glbpos_.data(), glbpos_.size(), glbmap_.data(), glbcounts_.data(), glbdispls_.data(), root);
+        }
+    }
+    else {
+        // Send glbpos_ to every missing root at once; all sends read the same buffer
+        std::vector<int> send_counts(nproc, 0);
+        std::vector<int> send_displs(nproc, 0);
+        std::vector<int> recv_counts(nproc, 0);
+        for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+            send_counts[jproc] = missing[jproc] ? loccnt_ : 0;
+            recv_counts[jproc] = missing[myproc] ? glbcounts_[jproc] : 0;
+        }
+        ATLAS_TRACE_MPI(ALLTOALL) {
+            comm().allToAllv(glbpos_.data(), send_counts.data(), send_displs.data(), glbmap_.data(),
+                             recv_counts.data(), glbdispls_.data());
+        }
+    }
+    for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+        glbmap_roots_[jproc] |= missing[jproc];
+    }
+    return glbmap_;
+}
+
 void GatherScatter::setup(const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
                           const idx_t parsize) {
     setup(mpi::comm().name(), part, remote_idx, base, glb_idx, parsize);
@@ -250,7 +250,7 @@ void GatherScatter::setup(const std::string& mpi_comm, const int part[], const i
     std::vector<int> mask(parsize);
     {
         int mypart = mpi::comm(mpi_comm).rank();
-        IsGhostPoint is_ghost(mypart, part, remote_idx, base, parsize);
+        detail::IsGhostPoint is_ghost(mypart, part, remote_idx, base);
         for (idx_t jj = 0; jj < parsize; ++jj) {
             mask[jj] = is_ghost(jj) ? 1 : 0;
         }
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <limits>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -93,6 +96,11 @@ public:
     idx_t var_rank;
 };
 
+/// @brief Gather distributed fields to a root partition in global order, or scatter them from it
+///
+/// The setup is distributed: global indices are sent to a directory partition owning a range of global indices,
+/// which sorts them and assigns their position in global order. Each partition only holds information about
+/// its own points, and the root partition assembles the mapping of all points at the first gather or scatter.
 class GatherScatter : public util::Object {
 public:
     GatherScatter();
@@ -161,6 +169,31 @@ public:  // methods
     void gather(const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
                 const idx_t root = 0) const;
 
+    /// @brief Gather each field lfields[j] to gfields[j] on its own root partition roots[j]
+    ///
+    /// All fields are exchanged in a single all-to-all communication, so that several root (e.g. I/O server)
+    /// partitions receive their fields concurrently. Only gfields[j] on partition roots[j] is written.
+    /// A range of levels or variables of a field can be sent to a different root by passing several
+    /// parallel::Field views of the same field, each with an offset data pointer and a reduced var_shape.
+    template <typename DATA_TYPE>
+    void gather(parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[], const idx_t nb_fields,
+                const idx_t roots[]) const;
+
+    /// @brief Receives a window [begin,end) of points in global order of gathered field jfield.
+    /// The data of point begin+n and variable v is at data[n*var_size+v], with var_size the product of var_shape.
+    template <typename DATA_TYPE>
+    using WindowWriter = std::function<void(idx_t jfield, idx_t begin, idx_t end, const DATA_TYPE data[])>;
+
+    /// @brief Gather fields to root in windows of at most `window` points in global order
+    ///
+    /// The global index space is traversed in consecutive windows, each gathered with one communication for all
+    /// fields and handed to `writer` on root, e.g. to encode or write it. Peak memory on root is proportional
+    /// to the window size rather than to the global field size. Collective over all partitions.
+    /// The writer type is not deduced, so that a lambda can be passed.
+    template <typename DATA_TYPE>
+    void gather(parallel::Field<DATA_TYPE const> lfields[], const idx_t nb_fields, const idx_t window,
+                const typename std::common_type<WindowWriter<DATA_TYPE>>::type& writer, const idx_t root = 0) const;
+
     template <typename DATA_TYPE>
     void scatter(parallel::Field<DATA_TYPE const> gfields[], parallel::Field<DATA_TYPE> lfields[],
                  const idx_t nb_fields, const idx_t root = 0) const;
@@ -180,6 +213,13 @@ public:  // methods
     void scatter(const array::ArrayView<DATA_TYPE, GRANK>& gdata, array::ArrayView<DATA_TYPE, LRANK>& ldata,
                  const idx_t root = 0) const;
 
+    /// @brief Scatter each field gfields[j] from its own root partition roots[j] to lfields[j]
+    ///
+    /// All fields are exchanged in a single all-to-all communication. Only gfields[j] on partition roots[j] is read.
+    template <typename DATA_TYPE>
+    void scatter(parallel::Field<DATA_TYPE const> gfields[], parallel::Field<DATA_TYPE> lfields[],
+                 const idx_t nb_fields, const idx_t roots[]) const;
+
     gidx_t glb_dof() const { return glbcnt_; }
 
     idx_t loc_dof() const { return loccnt_; }
@@ -189,12 +229,44 @@ public:  // methods
 private:  // methods
     template <typename DATA_TYPE>
     void pack_send_buffer(const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
+                          DATA_TYPE send_buffer[]) const {
+        pack_send_buffer(field, sendmap.data(), static_cast<idx_t>(sendmap.size()), send_buffer);
+    }
+
+    template <typename DATA_TYPE>
+    void pack_send_buffer(const parallel::Field<DATA_TYPE const>& field, const int sendmap[], const idx_t sendcnt,
                           DATA_TYPE send_buffer[]) const;
 
     template <typename DATA_TYPE>
     void unpack_recv_buffer(const std::vector<int>& recvmap, const DATA_TYPE recv_buffer[],
+                            const parallel::Field<DATA_TYPE>& field) const {
+        unpack_recv_buffer(recvmap.data(), static_cast<idx_t>(recvmap.size()), recv_buffer, field);
+    }
+
+    template <typename DATA_TYPE>
+    void unpack_recv_buffer(const int recvmap[], const idx_t recvcnt, const DATA_TYPE recv_buffer[],
                             const parallel::Field<DATA_TYPE>& field) const;
 
+    /// Assemble glbmap_ on root, if not already done. Collective over all partitions.
+    const std::vector<int>& glbmap(idx_t root) const { return glbmap(&root, 1); }
+
+    /// Assemble glbmap_ on each of the given roots that does not hold it yet, in a single communication.
+    /// Collective over all partitions.
+    const std::vector<int>& glbmap(const idx_t roots[], idx_t nb_roots) const;
+
+    /// Convert a count or displacement for MPI, which are limited to the range of int
+    static int mpi_count(size_t n) {
+        ATLAS_ASSERT(n <= static_cast<size_t>(std::numeric_limits<int>::max()),
+                     "GatherScatter: MPI count or displacement exceeds the range of int");
+        return static_cast<int>(n);
+    }
+
+    template <typename DATA_TYPE>
+    static idx_t var_size(const parallel::Field<DATA_TYPE>& field) {
+        return std::accumulate(field.var_shape.data(), field.var_shape.data() + field.var_rank, idx_t(1),
+                               std::multiplies<idx_t>());
+    }
+
     template <typename DATA_TYPE, int RANK>
     void var_info(const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<idx_t>& varstrides,
                   std::vector<idx_t>& varshape) const;
@@ -206,7 +278,12 @@ private:  // data
     std::vector<int> glbcounts_;
     std::vector<int> glbdispls_;
     std::vector<int> locmap_;
-    std::vector<int> glbmap_;
+    std::vector<int> glbpos_;  // position in global order of each point in locmap_
+
+    // Position in global order of each point in the gathered buffer, only assembled on root partitions when needed.
+    // It is identical on every root; glbmap_roots_[p] tells whether partition p holds it.
+    mutable std::vector<int> glbmap_;
+    mutable std::vector<char> glbmap_roots_;
 
     const mpi::Comm* comm_;
     idx_t nproc;
@@ -229,6 +306,8 @@ void GatherScatter::gather(parallel::Field<DATA_TYPE const> lfields[], parallel:
         throw_Exception("GatherScatter was not setup", Here());
     }
 
+    const std::vector<int>& glbmap = this->glbmap(root);
+
     for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
         const idx_t lvar_size =
             std::accumulate(lfields[jfield].var_shape.data(),
@@ -244,8 +323,8 @@ void GatherScatter::gather(parallel::Field<DATA_TYPE const> lfields[], parallel:
         std::vector<int> glb_counts(nproc);
 
         for (idx_t jproc = 0; jproc < nproc; ++jproc) {
-            glb_counts[jproc] = glbcounts_[jproc] * gvar_size;
-            glb_displs[jproc] = glbdispls_[jproc] * gvar_size;
+            glb_counts[jproc] = mpi_count(size_t(glbcounts_[jproc]) * gvar_size);
+            glb_displs[jproc] = mpi_count(size_t(glbdispls_[jproc]) * gvar_size);
         }
 
         /// Pack
@@ -260,7 +339,7 @@ void GatherScatter::gather(parallel::Field<DATA_TYPE const> lfields[], parallel:
 
         /// Unpack
         if (myproc == root)
-            unpack_recv_buffer(glbmap_, glb_buffer.data(), gfields[jfield]);
+            unpack_recv_buffer(glbmap, glb_buffer.data(), gfields[jfield]);
     }
 }
 
@@ -280,6 +359,8 @@ void GatherScatter::scatter(parallel::Field<DATA_TYPE const> gfields[], parallel
         throw_Exception("GatherScatter was not setup", Here());
     }
 
+    const std::vector<int>& glbmap = this->glbmap(root);
+
     for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
         const int lvar_size =
             std::accumulate(lfields[jfield].var_shape.data(),
@@ -295,13 +376,13 @@ void GatherScatter::scatter(parallel::Field<DATA_TYPE const> gfields[], parallel
         std::vector<int> glb_counts(nproc);
 
         for (idx_t jproc = 0; jproc < nproc; ++jproc) {
-            glb_counts[jproc] = glbcounts_[jproc] * gvar_size;
-            glb_displs[jproc] = glbdispls_[jproc] * gvar_size;
+            glb_counts[jproc] = mpi_count(size_t(glbcounts_[jproc]) * gvar_size);
+            glb_displs[jproc] = mpi_count(size_t(glbdispls_[jproc]) * gvar_size);
         }
 
         /// Pack
         if (myproc == root)
-            pack_send_buffer(gfields[jfield], glbmap_, glb_buffer.data());
+            pack_send_buffer(gfields[jfield], glbmap, glb_buffer.data());
 
         /// Scatter
 
@@ -325,10 +406,252 @@ void GatherScatter::scatter(const DATA_TYPE gdata[], const idx_t gvar_strides[],
 }
 
 template <typename DATA_TYPE>
-void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& field, const std::vector<int>& sendmap,
-                                     DATA_TYPE send_buffer[]) const {
-    const idx_t sendcnt = static_cast<idx_t>(sendmap.size());
+void GatherScatter::gather(parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                           const idx_t nb_fields, const idx_t roots[]) const {
+    if (!is_setup_) {
+        throw_Exception("GatherScatter was not setup", Here());
+    }
+
+    if (nb_fields == 0) {
+        return;
+    }
+    if (std::all_of(roots, roots + nb_fields, [roots](idx_t root) { return root == roots[0]; })) {
+        // A single root: gather field by field, which only needs buffers for one field at a time
+        gather(lfields, gfields, nb_fields, roots[0]);
+        return;
+    }
+
+    const std::vector<int>& glbmap = this->glbmap(roots, nb_fields);
+
+    // Fields are packed in order of their root, so that the data for each root is contiguous
+    std::vector<idx_t> order(nb_fields);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [roots](idx_t a, idx_t b) { return roots[a] < roots[b]; });
+
+    std::vector<size_t> send_sizes(nproc, 0);
+    size_t recv_var_size = 0;
+    for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+        ATLAS_ASSERT(roots[jfield] >= 0 && roots[jfield] < nproc);
+        send_sizes[roots[jfield]] += size_t(loccnt_) * var_size(lfields[jfield]);
+        if (roots[jfield] == myproc) {
+            recv_var_size += var_size(gfields[jfield]);
+        }
+    }
+    std::vector<int> send_counts(nproc);
+    std::vector<int> send_displs(nproc);
+    std::vector<int> recv_counts(nproc);
+    std::vector<int> recv_displs(nproc);
+    size_t send_size = 0;
+    size_t recv_size = 0;
+    for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+        send_counts[jproc] = mpi_count(send_sizes[jproc]);
+        send_displs[jproc] = mpi_count(send_size);
+        recv_counts[jproc] = mpi_count(size_t(glbcounts_[jproc]) * recv_var_size);
+        recv_displs[jproc] = mpi_count(recv_size);
+        send_size += send_counts[jproc];
+        recv_size += recv_counts[jproc];
+    }
+    std::vector<DATA_TYPE> send_buffer(send_size);
+    std::vector<DATA_TYPE> recv_buffer(recv_size);
+
+    /// Pack
+
+    size_t offset = 0;
+    for (idx_t jfield : order) {
+        pack_send_buffer(lfields[jfield], locmap_, send_buffer.data() + offset);
+        offset += loccnt_ * var_size(lfields[jfield]);
+    }
+
+    /// Gather
+
+    ATLAS_TRACE_MPI(ALLTOALL) {
+        comm().allToAllv(send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                         recv_counts.data(), recv_displs.data());
+    }
+
+    /// Unpack: the data from each partition contains the fields for this root in order
+
+    if (recv_var_size > 0) {
+        for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+            offset = recv_displs[jproc];
+            for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+                if (roots[jfield] == myproc) {
+                    unpack_recv_buffer(glbmap.data() + glbdispls_[jproc], glbcounts_[jproc],
+                                       recv_buffer.data() + offset, gfields[jfield]);
+                    offset += glbcounts_[jproc] * var_size(gfields[jfield]);
+                }
+            }
+        }
+    }
+}
+
+template <typename DATA_TYPE>
+void GatherScatter::scatter(parallel::Field<DATA_TYPE const> gfields[], parallel::Field<DATA_TYPE> lfields[],
+                            const idx_t nb_fields, const idx_t roots[]) const {
+    if (!is_setup_) {
+        throw_Exception("GatherScatter was not setup", Here());
+    }
+
+    if (nb_fields == 0) {
+        return;
+    }
+    if (std::all_of(roots, roots + nb_fields, [roots](idx_t root) { return root == roots[0]; })) {
+        // A single root: scatter field by field, which only needs buffers for one field at a time
+        scatter(gfields, lfields, nb_fields, roots[0]);
+        return;
+    }
+
+    const std::vector<int>& glbmap = this->glbmap(roots, nb_fields);
+
+    // Received fields are in order of their root
+    std::vector<idx_t> order(nb_fields);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [roots](idx_t a, idx_t b) { return roots[a] < roots[b]; });
+
+    std::vector<size_t> recv_sizes(nproc, 0);
+    size_t send_var_size = 0;
+    for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+        ATLAS_ASSERT(roots[jfield] >= 0 && roots[jfield] < nproc);
+        recv_sizes[roots[jfield]] += size_t(loccnt_) * var_size(lfields[jfield]);
+        if (roots[jfield] == myproc) {
+            send_var_size += var_size(gfields[jfield]);
+        }
+    }
+    std::vector<int> send_counts(nproc);
+    std::vector<int> send_displs(nproc);
+    std::vector<int> recv_counts(nproc);
+    std::vector<int> recv_displs(nproc);
+    size_t send_size = 0;
+    size_t recv_size = 0;
+    for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+        send_counts[jproc] = mpi_count(size_t(glbcounts_[jproc]) * send_var_size);
+        send_displs[jproc] = mpi_count(send_size);
+        recv_counts[jproc] = mpi_count(recv_sizes[jproc]);
+        recv_displs[jproc] = mpi_count(recv_size);
+        send_size += send_counts[jproc];
+        recv_size += recv_counts[jproc];
+    }
+    std::vector<DATA_TYPE> send_buffer(send_size);
+    std::vector<DATA_TYPE> recv_buffer(recv_size);
+
+    /// Pack: the data for each partition contains the fields of this root in order
+
+    size_t offset = 0;
+    if (send_var_size > 0) {
+        for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+            for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+                if (roots[jfield] == myproc) {
+                    pack_send_buffer(gfields[jfield], glbmap.data() + glbdispls_[jproc], glbcounts_[jproc],
+                                     send_buffer.data() + offset);
+                    offset += glbcounts_[jproc] * var_size(gfields[jfield]);
+                }
+            }
+        }
+    }
+
+    /// Scatter
+
+    ATLAS_TRACE_MPI(ALLTOALL) {
+        comm().allToAllv(send_buffer.data(), send_counts.data(), send_displs.data(), recv_buffer.data(),
+                         recv_counts.data(), recv_displs.data());
+    }
+
+    /// Unpack
+
+    offset = 0;
+    for (idx_t jfield : order) {
+        unpack_recv_buffer(locmap_, recv_buffer.data() + offset, lfields[jfield]);
+        offset += loccnt_ * var_size(lfields[jfield]);
+    }
+}
+
+template <typename DATA_TYPE>
+void GatherScatter::gather(parallel::Field<DATA_TYPE const> lfields[], const idx_t nb_fields, const idx_t window,
+                           const typename std::common_type<WindowWriter<DATA_TYPE>>::type& writer,
+                           const idx_t root) const {
+    if (!is_setup_) {
+        throw_Exception("GatherScatter was not setup", Here());
+    }
+    ATLAS_ASSERT(window > 0);
+
+    const std::vector<int>& glbmap = this->glbmap(root);
+
+    std::vector<idx_t> var_sizes(nb_fields);
+    idx_t var_size_total = 0;
+    idx_t var_size_max   = 0;
+    for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+        var_sizes[jfield] = var_size(lfields[jfield]);
+        var_size_total += var_sizes[jfield];
+        var_size_max = std::max(var_size_max, var_sizes[jfield]);
+    }
+
+    const idx_t max_window = std::min<idx_t>(window, glbcnt_);
+    std::vector<DATA_TYPE> send_buffer(std::min<idx_t>(max_window, loccnt_) * var_size_total);
+    std::vector<DATA_TYPE> recv_buffer(myproc == root ? max_window * var_size_total : 0);
+    std::vector<DATA_TYPE> glb_buffer(myproc == root ? max_window * var_size_max : 0);
+    std::vector<int> recv_counts(nproc, 0);
+    std::vector<int> recv_displs(nproc, 0);
+    std::vector<int> recv_begin(nproc, 0);
+    std::vector<int> window_map;
+
+    for (idx_t begin = 0; begin < glbcnt_; begin += window) {
+        const idx_t end = std::min<idx_t>(begin + window, glbcnt_);
+
+        /// Pack: the local points are sorted by their position in global order
+
+        const idx_t lbegin = std::lower_bound(glbpos_.begin(), glbpos_.end(), begin) - glbpos_.begin();
+        const idx_t lend   = std::lower_bound(glbpos_.begin() + lbegin, glbpos_.end(), end) - glbpos_.begin();
+        size_t offset      = 0;
+        for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+            pack_send_buffer(lfields[jfield], locmap_.data() + lbegin, lend - lbegin, send_buffer.data() + offset);
+            offset += (lend - lbegin) * var_sizes[jfield];
+        }
+
+        /// Gather
+
+        if (myproc == root) {
+            for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+                auto first         = glbmap.begin() + glbdispls_[jproc];
+                auto last          = first + glbcounts_[jproc];
+                auto wbegin        = std::lower_bound(first, last, begin);
+                auto wend          = std::lower_bound(wbegin, last, end);
+                recv_begin[jproc]  = wbegin - glbmap.begin();
+                recv_counts[jproc] = (wend - wbegin) * var_size_total;
+                if (jproc > 0) {
+                    recv_displs[jproc] = recv_displs[jproc - 1] + recv_counts[jproc - 1];
+                }
+            }
+        }
+        ATLAS_TRACE_MPI(GATHER) {
+            comm().gatherv(send_buffer.data(), offset, recv_buffer.data(), recv_counts.data(), recv_displs.data(),
+                           root);
+        }
+
+        /// Unpack each field in global order of the window, and hand it to the writer
+
+        if (myproc == root) {
+            for (idx_t jfield = 0, field_offset = 0; jfield < nb_fields; field_offset += var_sizes[jfield++]) {
+                idx_t extent[] = {var_sizes[jfield]};
+                idx_t stride[] = {1};
+                parallel::Field<DATA_TYPE> glb_field(glb_buffer.data(), stride, extent, 1);
+                for (idx_t jproc = 0; jproc < nproc; ++jproc) {
+                    const idx_t cnt = recv_counts[jproc] / std::max<idx_t>(var_size_total, 1);
+                    window_map.resize(cnt);
+                    for (idx_t j = 0; j < cnt; ++j) {
+                        window_map[j] = glbmap[recv_begin[jproc] + j] - begin;
+                    }
+                    unpack_recv_buffer(window_map.data(), cnt,
+                                       recv_buffer.data() + recv_displs[jproc] + cnt * field_offset, glb_field);
+                }
+                writer(jfield, begin, end, glb_buffer.data());
+            }
+        }
+    }
+}
 
+template <typename DATA_TYPE>
+void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& field, const int sendmap[],
+                                     const idx_t sendcnt, DATA_TYPE send_buffer[]) const {
     idx_t ibuf              = 0;
     const idx_t send_stride = field.var_strides[0] * field.var_shape[0];
 
@@ -373,10 +696,8 @@ void GatherScatter::pack_send_buffer(const parallel::Field<DATA_TYPE const>& fie
 }
 
 template <typename DATA_TYPE>
-void GatherScatter::unpack_recv_buffer(const std::vector<int>& recvmap, const DATA_TYPE recv_buffer[],
+void GatherScatter::unpack_recv_buffer(const int recvmap[], const idx_t recvcnt, const DATA_TYPE recv_buffer[],
                                        const parallel::Field<DATA_TYPE>& field) const {
-    const idx_t recvcnt = static_cast<idx_t>(recvmap.size());
-
     size_t ibuf             = 0;
     const idx_t recv_stride = field.var_strides[0] * field.var_shape[0];
 
@@ -19,37 +19,13 @@
 
 #include "atlas/array/Array.h"
 #include "atlas/parallel/HaloExchange.h"
+#include "atlas/parallel/detail/IsGhostPoint.h"
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/util/vector.h"
 
 namespace atlas {
 namespace parallel {
 
-namespace {
-struct IsGhostPoint {
-    IsGhostPoint(const int mypart, const int part[], const idx_t ridx[], const idx_t base, const int /*N*/) {
-        part_   = part;
-        ridx_   = ridx;
-        base_   = base;
-        mypart_ = mypart;
-    }
-
-    bool operator()(idx_t idx) {
-        if (part_[idx] != mypart_) {
-            return true;
-        }
-        if (ridx_[idx] != base_ + idx) {
-            return true;
-        }
-        return false;
-    }
-    int mypart_;
-    const int* part_;
-    const idx_t* ridx_;
-    idx_t base_;
-};
-}  // namespace
-
 HaloExchange::HaloExchange() :
     HaloExchange("") {
 }
@@ -93,7 +69,7 @@ void HaloExchange::setup(const std::string& mpi_comm, const int part[], const id
     Find the amount of nodes this proc has to receive from each other proc
     */
 
-    IsGhostPoint is_ghost(myproc, part, remote_idx, base, parsize_);
+    detail::IsGhostPoint is_ghost(myproc, part, remote_idx, base);
     atlas::vector<idx_t> ghost_points(parsize_);
     idx_t nghost = 0;
 
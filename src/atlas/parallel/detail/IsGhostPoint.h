@@ -0,0 +1,43 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/library/config.h"
+
+namespace atlas {
+namespace parallel {
+namespace detail {
+
+/// @brief A point is a ghost point if it is owned by another partition, or if its remote index does not
+/// point to itself (e.g. periodic points)
+struct IsGhostPoint {
+    IsGhostPoint(const int mypart, const int part[], const idx_t ridx[], const idx_t base):
+        mypart_(mypart), part_(part), ridx_(ridx), base_(base) {}
+
+    bool operator()(idx_t idx) const {
+        if (part_[idx] != mypart_) {
+            return true;
+        }
+        if (ridx_[idx] != base_ + idx) {
+            return true;
+        }
+        return false;
+    }
+
+    int mypart_;
+    const int* part_;
+    const idx_t* ridx_;
+    idx_t base_;
+};
+
+}  // namespace detail
+}  // namespace parallel
+}  // namespace atlas
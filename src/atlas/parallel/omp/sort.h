@@ -11,8 +11,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <type_traits>
+#include <vector>
 
 #include "atlas/library/config.h"
 #include "atlas/parallel/omp/omp.h"
@@ -52,6 +55,9 @@ namespace omp {
  *
  * Equivalent elements are not guaranteed to keep their original relative order (see stable_sort).
  *
+ * Sub-ranges are sorted in OpenMP tasks and merged with the parallel merge below, alternating between the
+ * range and a single temporary buffer of the same size.
+ *
  * Parameters
  * ----------
  * first, last
@@ -88,14 +94,113 @@ namespace omp {
  *     Random-access iterators for bounding the sequence to be sorted
  * blocks_begin, blocks_end
  *     Random-access iterators that define offsets from paramter "first" of blocks that are already sorted
+ *
+ *
+ *
+ * merge
+ * =====
+ *
+ * 1)  template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3>
+ *       RandomAccessIterator3 merge( RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+ *                                    RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+ *                                    RandomAccessIterator3 result );
+ *
+ * 2)  template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3,
+ *               typename Compare>
+ *       RandomAccessIterator3 merge( RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+ *                                    RandomAccessIterator2 first2, RandomAccessIterator2 last2,
+ *                                    RandomAccessIterator3 result, Compare comp );
+ *
+ * Merge sorted ranges [first1,last1) and [first2,last2) into the range starting at result, as std::merge.
+ * The output is split recursively in halves; the split point of each input range is found by a binary search
+ * ("co-ranking"), and the halves are merged in independent OpenMP tasks.
+ * Equivalent elements of the first range precede those of the second range.
+ *
+ *
+ *
+ * radix_sort
+ * ==========
+ *
+ * 1)  template <typename RandomAccessIterator>
+ *       void radix_sort ( RandomAccessIterator first, RandomAccessIterator last );
+ *
+ * 2)  template <typename RandomAccessIterator, typename KeyFunction>
+ *       void radix_sort ( RandomAccessIterator first, RandomAccessIterator last, KeyFunction key );
+ *
+ * Sort elements in range [first,last) into ascending order of an integer key, which is the element itself
+ * for the first version (e.g. gidx_t, uid_t), and key(element) for the second version.
+ *
+ * Least-significant-digit radix sort with 8-bit digits. Each pass distributes the elements over 256 buckets,
+ * using per-thread histograms over contiguous chunks of the range, so that the sort is stable.
+ * Digits that are equal for all keys are skipped, so that e.g. small positive 64-bit keys need few passes.
+ * Signed keys are ordered correctly.
+ * The elements must be default-constructible, as a temporary buffer of the same size is used.
  */
 
 
 namespace detail {
 
+// Number of elements of [first1,first1+size1) that are among the first k elements of the merge with
+// [first2,first2+size2). Elements of the first range go first when equivalent.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Compare>
+size_t merge_corank(size_t k, const RandomAccessIterator1& first1, size_t size1, const RandomAccessIterator2& first2,
+                    size_t size2, Compare compare) {
+    size_t lo = (k > size2) ? k - size2 : 0;
+    size_t hi = std::min(k, size1);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (j > 0 && !compare(first2[j - 1], first1[i])) {
+            lo = i + 1;
+        }
+        else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
 #if ATLAS_HAVE_OMP_SORTING
-template <typename RandomAccessIterator, typename Compare>
-void merge_sort_recursive(const RandomAccessIterator& iterator, size_t begin, size_t end, Compare compare) {
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3,
+          typename Compare>
+void merge_recursive(RandomAccessIterator1 first1, size_t size1, RandomAccessIterator2 first2, size_t size2,
+                     RandomAccessIterator3 result, Compare compare) {
+    size_t size = size1 + size2;
+    if (size >= (1 << 14)) {
+        size_t k = size / 2;
+        size_t i = merge_corank(k, first1, size1, first2, size2, compare);
+        size_t j = k - i;
+#pragma omp task
+        merge_recursive(first1, i, first2, j, result, compare);
+#pragma omp task
+        merge_recursive(first1 + i, size1 - i, first2 + j, size2 - j, result + k, compare);
+#pragma omp taskwait
+    }
+    else {
+        std::merge(first1, first1 + size1, first2, first2 + size2, result, compare);
+    }
+}
+
+// Move [first,first+size) to result, in tasks of contiguous chunks
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+void move_recursive(RandomAccessIterator1 first, size_t size, RandomAccessIterator2 result) {
+    if (size >= (1 << 16)) {
+        size_t mid = size / 2;
+#pragma omp task
+        move_recursive(first, mid, result);
+#pragma omp task
+        move_recursive(first + mid, size - mid, result + mid);
+#pragma omp taskwait
+    }
+    else {
+        std::move(first, first + size, result);
+    }
+}
+
+// Sort [begin,end) of iterator; the sorted result is stored in the same positions of buffer if to_buffer is true
+template <typename RandomAccessIterator, typename Buffer, typename Compare>
+void merge_sort_recursive(const RandomAccessIterator& iterator, const Buffer& buffer, size_t begin, size_t end,
+                          bool to_buffer, Compare compare) {
     auto size = end - begin;
     if (size >= 256) {
         auto mid = begin + size / 2;
@@ -104,32 +209,42 @@ void merge_sort_recursive(const RandomAccessIterator& iterator, size_t begin, si
         //       but this leads to segfaults on Cray (cce/8.5.8)
         {
 #if ATLAS_OMP_TASK_UNTIED_SUPPORTED
-#pragma omp task shared(iterator) untied if (size >= (1 << 15))
+#pragma omp task shared(iterator, buffer) untied if (size >= (1 << 15))
 #else
-#pragma omp task shared(iterator)
+#pragma omp task shared(iterator, buffer)
 #endif
-            merge_sort_recursive(iterator, begin, mid, compare);
+            merge_sort_recursive(iterator, buffer, begin, mid, !to_buffer, compare);
 #if ATLAS_OMP_TASK_UNTIED_SUPPORTED
-#pragma omp task shared(iterator) untied if (size >= (1 << 15))
+#pragma omp task shared(iterator, buffer) untied if (size >= (1 << 15))
 #else
-#pragma omp task shared(iterator)
+#pragma omp task shared(iterator, buffer)
 #endif
-            merge_sort_recursive(iterator, mid, end, compare);
+            merge_sort_recursive(iterator, buffer, mid, end, !to_buffer, compare);
 //#pragma omp taskyield
 #pragma omp taskwait
         }
-        std::inplace_merge(iterator + begin, iterator + mid, iterator + end, compare);
+        if (to_buffer) {
+            merge_recursive(std::make_move_iterator(iterator + begin), mid - begin,
+                            std::make_move_iterator(iterator + mid), end - mid, buffer + begin, compare);
+        }
+        else {
+            merge_recursive(std::make_move_iterator(buffer + begin), mid - begin,
+                            std::make_move_iterator(buffer + mid), end - mid, iterator + begin, compare);
+        }
     }
     else {
         std::sort(iterator + begin, iterator + end, compare);
+        if (to_buffer) {
+            std::move(iterator + begin, iterator + end, buffer + begin);
+        }
     }
 }
 #endif
 
 #if ATLAS_HAVE_OMP_SORTING
-template <typename RandomAccessIterator, typename Indexable, typename Compare>
-void merge_blocks_recursive(const RandomAccessIterator& iterator, const Indexable& blocks, size_t blocks_begin,
-                            size_t blocks_end, Compare compare) {
+template <typename RandomAccessIterator, typename Buffer, typename Indexable, typename Compare>
+void merge_blocks_recursive(const RandomAccessIterator& iterator, const Buffer& buffer, const Indexable& blocks,
+                            size_t blocks_begin, size_t blocks_end, Compare compare) {
     if (blocks_end <= blocks_begin + 1) {
         // recursion done, go back out
         return;
@@ -139,17 +254,19 @@ void merge_blocks_recursive(const RandomAccessIterator& iterator, const Indexabl
     //   --> it would be preferred to use taskgroup and taskyield instead of taskwait,
     //       but this leads to segfaults on Cray (cce/8.5.8)
     {
-#pragma omp task shared(iterator, blocks)
-        merge_blocks_recursive(iterator, blocks, blocks_begin, blocks_mid, compare);
-#pragma omp task shared(iterator, blocks)
-        merge_blocks_recursive(iterator, blocks, blocks_mid, blocks_end, compare);
+#pragma omp task shared(iterator, buffer, blocks)
+        merge_blocks_recursive(iterator, buffer, blocks, blocks_begin, blocks_mid, compare);
+#pragma omp task shared(iterator, buffer, blocks)
+        merge_blocks_recursive(iterator, buffer, blocks, blocks_mid, blocks_end, compare);
 //#pragma omp taskyield
 #pragma omp taskwait
     }
-    auto begin = iterator + blocks[blocks_begin];
-    auto mid   = iterator + blocks[blocks_mid];
-    auto end   = iterator + blocks[blocks_end];
-    std::inplace_merge(begin, mid, end, compare);
+    size_t begin = blocks[blocks_begin];
+    size_t mid   = blocks[blocks_mid];
+    size_t end   = blocks[blocks_end];
+    merge_recursive(std::make_move_iterator(iterator + begin), mid - begin, std::make_move_iterator(iterator + mid),
+                    end - mid, buffer + begin, compare);
+    move_recursive(buffer + begin, end - begin, iterator + begin);
 }
 #endif
 
@@ -172,15 +289,60 @@ void merge_blocks_recursive_seq(RandomAccessIterator& iterator, const Indexable&
     std::inplace_merge(begin, mid, end, compare);
 }
 
+template <typename Key>
+typename std::make_unsigned<Key>::type radix_key(Key key) {
+    using unsigned_key = typename std::make_unsigned<Key>::type;
+    auto u             = static_cast<unsigned_key>(key);
+    if (std::is_signed<Key>::value) {
+        u ^= unsigned_key(1) << (8 * sizeof(Key) - 1);
+    }
+    return u;
+}
+
+// Stable distribution of [src,src+size) to dst according to the digit at bit position shift.
+// The histogram has 256 entries per thread.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename KeyFunction>
+void radix_sort_pass(const RandomAccessIterator1& src, const RandomAccessIterator2& dst, size_t size, int shift,
+                     KeyFunction key, std::vector<size_t>& histogram) {
+    auto digit = [&](size_t i) -> size_t { return (radix_key(key(src[i])) >> shift) & 0xFF; };
+    atlas_omp_parallel {
+        const size_t nthreads = atlas_omp_get_num_threads();
+        const size_t tid      = atlas_omp_get_thread_num();
+        const size_t begin    = (size * tid) / nthreads;
+        const size_t end      = (size * (tid + 1)) / nthreads;
+        size_t* offset        = histogram.data() + 256 * tid;
+        std::fill(offset, offset + 256, 0);
+        for (size_t i = begin; i < end; ++i) {
+            ++offset[digit(i)];
+        }
+        atlas_omp_pragma(omp barrier)
+        atlas_omp_pragma(omp single) {
+            size_t sum = 0;
+            for (size_t d = 0; d < 256; ++d) {
+                for (size_t t = 0; t < nthreads; ++t) {
+                    size_t count           = histogram[256 * t + d];
+                    histogram[256 * t + d] = sum;
+                    sum += count;
+                }
+            }
+        }
+        for (size_t i = begin; i < end; ++i) {
+            dst[offset[digit(i)]++] = std::move(src[i]);
+        }
+    }
+}
+
 }  // namespace detail
 
 template <typename RandomAccessIterator, typename Compare>
 void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare) {
 #if ATLAS_HAVE_OMP_SORTING
     if (atlas_omp_get_max_threads() > 1) {
+        using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+        std::vector<value_type> buffer(std::distance(first, last));
 #pragma omp parallel
 #pragma omp single
-        detail::merge_sort_recursive(first, 0, std::distance(first, last), compare);
+        detail::merge_sort_recursive(first, buffer.begin(), 0, buffer.size(), false, compare);
     }
     else {
         std::sort(first, last, compare);
@@ -208,9 +370,11 @@ void merge_blocks(RandomAccessIterator first, RandomAccessIterator last, RandomA
     }
 #if ATLAS_HAVE_OMP_SORTING
     if (atlas_omp_get_max_threads() > 1) {
+        using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+        std::vector<value_type> buffer(std::distance(first, last));
 #pragma omp parallel
 #pragma omp single
-        detail::merge_blocks_recursive(first, blocks_displs, 0, nb_blocks, compare);
+        detail::merge_blocks_recursive(first, buffer.begin(), blocks_displs, 0, nb_blocks, compare);
     }
     else {
         detail::merge_blocks_recursive_seq(first, blocks_displs, 0, nb_blocks, compare);
@@ -227,6 +391,81 @@ void merge_blocks(RandomAccessIterator first, RandomAccessIterator last, RandomA
     ::atlas::omp::merge_blocks(first, last, blocks_size_first, blocks_size_last, std::less<value_type>());
 }
 
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3,
+          typename Compare>
+RandomAccessIterator3 merge(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2,
+                            RandomAccessIterator2 last2, RandomAccessIterator3 result, Compare compare) {
+#if ATLAS_HAVE_OMP_SORTING
+    if (atlas_omp_get_max_threads() > 1) {
+        size_t size1 = std::distance(first1, last1);
+        size_t size2 = std::distance(first2, last2);
+#pragma omp parallel
+#pragma omp single
+        detail::merge_recursive(first1, size1, first2, size2, result, compare);
+        return result + (size1 + size2);
+    }
+    else {
+        return std::merge(first1, last1, first2, last2, result, compare);
+    }
+#else
+    return std::merge(first1, last1, first2, last2, result, compare);
+#endif
+}
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename RandomAccessIterator3>
+RandomAccessIterator3 merge(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2,
+                            RandomAccessIterator2 last2, RandomAccessIterator3 result) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator1>::value_type;
+    return ::atlas::omp::merge(first1, last1, first2, last2, result, std::less<value_type>());
+}
+
+template <typename RandomAccessIterator, typename KeyFunction>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last, KeyFunction key) {
+    using value_type   = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using key_type     = typename std::decay<decltype(key(*first))>::type;
+    using unsigned_key = typename std::make_unsigned<key_type>::type;
+    static_assert(std::is_integral<key_type>::value, "radix_sort requires integral keys");
+
+    const size_t size = std::distance(first, last);
+    if (size < 1024) {
+        std::stable_sort(first, last, [&key](const value_type& a, const value_type& b) { return key(a) < key(b); });
+        return;
+    }
+
+    // Bits in which any key differs from the first one
+    const unsigned_key key0 = detail::radix_key(key(first[0]));
+    unsigned_key diff       = 0;
+    atlas_omp_pragma(omp parallel for reduction(|:diff))
+    for (size_t i = 0; i < size; ++i) {
+        diff |= detail::radix_key(key(first[i])) ^ key0;
+    }
+
+    std::vector<value_type> buffer(size);
+    std::vector<size_t> histogram(256 * atlas_omp_get_max_threads());
+    bool in_buffer = false;
+    for (int shift = 0; shift < int(8 * sizeof(key_type)); shift += 8) {
+        if (((diff >> shift) & 0xFF) == 0) {
+            continue;
+        }
+        if (in_buffer) {
+            detail::radix_sort_pass(buffer.begin(), first, size, shift, key, histogram);
+        }
+        else {
+            detail::radix_sort_pass(first, buffer.begin(), size, shift, key, histogram);
+        }
+        in_buffer = !in_buffer;
+    }
+    if (in_buffer) {
+        atlas_omp_parallel_for(size_t i = 0; i < size; ++i) { first[i] = std::move(buffer[i]); }
+    }
+}
+
+template <typename RandomAccessIterator>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last) {
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    ::atlas::omp::radix_sort(first, last, [](const value_type& value) { return value; });
+}
+
 }  // namespace omp
 }  // namespace atlas
 
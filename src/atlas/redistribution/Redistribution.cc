@@ -40,6 +40,16 @@ void Redistribution::execute(const FieldSet& source, FieldSet& target) const {
     return;
 }
 
+void Redistribution::execute_start(const FieldSet& source, FieldSet& target) const {
+    get()->execute_start(source, target);
+    return;
+}
+
+void Redistribution::execute_finish(const FieldSet& source, FieldSet& target) const {
+    get()->execute_finish(source, target);
+    return;
+}
+
 const FunctionSpace& Redistribution::source() const {
     return get()->source();
 }
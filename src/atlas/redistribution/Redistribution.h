@@ -60,6 +60,23 @@ public:
     /// \param[out] target  output field set.
     void execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const;
 
+    /// \brief    Starts redistributing source field set to target field set.
+    ///
+    /// \details  All fields are packed and sent in one exchange. The call
+    ///           returns without waiting for the data to arrive, so that
+    ///           computation can be overlapped with the communication. Target
+    ///           fields must not be accessed until execute_finish is called.
+    ///
+    /// \param[in]  source  input field set.
+    /// \param[out] target  output field set.
+    void execute_start(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const;
+
+    /// \brief    Completes the redistribution started with execute_start.
+    ///
+    /// \param[in]  source  input field set, as passed to execute_start.
+    /// \param[out] target  output field set, as passed to execute_start.
+    void execute_finish(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const;
+
     /// \brief  Get const reference to source function space.
     const FunctionSpace& source() const;
 
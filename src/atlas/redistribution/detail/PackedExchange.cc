@@ -0,0 +1,86 @@
+/*
+ * (C) Crown Copyright 2021 Met Office
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#include "atlas/redistribution/detail/PackedExchange.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace redistribution {
+namespace detail {
+
+namespace {
+// Each exchange gets its own message tag, so that the messages of exchanges
+// which are active at the same time are not matched with each other.
+// Counting exchanges per communicator only gives the same tag on every PE if
+// all PEs set up their exchanges on that communicator in the same order.
+// Tags stay below 32768, the smallest upper bound allowed by the MPI standard.
+int next_tag(const std::string& mpi_comm) {
+    constexpr int first_tag = 1024;
+    constexpr int nb_tags   = 32768 - first_tag;
+    static std::map<std::string, int> counters;
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+    int& counter  = counters[mpi_comm];
+    const int tag = first_tag + counter;
+    counter       = (counter + 1) % nb_tags;
+    return tag;
+}
+}  // namespace
+
+void PackedExchange::setup(const std::string& mpi_comm, const std::vector<int>& sendPoints,
+                           const std::vector<int>& recvPoints) {
+    ATLAS_ASSERT(not active_);
+    ATLAS_ASSERT(sendPoints.size() == recvPoints.size());
+    mpi_comm_   = mpi_comm;
+    sendPoints_ = sendPoints;
+    recvPoints_ = recvPoints;
+    tag_        = next_tag(mpi_comm_);
+}
+
+void PackedExchange::start_communication() {
+    const auto& comm     = mpi::comm(mpi_comm_);
+    const idx_t mpi_size = static_cast<idx_t>(sendPoints_.size());
+    const idx_t mpi_rank = static_cast<idx_t>(comm.rank());
+    requests_.clear();
+
+    // Post receives before sends, for non-empty partners only.
+    ATLAS_TRACE_MPI(IRECEIVE) {
+        for (idx_t jproc = 0; jproc < mpi_size; ++jproc) {
+            const size_t count = recvDisps_[jproc + 1] - recvDisps_[jproc];
+            if (count > 0 && jproc != mpi_rank) {
+                requests_.push_back(comm.iReceive(recvBuffer_.data() + recvDisps_[jproc], count, jproc, tag_));
+            }
+        }
+    }
+    ATLAS_TRACE_MPI(ISEND) {
+        for (idx_t jproc = 0; jproc < mpi_size; ++jproc) {
+            const size_t count = sendDisps_[jproc + 1] - sendDisps_[jproc];
+            if (count > 0 && jproc != mpi_rank) {
+                requests_.push_back(comm.iSend(sendBuffer_.data() + sendDisps_[jproc], count, jproc, tag_));
+            }
+        }
+    }
+
+    // Data for this PE does not go through MPI.
+    const size_t count = sendDisps_[mpi_rank + 1] - sendDisps_[mpi_rank];
+    ATLAS_ASSERT(count == recvDisps_[mpi_rank + 1] - recvDisps_[mpi_rank]);
+    std::copy_n(sendBuffer_.data() + sendDisps_[mpi_rank], count, recvBuffer_.data() + recvDisps_[mpi_rank]);
+}
+
+void PackedExchange::wait() {
+    ATLAS_TRACE_MPI(WAIT) { mpi::comm(mpi_comm_).waitAll(requests_); }
+    requests_.clear();
+}
+
+}  // namespace detail
+}  // namespace redistribution
+}  // namespace atlas
@@ -0,0 +1,142 @@
+/*
+ * (C) Crown Copyright 2021 Met Office
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace redistribution {
+namespace detail {
+
+/// \brief    Non-blocking exchange of the points of several fields in one
+///           message per partner PE.
+///
+/// \details  Each field contributes a fixed number of bytes per point. The
+///           data for each partner PE is packed field after field into one
+///           contiguous region of a byte buffer, and sent with a
+///           point-to-point message to non-empty partners only. Data for
+///           the own PE is copied. The buffers persist between exchanges, so
+///           that repeated exchanges of similar field sets do not allocate.
+class PackedExchange {
+public:
+    /// \brief    Sets the number of points sent to and received from each PE.
+    ///
+    /// \details  Collective over mpi_comm. Each exchange is assigned its own
+    ///           message tag, so that different exchanges can be active at
+    ///           the same time. Tags are counted per communicator, so they
+    ///           only match between PEs if every PE sets up its exchanges on
+    ///           mpi_comm in the same order.
+    void setup(const std::string& mpi_comm, const std::vector<int>& sendPoints, const std::vector<int>& recvPoints);
+
+    /// \brief    Packs and sends all fields, and posts the receives.
+    ///
+    /// \details  pack(jproc, jfield, buffer) must write the data of field
+    ///           jfield for PE jproc, i.e. sendPoints[jproc] *
+    ///           fieldBytes[jfield] bytes, to buffer. It is called in an
+    ///           OpenMP parallel loop over PEs.
+    template <typename Pack>
+    void start(const std::vector<size_t>& fieldBytes, const Pack& pack);
+
+    /// \brief    Waits for the exchange started with start() to complete
+    ///           and unpacks all fields.
+    ///
+    /// \details  unpack(jproc, jfield, buffer) must read the data of field
+    ///           jfield from PE jproc from buffer. It is called in an OpenMP
+    ///           parallel loop over PEs.
+    template <typename Unpack>
+    void finish(const Unpack& unpack);
+
+    /// \brief    Whether an exchange has been started and not finished.
+    bool active() const { return active_; }
+
+private:
+    void start_communication();
+    void wait();
+
+    std::string mpi_comm_;
+    std::vector<int> sendPoints_{};
+    std::vector<int> recvPoints_{};
+
+    // Bytes per point of each field, and their partial sums.
+    std::vector<size_t> fieldBytes_{};
+    std::vector<size_t> fieldOffsets_{};
+
+    // Byte displacement of the region of each PE.
+    std::vector<size_t> sendDisps_{};
+    std::vector<size_t> recvDisps_{};
+
+    std::vector<char> sendBuffer_{};
+    std::vector<char> recvBuffer_{};
+    std::vector<eckit::mpi::Request> requests_{};
+    int tag_{0};
+    bool active_{false};
+};
+
+//------------------------------------------------------------------------
+
+template <typename Pack>
+void PackedExchange::start(const std::vector<size_t>& fieldBytes, const Pack& pack) {
+    ATLAS_ASSERT(not active_, "Previous exchange has not been finished");
+    fieldBytes_ = fieldBytes;
+    fieldOffsets_.assign(fieldBytes_.size() + 1, 0);
+    for (size_t jfield = 0; jfield < fieldBytes_.size(); ++jfield) {
+        fieldOffsets_[jfield + 1] = fieldOffsets_[jfield] + fieldBytes_[jfield];
+    }
+    const size_t pointBytes = fieldOffsets_.back();
+
+    const idx_t mpi_size = static_cast<idx_t>(sendPoints_.size());
+    sendDisps_.assign(mpi_size + 1, 0);
+    recvDisps_.assign(mpi_size + 1, 0);
+    for (idx_t jproc = 0; jproc < mpi_size; ++jproc) {
+        sendDisps_[jproc + 1] = sendDisps_[jproc] + sendPoints_[jproc] * pointBytes;
+        recvDisps_[jproc + 1] = recvDisps_[jproc] + recvPoints_[jproc] * pointBytes;
+    }
+    // Buffers only grow, so that they are reused by subsequent exchanges.
+    if (sendBuffer_.size() < sendDisps_.back()) {
+        sendBuffer_.resize(sendDisps_.back());
+    }
+    if (recvBuffer_.size() < recvDisps_.back()) {
+        recvBuffer_.resize(recvDisps_.back());
+    }
+
+    const idx_t nb_fields = static_cast<idx_t>(fieldBytes_.size());
+    atlas_omp_parallel_for(idx_t jproc = 0; jproc < mpi_size; ++jproc) {
+        for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+            pack(jproc, jfield, sendBuffer_.data() + sendDisps_[jproc] + sendPoints_[jproc] * fieldOffsets_[jfield]);
+        }
+    }
+
+    start_communication();
+    active_ = true;
+}
+
+template <typename Unpack>
+void PackedExchange::finish(const Unpack& unpack) {
+    ATLAS_ASSERT(active_, "No exchange has been started");
+    wait();
+
+    const idx_t mpi_size  = static_cast<idx_t>(recvPoints_.size());
+    const idx_t nb_fields = static_cast<idx_t>(fieldBytes_.size());
+    atlas_omp_parallel_for(idx_t jproc = 0; jproc < mpi_size; ++jproc) {
+        for (idx_t jfield = 0; jfield < nb_fields; ++jfield) {
+            unpack(jproc, jfield,
+                   recvBuffer_.data() + recvDisps_[jproc] + recvPoints_[jproc] * fieldOffsets_[jfield]);
+        }
+    }
+    active_ = false;
+}
+
+}  // namespace detail
+}  // namespace redistribution
+}  // namespace atlas
@@ -5,10 +5,15 @@
  * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
  */
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
 #include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
 #include "atlas/functionspace/CellColumns.h"
 #include "atlas/functionspace/EdgeColumns.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -17,6 +22,7 @@
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/redistribution/detail/RedistributeGeneric.h"
 #include "atlas/redistribution/detail/RedistributionImplFactory.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/Unique.h"
 
 
@@ -128,103 +134,146 @@ std::vector<IdxUid> getUidVec(const FunctionSpace& functionspace) {
     return uidVec;
 }
 
-// Copy UID index
-std::vector<idx_t> getUidIdx(const std::vector<IdxUid>& uidVec) {
-    auto idxVec = std::vector<idx_t>{};
-    idxVec.reserve(uidVec.size());
-    std::transform(uidVec.begin(), uidVec.end(), std::back_inserter(idxVec),
-                   [](const IdxUid& uid) { return uid.first; });
-    return idxVec;
+// Rank of the directory partition holding the entry of a UID. UIDs are hashed so that directory entries are
+// balanced also when UIDs are clustered, e.g. contiguous global indices of a regular decomposition.
+int directoryRank(uidx_t uid, size_t mpi_size) {
+    auto h = static_cast<std::uint64_t>(uid);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return static_cast<int>(h % mpi_size);
 }
 
-// Copy UID value
-std::vector<uidx_t> getUidVal(const std::vector<IdxUid>& uidVec) {
-    auto valVec = std::vector<uidx_t>{};
-    valVec.reserve(uidVec.size());
-    std::transform(uidVec.begin(), uidVec.end(), std::back_inserter(valVec),
-                   [](const IdxUid& uid) { return uid.second; });
-    return valVec;
+// Send UIDs to their directory partitions. Returns the UIDs received from each partition; sendIdx is set to the
+// positions in localUids of the UIDs sent to each partition, in order.
+std::vector<std::vector<uidx_t>> sendToDirectory(const mpi::Comm& comm, const std::vector<IdxUid>& localUids,
+                                                 std::vector<std::vector<idx_t>>& sendIdx) {
+    const auto mpi_size = comm.size();
+    auto sendUids       = std::vector<std::vector<uidx_t>>(mpi_size);
+    sendIdx.assign(mpi_size, {});
+    for (size_t i = 0; i < localUids.size(); ++i) {
+        const int rank = directoryRank(localUids[i].second, mpi_size);
+        sendUids[rank].push_back(localUids[i].second);
+        sendIdx[rank].push_back(static_cast<idx_t>(i));
+    }
+    auto recvUids = std::vector<std::vector<uidx_t>>(mpi_size);
+    ATLAS_TRACE_MPI(ALLTOALL) { comm.allToAll(sendUids, recvUids); }
+    return recvUids;
 }
 
-// Communicate UID values, return receive buffer and displacements.
-std::pair<std::vector<uidx_t>, std::vector<int>> communicateUid(const std::string& mpi_comm, const std::vector<uidx_t>& sendBuffer) {
-    auto& comm = mpi::comm(mpi_comm);
-    auto counts = std::vector<int>(comm.size());
-    comm.allGather(static_cast<int>(sendBuffer.size()), counts.begin(), counts.end());
-
-    auto disps = std::vector<int>{};
-    disps.reserve(comm.size() + 1);
-    disps.push_back(0);
-    std::partial_sum(counts.begin(), counts.end(), std::back_inserter(disps));
+// Look up, for each UID received from each partition, the partition that holds the same UID in the other
+// function space, or -1 if there is none.
+std::vector<std::vector<int>> lookupDirectory(const std::vector<std::vector<uidx_t>>& queryUids,
+                                              const std::vector<std::vector<uidx_t>>& entryUids) {
+    // Directory entries of the other function space, sorted by UID.
+    auto entries = std::vector<std::pair<uidx_t, int>>{};
+    for (size_t rank = 0; rank < entryUids.size(); ++rank) {
+        for (const auto uid : entryUids[rank]) {
+            entries.emplace_back(uid, static_cast<int>(rank));
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    auto partitions = std::vector<std::vector<int>>(queryUids.size());
+    for (size_t rank = 0; rank < queryUids.size(); ++rank) {
+        partitions[rank].reserve(queryUids[rank].size());
+        for (const auto uid : queryUids[rank]) {
+            auto entry = std::lower_bound(entries.begin(), entries.end(), std::make_pair(uid, 0));
+            partitions[rank].push_back(entry != entries.end() && entry->first == uid ? entry->second : -1);
+        }
+    }
+    return partitions;
+}
 
+// Return the directory answers to the partitions that sent the UIDs, and assign them to the local UIDs.
+std::vector<int> receiveFromDirectory(const mpi::Comm& comm, const std::vector<std::vector<int>>& answers,
+                                      const std::vector<std::vector<idx_t>>& sendIdx, size_t nbLocalUids) {
+    auto recvAnswers = std::vector<std::vector<int>>(comm.size());
+    ATLAS_TRACE_MPI(ALLTOALL) { comm.allToAll(answers, recvAnswers); }
+
+    auto partitions = std::vector<int>(nbLocalUids, -1);
+    for (size_t rank = 0; rank < comm.size(); ++rank) {
+        ATLAS_ASSERT(recvAnswers[rank].size() == sendIdx[rank].size());
+        for (size_t j = 0; j < sendIdx[rank].size(); ++j) {
+            partitions[sendIdx[rank][j]] = recvAnswers[rank][j];
+        }
+    }
+    return partitions;
+}
 
-    auto recvBuffer = std::vector<uidx_t>(static_cast<size_t>(disps.back()));
+// Find, for each local source and target UID, the partition holding the same UID in the other function space,
+// through a distributed directory. Memory and communication scale with the local number of UIDs.
+std::pair<std::vector<int>, std::vector<int>> matchUids(const std::string& mpi_comm,
+                                                        const std::vector<IdxUid>& sourceUids,
+                                                        const std::vector<IdxUid>& targetUids) {
+    const auto& comm = mpi::comm(mpi_comm);
 
-    comm.allGatherv(sendBuffer.begin(), sendBuffer.end(), recvBuffer.begin(), counts.data(), disps.data());
+    auto sourceSendIdx         = std::vector<std::vector<idx_t>>{};
+    auto targetSendIdx         = std::vector<std::vector<idx_t>>{};
+    const auto sourceDirectory = sendToDirectory(comm, sourceUids, sourceSendIdx);
+    const auto targetDirectory = sendToDirectory(comm, targetUids, targetSendIdx);
 
-    return std::make_pair(recvBuffer, disps);
-}
+    const auto sourceAnswers = lookupDirectory(sourceDirectory, targetDirectory);
+    const auto targetAnswers = lookupDirectory(targetDirectory, sourceDirectory);
 
-// Need to overload "<" operator for comparison of asymmetric types in
-// std::set_intersection.
-bool operator<(const IdxUid& lhs, const uidx_t& rhs) {
-    return lhs.second < rhs;
-}
-bool operator<(const uidx_t& lhs, const IdxUid& rhs) {
-    return lhs < rhs.second;
+    return std::make_pair(receiveFromDirectory(comm, sourceAnswers, sourceSendIdx, sourceUids.size()),
+                          receiveFromDirectory(comm, targetAnswers, targetSendIdx, targetUids.size()));
 }
 
-// Find the intersection between local and global UIDs, then return local
-// indices of incections and PE dispacements in vector.
-std::pair<std::vector<idx_t>, std::vector<int>> getUidIntersection(const std::string& mpi_comm,
-                                                                   const std::vector<IdxUid>& localUids,
-                                                                   const std::vector<uidx_t>& globalUids,
-                                                                   const std::vector<int>& globalDisps) {
-    auto uidIntersection = std::vector<IdxUid>{};
-    uidIntersection.reserve(localUids.size());
-
-    auto& comm = mpi::comm(mpi_comm);
-    auto mpi_size = comm.size();
-
-    auto disps = std::vector<int>{};
-    disps.reserve(mpi_size + 1);
-    disps.push_back(0);
-
-    // Loop over all PE and find UID intersection.
-    for (size_t i = 0; i < mpi_size; ++i) {
-        // Get displaced iterators.
-        auto globalUidsBegin = globalUids.begin() + globalDisps[i];
-        auto globalUidsEnd   = globalUids.begin() + globalDisps[i + 1];
-
-        // Get intersection.
-        std::set_intersection(localUids.begin(), localUids.end(), globalUidsBegin, globalUidsEnd,
-                              std::back_inserter(uidIntersection));
-
-        // Set intersection displacement.
-        disps.push_back(static_cast<int>(uidIntersection.size()));
+// Group local indices by partition, keeping UID order within each partition, and return them with the
+// partition displacements. UIDs without partition are skipped.
+std::pair<std::vector<idx_t>, std::vector<int>> groupByPartition(const std::vector<IdxUid>& localUids,
+                                                                 const std::vector<int>& partitions,
+                                                                 size_t mpi_size) {
+    // Check that every local UID is present in the other function space.
+    if (ATLAS_BUILD_TYPE_DEBUG) {
+        ATLAS_ASSERT(std::find(partitions.begin(), partitions.end(), -1) == partitions.end(),
+                     "Set of all UID intersections does not match local UIDs.");
     }
 
-    // Check that the set of all intersections matches UIDs on local PE.
-    if (ATLAS_BUILD_TYPE_DEBUG) {
-        auto tempUids = uidIntersection;
-        std::sort(tempUids.begin(), tempUids.end(),
-                  [](const IdxUid& a, const IdxUid& b) { return a.second < b.second; });
-        ATLAS_ASSERT(tempUids == localUids, "Set of all UID intersections does not match local UIDs.");
+    auto disps = std::vector<int>(mpi_size + 1, 0);
+    for (const auto partition : partitions) {
+        if (partition >= 0) {
+            ++disps[partition + 1];
+        }
     }
+    std::partial_sum(disps.begin(), disps.end(), disps.begin());
 
-    // Return local indices of intersection and displacements.
-    return make_pair(getUidIdx(uidIntersection), disps);
+    auto idxVec = std::vector<idx_t>(static_cast<size_t>(disps.back()));
+    auto offset = std::vector<int>(disps.begin(), disps.end() - 1);
+    for (size_t i = 0; i < localUids.size(); ++i) {
+        if (partitions[i] >= 0) {
+            idxVec[offset[partitions[i]]++] = localUids[i].first;
+        }
+    }
+    return std::make_pair(idxVec, disps);
 }
 
 
+// Contiguous range of an index list.
+class IdxRange {
+public:
+    IdxRange(const std::vector<idx_t>& idxList, int begin, int end):
+        begin_(idxList.data() + begin), end_(idxList.data() + end) {}
+    const idx_t* begin() const { return begin_; }
+    const idx_t* end() const { return end_; }
+    bool empty() const { return begin_ == end_; }
+
+private:
+    const idx_t* begin_;
+    const idx_t* end_;
+};
+
 // Iterate over a field, in the order of an index list, and apply a functor to
 // each element.
 
 // Recursive ForEach to visit all elements of field.
 template <int Rank, int Dim = 0>
 struct ForEach {
-    template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
+    template <typename IdxList, typename Value, typename Functor, typename... Idxs>
+    static void apply(const IdxList& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
                       Idxs... idxs) {
         // Iterate over dimension Dim of array.
         for (idx_t idx = 0; idx < fieldView.shape(Dim); ++idx) {
@@ -236,8 +285,8 @@ struct ForEach {
 // Beginning of recursion when Dim == 0.
 template <int Rank>
 struct ForEach<Rank, 0> {
-    template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
+    template <typename IdxList, typename Value, typename Functor, typename... Idxs>
+    static void apply(const IdxList& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
                       Idxs... idxs) {
         // Iterate over dimension 0 of array in order defined by idxList.
         for (idx_t idx : idxList) {
@@ -249,14 +298,81 @@ struct ForEach<Rank, 0> {
 // End of recursion when Dim == Rank.
 template <int Rank>
 struct ForEach<Rank, Rank> {
-    template <typename Value, typename Functor, typename... Idxs>
-    static void apply(const std::vector<idx_t>& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
+    template <typename IdxList, typename Value, typename Functor, typename... Idxs>
+    static void apply(const IdxList& idxList, array::ArrayView<Value, Rank>& fieldView, const Functor& f,
                       Idxs... idxs) {
         // Apply functor.
         f(fieldView(idxs...));
     }
 };
 
+// Type tag for the value type of a field.
+template <typename Value>
+struct ValueTag {
+    using type = Value;
+};
+
+// Call functor(ValueTag<Value>, std::integral_constant<int, Rank>) for the value type and rank of a field.
+template <typename Value, typename Functor>
+void dispatchRank(const Field& field, const Functor& functor) {
+    // Available ranks defined in array/LocalView.cc
+    switch (field.rank()) {
+        case 1: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 1>{});
+        }
+        case 2: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 2>{});
+        }
+        case 3: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 3>{});
+        }
+        case 4: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 4>{});
+        }
+        case 5: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 5>{});
+        }
+        case 6: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 6>{});
+        }
+        case 7: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 7>{});
+        }
+        case 8: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 8>{});
+        }
+        case 9: {
+            return functor(ValueTag<Value>{}, std::integral_constant<int, 9>{});
+        }
+        default: {
+            ATLAS_THROW_EXCEPTION("No implementation for rank " + std::to_string(field.rank()));
+        }
+    }
+}
+
+// Determine datatype.
+template <typename Functor>
+void dispatchField(const Field& field, const Functor& functor) {
+    // Available datatypes defined in array/LocalView.cc
+    switch (field.datatype().kind()) {
+        case array::DataType::KIND_REAL64: {
+            return dispatchRank<double>(field, functor);
+        }
+        case array::DataType::KIND_REAL32: {
+            return dispatchRank<float>(field, functor);
+        }
+        case array::DataType::KIND_INT64: {
+            return dispatchRank<long>(field, functor);
+        }
+        case array::DataType::KIND_INT32: {
+            return dispatchRank<int>(field, functor);
+        }
+        default: {
+            ATLAS_THROW_EXCEPTION("No implementation for data type " + field.datatype().str());
+        }
+    }
+}
+
 }  // namespace
 
 void RedistributeGeneric::do_setup() {
@@ -268,20 +384,25 @@ void RedistributeGeneric::do_setup() {
     const auto sourceUidVec = getUidVec(source());
     const auto targetUidVec = getUidVec(target());
 
-    // Communicate UID vectors to all PEs.
-    auto sourceGlobalUids                         = std::vector<uidx_t>{};
-    auto sourceGlobalDisps                        = std::vector<int>{};
-    std::tie(sourceGlobalUids, sourceGlobalDisps) = communicateUid(mpi_comm_, getUidVal(sourceUidVec));
-    auto targetGlobalUids                         = std::vector<uidx_t>{};
-    auto targetGlobalDisps                        = std::vector<int>{};
-    std::tie(targetGlobalUids, targetGlobalDisps) = communicateUid(mpi_comm_, getUidVal(targetUidVec));
-
-    // Get intersection of local UIDs and Global UIDs.
-    std::tie(sourceLocalIdx_, sourceDisps_) = getUidIntersection(mpi_comm_, sourceUidVec, targetGlobalUids, targetGlobalDisps);
-    std::tie(targetLocalIdx_, targetDisps_) = getUidIntersection(mpi_comm_, targetUidVec, sourceGlobalUids, sourceGlobalDisps);
+    // Find the partition holding each UID in the other functionspace.
+    auto sourcePartitions                        = std::vector<int>{};
+    auto targetPartitions                        = std::vector<int>{};
+    std::tie(sourcePartitions, targetPartitions) = matchUids(mpi_comm_, sourceUidVec, targetUidVec);
+
+    // Group local indices by partition, in UID order.
+    const auto mpi_size                     = mpi::comm(mpi_comm_).size();
+    std::tie(sourceLocalIdx_, sourceDisps_) = groupByPartition(sourceUidVec, sourcePartitions, mpi_size);
+    std::tie(targetLocalIdx_, targetDisps_) = groupByPartition(targetUidVec, targetPartitions, mpi_size);
+
+    // Set number of columns exchanged with each PE.
+    auto sendPoints = std::vector<int>{};
+    auto recvPoints = std::vector<int>{};
+    std::adjacent_difference(sourceDisps_.begin() + 1, sourceDisps_.end(), std::back_inserter(sendPoints));
+    std::adjacent_difference(targetDisps_.begin() + 1, targetDisps_.end(), std::back_inserter(recvPoints));
+    exchange_.setup(mpi_comm_, sendPoints, recvPoints);
 }
 
-void RedistributeGeneric::execute(const Field& sourceField, Field& targetField) const {
+void RedistributeGeneric::check(const Field& sourceField, const Field& targetField) const {
     //Check functionspaces match.
     ATLAS_ASSERT(sourceField.functionspace().type() == source().type());
     ATLAS_ASSERT(targetField.functionspace().type() == target().type());
@@ -296,130 +417,74 @@ void RedistributeGeneric::execute(const Field& sourceField, Field& targetField)
     for (idx_t i = 1; i < sourceField.rank(); ++i) {
         ATLAS_ASSERT(sourceField.shape(i) == targetField.shape(i));
     }
+}
 
-    // Perform redistribution.
-    do_execute(sourceField, targetField);
+void RedistributeGeneric::execute(const Field& sourceField, Field& targetField) const {
+    FieldSet sourceFieldSet;
+    FieldSet targetFieldSet;
+    sourceFieldSet.add(sourceField);
+    targetFieldSet.add(targetField);
+    execute(sourceFieldSet, targetFieldSet);
 }
 
 void RedistributeGeneric::execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    // Redistribute all fields in one exchange.
+    execute_start(sourceFieldSet, targetFieldSet);
+    execute_finish(sourceFieldSet, targetFieldSet);
+}
+
+void RedistributeGeneric::execute_start(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
     // Check field set sizes match.
     ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-    // Redistribute fields.
+    // Get number of bytes per column of each field.
+    auto fieldBytes = std::vector<size_t>{};
     for (idx_t i = 0; i < sourceFieldSet.size(); ++i) {
-        execute(sourceFieldSet[i], targetFieldSet[i]);
-    }
-}
-
-// Determine datatype.
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Available datatypes defined in array/LocalView.cc
-    switch (sourceField.datatype().kind()) {
-        case array::DataType::KIND_REAL64: {
-            return do_execute<double>(sourceField, targetField);
-        }
-        case array::DataType::KIND_REAL32: {
-            return do_execute<float>(sourceField, targetField);
-        }
-        case array::DataType::KIND_INT64: {
-            return do_execute<long>(sourceField, targetField);
-        }
-        case array::DataType::KIND_INT32: {
-            return do_execute<int>(sourceField, targetField);
-        }
-        default: {
-            ATLAS_THROW_EXCEPTION("No implementation for data type " + sourceField.datatype().str());
+        check(sourceFieldSet[i], targetFieldSet[i]);
+        size_t elemsPerCol = 1;
+        for (idx_t j = 1; j < sourceFieldSet[i].rank(); ++j) {
+            elemsPerCol *= sourceFieldSet[i].shape(j);
         }
+        fieldBytes.push_back(elemsPerCol * sourceFieldSet[i].datatype().size());
     }
-}
 
-// Determine rank.
-template <typename Value>
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Available ranks defined in array/LocalView.cc
-    switch (sourceField.rank()) {
-        case 1: {
-            return do_execute<Value, 1>(sourceField, targetField);
-        }
-        case 2: {
-            return do_execute<Value, 2>(sourceField, targetField);
-        }
-        case 3: {
-            return do_execute<Value, 3>(sourceField, targetField);
+    // Copy each sourceField to the send buffer, in the order of the columns sent to each PE.
+    exchange_.start(fieldBytes, [&](idx_t jproc, idx_t jfield, char* buffer) {
+        const auto idxRange = IdxRange(sourceLocalIdx_, sourceDisps_[jproc], sourceDisps_[jproc + 1]);
+        if (idxRange.empty()) {
+            return;
         }
-        case 4: {
-            return do_execute<Value, 4>(sourceField, targetField);
-        }
-        case 5: {
-            return do_execute<Value, 5>(sourceField, targetField);
-        }
-        case 6: {
-            return do_execute<Value, 6>(sourceField, targetField);
-        }
-        case 7: {
-            return do_execute<Value, 7>(sourceField, targetField);
-        }
-        case 8: {
-            return do_execute<Value, 8>(sourceField, targetField);
-        }
-        case 9: {
-            return do_execute<Value, 9>(sourceField, targetField);
-        }
-        default: {
-            ATLAS_THROW_EXCEPTION("No implementation for rank " + std::to_string(sourceField.rank()));
-        }
-    }
+        const Field& sourceField = sourceFieldSet[jfield];
+        dispatchField(sourceField, [&](auto value, auto rank) {
+            using Value = typename decltype(value)::type;
+            auto sourceView = array::make_view<Value, decltype(rank)::value>(sourceField);
+            ForEach<decltype(rank)::value>::apply(idxRange, sourceView, [&](const Value& elem) {
+                std::memcpy(buffer, &elem, sizeof(Value));
+                buffer += sizeof(Value);
+            });
+        });
+    });
 }
 
-// Perform redistribution.
-template <typename Value, int Rank>
-void RedistributeGeneric::do_execute(const Field& sourceField, Field& targetField) const {
-    // Get array views.
-    auto sourceView = array::make_view<Value, Rank>(sourceField);
-    auto targetView = array::make_view<Value, Rank>(targetField);
-
-    const auto& comm = mpi::comm(mpi_comm_);
-    auto mpi_size = comm.size();
-
-    // Get number of elems per column.
-    int elemsPerCol = 1;
-    for (int i = 1; i < Rank; ++i) {
-        elemsPerCol *= sourceView.shape(i);
-    }
+void RedistributeGeneric::execute_finish(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-    // Set send displacement and counts vectors.
-    auto sendDisps = std::vector<int>{};
-    sendDisps.reserve(mpi_size + 1);
-    auto sendCounts = std::vector<int>{};
-    sendCounts.reserve(mpi_size);
-    std::transform(sourceDisps_.begin(), sourceDisps_.end(), std::back_inserter(sendDisps),
-                   [&](const int& disp) { return disp * elemsPerCol; });
-    std::adjacent_difference(sendDisps.begin() + 1, sendDisps.end(), std::back_inserter(sendCounts));
-
-    // Set recv displacement and counts vectors.
-    auto recvDisps = std::vector<int>{};
-    recvDisps.reserve(mpi_size + 1);
-    auto recvCounts = std::vector<int>{};
-    recvCounts.reserve(mpi_size);
-    std::transform(targetDisps_.begin(), targetDisps_.end(), std::back_inserter(recvDisps),
-                   [&](const int& disp) { return disp * elemsPerCol; });
-    std::adjacent_difference(recvDisps.begin() + 1, recvDisps.end(), std::back_inserter(recvCounts));
-
-    // Allocate send and recv buffers.
-    auto sendBuffer   = std::vector<Value>(static_cast<size_t>(sendDisps.back()));
-    auto recvBuffer   = std::vector<Value>(static_cast<size_t>(recvDisps.back()));
-    auto sendBufferIt = sendBuffer.begin();
-    auto recvBufferIt = recvBuffer.cbegin();
-
-    // Copy sourceField to sendBuffer.
-    ForEach<Rank>::apply(sourceLocalIdx_, sourceView, [&](const Value& elem) { *sendBufferIt++ = elem; });
-
-    // Perform MPI communication.
-    comm.allToAllv(sendBuffer.data(), sendCounts.data(), sendDisps.data(), recvBuffer.data(), recvCounts.data(),
-                   recvDisps.data());
-
-    // Copy recvBuffer to targetField.
-    ForEach<Rank>::apply(targetLocalIdx_, targetView, [&](Value& elem) { elem = *recvBufferIt++; });
+    // Copy the receive buffer to each targetField.
+    exchange_.finish([&](idx_t jproc, idx_t jfield, const char* buffer) {
+        const auto idxRange = IdxRange(targetLocalIdx_, targetDisps_[jproc], targetDisps_[jproc + 1]);
+        if (idxRange.empty()) {
+            return;
+        }
+        Field targetField = targetFieldSet[jfield];
+        dispatchField(targetField, [&](auto value, auto rank) {
+            using Value = typename decltype(value)::type;
+            auto targetView = array::make_view<Value, decltype(rank)::value>(targetField);
+            ForEach<decltype(rank)::value>::apply(idxRange, targetView, [&](Value& elem) {
+                std::memcpy(&elem, buffer, sizeof(Value));
+                buffer += sizeof(Value);
+            });
+        });
+    });
 }
 
 namespace {
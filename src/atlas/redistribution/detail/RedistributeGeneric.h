@@ -8,7 +8,9 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
+#include "atlas/redistribution/detail/PackedExchange.h"
 #include "atlas/redistribution/detail/RedistributionImpl.h"
 
 namespace atlas {
@@ -27,15 +29,13 @@ public:
 
     void execute(const FieldSet& source, FieldSet& target) const override;
 
+    void execute_start(const FieldSet& source, FieldSet& target) const override;
+
+    void execute_finish(const FieldSet& source, FieldSet& target) const override;
+
 private:
-    // Determine datatype.
-    void do_execute(const Field& source, Field& target) const;
-    // Determine rank.
-    template <typename Value>
-    void do_execute(const Field& source, Field& target) const;
-    // Perform redistribution.
-    template <typename Value, int Rank>
-    void do_execute(const Field& source, Field& target) const;
+    // Check that source and target fields are compatible.
+    void check(const Field& source, const Field& target) const;
 
     // Local indices to send to each PE
     std::vector<idx_t> sourceLocalIdx_{};
@@ -50,6 +50,9 @@ private:
     std::vector<int> targetDisps_{};
 
     std::string mpi_comm_;
+
+    // Persistent buffers and requests of the exchange of all fields.
+    mutable PackedExchange exchange_;
 };
 
 }  // namespace detail
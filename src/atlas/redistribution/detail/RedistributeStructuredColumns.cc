@@ -8,6 +8,7 @@
 #include "RedistributeStructuredColumns.h"
 
 #include <algorithm>
+#include <cstring>
 #include <numeric>
 
 #include "atlas/array/MakeView.h"
@@ -37,15 +38,31 @@ std::vector<outType> transformVector(const std::vector<inType>& inVector, const
     return outVector;
 }
 
-// Visit each index in a StructuredIndexRangeVector.
+// Type tag for the value type of a field.
+template <typename fieldType>
+struct ValueTag {
+    using type = fieldType;
+};
+
+// Determine data type of field and call functor(ValueTag<fieldType>).
 template <typename functorType>
-void forEachIndex(const StructuredIndexRangeVector& ranges, const functorType& functor) {
-    // Loop over all ranges.
-    std::for_each(ranges.cbegin(), ranges.cend(), [&](const StructuredIndexRange& range) {
-        range.forEach(functor);
-        return;
-    });
-    return;
+void dispatchField(const Field& field, const functorType& functor) {
+    switch (field.datatype().kind()) {
+        case array::DataType::KIND_REAL64:
+            return functor(ValueTag<double>{});
+
+        case array::DataType::KIND_REAL32:
+            return functor(ValueTag<float>{});
+
+        case array::DataType::KIND_INT32:
+            return functor(ValueTag<int>{});
+
+        case array::DataType::KIND_INT64:
+            return functor(ValueTag<long>{});
+
+        default:
+            throw_NotImplemented("No implementation for data type " + field.datatype().str(), Here());
+    }
 }
 
 }  // namespace
@@ -94,85 +111,91 @@ void RedistributeStructuredColumns::do_setup() {
     recvIntersections_ = getIntersections(targetRange, sourceRanges);
 
 
-    // Get counts and displacements for MPI communication.
-    auto getCountsDisplacements = [](const StructuredIndexRangeVector& intersections, const idx_t levels) {
-        const auto counts = transformVector<int>(intersections, [&](const StructuredIndexRange& intersection) {
-            return static_cast<int>(intersection.getElemCount() * levels);
+    // Set number of columns exchanged with each PE.
+    auto getElemCounts = [](const StructuredIndexRangeVector& intersections) {
+        return transformVector<int>(intersections, [&](const StructuredIndexRange& intersection) {
+            return static_cast<int>(intersection.getElemCount());
         });
-
-        auto displacements = std::vector<int>{0};
-        std::partial_sum(counts.cbegin(), counts.cend() - 1, std::back_inserter(displacements));
-
-        return std::make_pair(counts, displacements);
     };
 
-    std::tie(sendCounts_, sendDisplacements_) = getCountsDisplacements(sendIntersections_, source_.levels());
-
-    std::tie(recvCounts_, recvDisplacements_) = getCountsDisplacements(recvIntersections_, target_.levels());
-
-
-    // Trim off invalid intersections.
-    auto trimIntersections = [](StructuredIndexRangeVector& intersections) {
-        intersections.erase(
-            std::remove_if(intersections.begin(), intersections.end(),
-                           [](const StructuredIndexRange& intersection) { return !(intersection.getElemCount()); }),
-            intersections.end());
-
-        return;
-    };
-
-    trimIntersections(sendIntersections_);
-    trimIntersections(recvIntersections_);
+    exchange_.setup(mpi_comm_, getElemCounts(sendIntersections_), getElemCounts(recvIntersections_));
 
     return;
 }
 
 void RedistributeStructuredColumns::execute(const Field& sourceField, Field& targetField) const {
-    // Assert that fields are defined on StructuredColumns.
-    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()));
-    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()));
+    FieldSet sourceFieldSet;
+    FieldSet targetFieldSet;
+    sourceFieldSet.add(sourceField);
+    targetFieldSet.add(targetField);
+    execute(sourceFieldSet, targetFieldSet);
 
-    // Check that grids match.
-    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()).grid().name() == source_.grid().name());
-    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()).grid().name() == target_.grid().name());
-
-    // Check levels match.
-    ATLAS_ASSERT(sourceField.levels() == source_.levels());
-    ATLAS_ASSERT(targetField.levels() == target_.levels());
+    return;
+}
 
-    // Determine data type of field and execute.
-    switch (sourceField.datatype().kind()) {
-        case array::DataType::KIND_REAL64:
-            do_execute<double>(sourceField, targetField);
-            break;
+void RedistributeStructuredColumns::execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    execute_start(sourceFieldSet, targetFieldSet);
+    execute_finish(sourceFieldSet, targetFieldSet);
 
-        case array::DataType::KIND_REAL32:
-            do_execute<float>(sourceField, targetField);
-            break;
+    return;
+}
 
-        case array::DataType::KIND_INT32:
-            do_execute<int>(sourceField, targetField);
-            break;
+void RedistributeStructuredColumns::execute_start(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
+    // Check that both FieldSets are the same size.
+    ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-        case array::DataType::KIND_INT64:
-            do_execute<long>(sourceField, targetField);
-            break;
+    // Get number of bytes per column of each field.
+    auto fieldBytes = std::vector<size_t>{};
+    std::for_each(sourceFieldSet.cbegin(), sourceFieldSet.cend(), [&](const Field& sourceField) {
+        check(sourceField, targetFieldSet[static_cast<idx_t>(fieldBytes.size())]);
+        fieldBytes.push_back(source_.levels() * sourceField.datatype().size());
+        return;
+    });
 
-        default:
-            throw_NotImplemented("No implementation for data type " + sourceField.datatype().str(), Here());
-    }
+    // Write data to buffer.
+    exchange_.start(fieldBytes, [&](idx_t jproc, idx_t jfield, char* buffer) {
+        const Field& sourceField = sourceFieldSet[jfield];
+        dispatchField(sourceField, [&](auto value) {
+            using fieldType       = typename decltype(value)::type;
+            const auto sourceView = array::make_view<fieldType, 2>(sourceField);
+
+            // Loop over levels
+            sendIntersections_[jproc].forEach([&](const idx_t i, const idx_t j) {
+                const auto iNode = source_.index(i, j);
+                const auto kEnd  = source_.levels();
+                for (idx_t k = 0; k < kEnd; ++k) {
+                    std::memcpy(buffer, &sourceView(iNode, k), sizeof(fieldType));
+                    buffer += sizeof(fieldType);
+                }
+                return;
+            });
+        });
+    });
 
     return;
 }
 
-void RedistributeStructuredColumns::execute(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
-    // Check that both FieldSets are the same size.
+void RedistributeStructuredColumns::execute_finish(const FieldSet& sourceFieldSet, FieldSet& targetFieldSet) const {
     ATLAS_ASSERT(sourceFieldSet.size() == targetFieldSet.size());
 
-    auto targetFieldSetIt = targetFieldSet.begin();
-    std::for_each(sourceFieldSet.cbegin(), sourceFieldSet.cend(), [&](const Field& sourceField) {
-        execute(sourceField, *targetFieldSetIt++);
-        return;
+    // Read data from buffer.
+    exchange_.finish([&](idx_t jproc, idx_t jfield, const char* buffer) {
+        Field targetField = targetFieldSet[jfield];
+        dispatchField(targetField, [&](auto value) {
+            using fieldType = typename decltype(value)::type;
+            auto targetView = array::make_view<fieldType, 2>(targetField);
+
+            // Loop over levels
+            recvIntersections_[jproc].forEach([&](const idx_t i, const idx_t j) {
+                const auto iNode = target_.index(i, j);
+                const auto kEnd  = target_.levels();
+                for (idx_t k = 0; k < kEnd; ++k) {
+                    std::memcpy(&targetView(iNode, k), buffer, sizeof(fieldType));
+                    buffer += sizeof(fieldType);
+                }
+                return;
+            });
+        });
     });
 
     return;
@@ -182,58 +205,21 @@ void RedistributeStructuredColumns::execute(const FieldSet& sourceFieldSet, Fiel
 // Class private methods implementation.
 //========================================================================
 
-template <typename fieldType>
-void RedistributeStructuredColumns::do_execute(const Field& sourceField, Field& targetField) const {
-    // Make Atlas view objects.
-    const auto sourceView = array::make_view<fieldType, 2>(sourceField);
-    auto targetView       = array::make_view<fieldType, 2>(targetField);
-
-
-    // Get buffer sizes.
-    const auto nSend = sendCounts_.back() + sendDisplacements_.back();
-    const auto nRecv = recvCounts_.back() + recvDisplacements_.back();
-
-
-    // Allocate send and receive buffers.
-    auto sendBuffer = std::vector<fieldType>(static_cast<size_t>(nSend));
-    auto recvBuffer = std::vector<fieldType>(static_cast<size_t>(nRecv));
-
-
-    // Set send functor.
-    auto sendBufferIt = sendBuffer.begin();
-    auto sendFunctor  = [&](const idx_t i, const idx_t j) {
-        // Loop over levels
-        const auto iNode = source_.index(i, j);
-        const auto kEnd  = source_.levels();
-        for (idx_t k = 0; k < kEnd; ++k) {
-            *sendBufferIt++ = sourceView(iNode, k);
-        }
-        return;
-    };
-
-
-    // Set receive functor.
-    auto recvBufferIt = recvBuffer.cbegin();
-    auto recvFunctor  = [&](const idx_t i, const idx_t j) {
-        // Loop over levels
-        const auto iNode = target_.index(i, j);
-        const auto kEnd  = target_.levels();
-        for (idx_t k = 0; k < kEnd; ++k) {
-            targetView(iNode, k) = *recvBufferIt++;
-        }
-        return;
-    };
-
+void RedistributeStructuredColumns::check(const Field& sourceField, const Field& targetField) const {
+    // Assert that fields are defined on StructuredColumns.
+    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()));
+    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()));
 
-    // Write data to buffer.
-    forEachIndex(sendIntersections_, sendFunctor);
+    // Check that grids match.
+    ATLAS_ASSERT(functionspace::StructuredColumns(sourceField.functionspace()).grid().name() == source_.grid().name());
+    ATLAS_ASSERT(functionspace::StructuredColumns(targetField.functionspace()).grid().name() == target_.grid().name());
 
-    // Communicate.
-    mpi::comm(mpi_comm_).allToAllv(sendBuffer.data(), sendCounts_.data(), sendDisplacements_.data(), recvBuffer.data(),
-                                   recvCounts_.data(), recvDisplacements_.data());
+    // Check levels match.
+    ATLAS_ASSERT(sourceField.levels() == source_.levels());
+    ATLAS_ASSERT(targetField.levels() == target_.levels());
 
-    // Read data from buffer.
-    forEachIndex(recvIntersections_, recvFunctor);
+    // Check data types match.
+    ATLAS_ASSERT(sourceField.datatype() == targetField.datatype());
 
     return;
 }
@@ -9,6 +9,7 @@
 
 #include <vector>
 
+#include "atlas/redistribution/detail/PackedExchange.h"
 #include "atlas/redistribution/detail/RedistributionImpl.h"
 #include "atlas/redistribution/detail/RedistributionImplFactory.h"
 
@@ -67,31 +68,35 @@ public:
 
     /// \brief    Redistributes source field set to target fields set.
     ///
-    /// \details  Transfers source field set to target field set via
-    ///           multiple invocations of execute(sourceField, targetField).
+    /// \details  Transfers all fields of the source field set to the target
+    ///           field set in one exchange, via execute_start and
+    ///           execute_finish.
     ///
     /// \param[in]  source  input field set.
     /// \param[out] target  output field set.
     void execute(const FieldSet& source, FieldSet& target) const override;
 
+    /// \brief    Packs and sends all source fields with non-blocking
+    ///           point-to-point messages to the PEs that need them.
+    void execute_start(const FieldSet& source, FieldSet& target) const override;
+
+    /// \brief    Waits for all messages and unpacks the target fields.
+    void execute_finish(const FieldSet& source, FieldSet& target) const override;
+
 private:
-    // Generic execute call to handle different field types.
-    template <typename fieldType>
-    void do_execute(const Field& source, Field& target) const;
+    // Check that source and target fields are compatible.
+    void check(const Field& source, const Field& target) const;
 
     // FunctionSpaces recast to StructuredColumns.
     functionspace::StructuredColumns source_;
     functionspace::StructuredColumns target_;
 
-    // Vectors of index range intersection objects.
+    // Vectors of index range intersection objects, one per PE.
     StructuredIndexRangeVector sendIntersections_{};
     StructuredIndexRangeVector recvIntersections_{};
 
-    // Counts and displacements for MPI communications.
-    std::vector<int> sendCounts_{};
-    std::vector<int> sendDisplacements_{};
-    std::vector<int> recvCounts_{};
-    std::vector<int> recvDisplacements_{};
+    // Persistent buffers and requests of the exchange of all fields.
+    mutable PackedExchange exchange_;
 
     std::string mpi_comm_;
 };
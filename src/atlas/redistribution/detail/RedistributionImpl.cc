@@ -17,6 +17,12 @@ void RedistributionImpl::setup(const FunctionSpace& source, const FunctionSpace&
     do_setup();
 }
 
+void RedistributionImpl::execute_start(const FieldSet& source, FieldSet& target) const {
+    execute(source, target);
+}
+
+void RedistributionImpl::execute_finish(const FieldSet&, FieldSet&) const {}
+
 const FunctionSpace& RedistributionImpl::source() const {
     return source_;
 }
@@ -47,6 +47,17 @@ public:
     /// \brief  Maps source field set to target field set.
     virtual void execute(const FieldSet& source, FieldSet& target) const = 0;
 
+    /// \brief  Starts mapping source field set to target field set.
+    ///
+    /// \details Source fields are packed and sent before returning, and may
+    ///          be modified afterwards. Target fields must not be accessed
+    ///          until execute_finish is called with the same field sets.
+    ///          The default implementation performs the complete mapping.
+    virtual void execute_start(const FieldSet& source, FieldSet& target) const;
+
+    /// \brief  Completes the mapping started with execute_start.
+    virtual void execute_finish(const FieldSet& source, FieldSet& target) const;
+
     /// \brief  Get const reference to source function space.
     const FunctionSpace& source() const;
 
@@ -316,7 +316,6 @@ void TransIFS::invtrans_adj(const FieldSet& gpfields, FieldSet& spfields, const
 
 void TransIFS::invtrans_grad(const Field& spfield, Field& gradfield, const eckit::Configuration& config) const {
     ATLAS_ASSERT(Spectral(spfield.functionspace()));
-    ATLAS_ASSERT(NodeColumns(gradfield.functionspace()));
     if (StructuredColumns(gradfield.functionspace())) {
         __invtrans_grad(Spectral(spfield.functionspace()), spfield, StructuredColumns(gradfield.functionspace()),
                         gradfield, config);
@@ -607,6 +606,19 @@ struct PackNodeColumns {
     }
 };
 
+// Owned points of StructuredColumns in the order expected by trans, i.e. latitude row by latitude row,
+// which differs from the storage order for StructuredColumns with ordering "tiles"
+std::vector<idx_t> trans_ordered_points(const StructuredColumns& sc) {
+    std::vector<idx_t> nodes;
+    nodes.reserve(sc.sizeOwned());
+    for (idx_t j = sc.j_begin(); j < sc.j_end(); ++j) {
+        for (idx_t i = sc.i_begin(j); i < sc.i_end(j); ++i) {
+            nodes.emplace_back(sc.index(i, j));
+        }
+    }
+    return nodes;
+}
+
 struct PackStructuredColumns {
     LocalView<double, 2>& rgpview_;
     size_t f;
@@ -614,15 +626,16 @@ struct PackStructuredColumns {
     PackStructuredColumns(LocalView<double, 2>& rgpview): rgpview_(rgpview), f(0) {}
 
     void operator()(const StructuredColumns& sc, const Field& field, idx_t components = 0) {
+        const std::vector<idx_t> nodes = trans_ordered_points(sc);
         switch (field.rank()) {
             case 1:
-                pack_1(sc, field, components);
+                pack_1(nodes, field, components);
                 break;
             case 2:
-                pack_2(sc, field, components);
+                pack_2(nodes, field, components);
                 break;
             case 3:
-                pack_3(sc, field, components);
+                pack_3(nodes, field, components);
                 break;
             default:
                 ATLAS_DEBUG_VAR(field.rank());
@@ -631,25 +644,25 @@ struct PackStructuredColumns {
         }
     }
 
-    void pack_1(const StructuredColumns& sc, const Field& field, idx_t) {
+    void pack_1(const std::vector<idx_t>& nodes, const Field& field, idx_t) {
         auto gpfield = make_view<double, 1>(field);
 
-        for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-            rgpview_(f, jnode) = gpfield(jnode);
+        for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+            rgpview_(f, jnode) = gpfield(nodes[jnode]);
         }
         ++f;
     }
-    void pack_2(const StructuredColumns& sc, const Field& field, idx_t) {
+    void pack_2(const std::vector<idx_t>& nodes, const Field& field, idx_t) {
         auto gpfield      = make_view<double, 2>(field);
         const idx_t nvars = gpfield.shape(1);
         for (idx_t jvar = 0; jvar < nvars; ++jvar) {
-            for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-                rgpview_(f, jnode) = gpfield(jnode, jvar);
+            for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+                rgpview_(f, jnode) = gpfield(nodes[jnode], jvar);
             }
             ++f;
         }
     }
-    void pack_3(const StructuredColumns& sc, const Field& field, idx_t components) {
+    void pack_3(const std::vector<idx_t>& nodes, const Field& field, idx_t components) {
         auto gpfield = make_view<double, 3>(field);
         if (not components) {
             components = gpfield.shape(2);
@@ -657,8 +670,8 @@ struct PackStructuredColumns {
         for (idx_t jcomp = 0; jcomp < components; ++jcomp) {
             const idx_t nvars = gpfield.shape(1);
             for (idx_t jvar = 0; jvar < nvars; ++jvar) {
-                for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-                    rgpview_(f, jnode) = gpfield(jnode, jvar, jcomp);
+                for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+                    rgpview_(f, jnode) = gpfield(nodes[jnode], jvar, jcomp);
                 }
                 ++f;
             }
@@ -786,15 +799,16 @@ struct UnpackStructuredColumns {
     UnpackStructuredColumns(const LocalView<double, 2>& rgpview): rgpview_(rgpview), f(0) {}
 
     void operator()(const StructuredColumns& sc, Field& field, int components = 0) {
+        const std::vector<idx_t> nodes = trans_ordered_points(sc);
         switch (field.rank()) {
             case 1:
-                unpack_1(sc, field, components);
+                unpack_1(nodes, field, components);
                 break;
             case 2:
-                unpack_2(sc, field, components);
+                unpack_2(nodes, field, components);
                 break;
             case 3:
-                unpack_3(sc, field, components);
+                unpack_3(nodes, field, components);
                 break;
             default:
                 ATLAS_DEBUG_VAR(field.rank());
@@ -803,32 +817,32 @@ struct UnpackStructuredColumns {
         }
     }
 
-    void unpack_1(const StructuredColumns& sc, Field& field, idx_t) {
+    void unpack_1(const std::vector<idx_t>& nodes, Field& field, idx_t) {
         auto gpfield = make_view<double, 1>(field);
-        for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-            gpfield(jnode) = rgpview_(f, jnode);
+        for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+            gpfield(nodes[jnode]) = rgpview_(f, jnode);
         }
         ++f;
     }
-    void unpack_2(const StructuredColumns& sc, Field& field, idx_t) {
+    void unpack_2(const std::vector<idx_t>& nodes, Field& field, idx_t) {
         auto gpfield      = make_view<double, 2>(field);
         const idx_t nvars = gpfield.shape(1);
         for (idx_t jvar = 0; jvar < nvars; ++jvar) {
-            for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-                gpfield(jnode, jvar) = rgpview_(f, jnode);
+            for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+                gpfield(nodes[jnode], jvar) = rgpview_(f, jnode);
             }
             ++f;
         }
     }
-    void unpack_3(const StructuredColumns& sc, Field& field, idx_t components) {
+    void unpack_3(const std::vector<idx_t>& nodes, Field& field, idx_t components) {
         auto gpfield = make_view<double, 3>(field);
         if (not components) {
             components = gpfield.shape(2);
         }
         for (idx_t jcomp = 0; jcomp < components; ++jcomp) {
             for (idx_t jlev = 0; jlev < gpfield.shape(1); ++jlev) {
-                for (idx_t jnode = 0; jnode < sc.sizeOwned(); ++jnode) {
-                    gpfield(jnode, jlev, jcomp) = rgpview_(f, jnode);
+                for (idx_t jnode = 0; jnode < idx_t(nodes.size()); ++jnode) {
+                    gpfield(nodes[jnode], jlev, jcomp) = rgpview_(f, jnode);
                 }
                 ++f;
             }
@@ -2119,20 +2133,21 @@ void TransIFS::__invtrans_grad(const Spectral& sp, const FieldSet& spfields, con
         int f = nfld;  // skip to where derivatives start
         for (idx_t dim = 0; dim < 2; ++dim) {
             for (idx_t jfld = 0; jfld < gradfields.size(); ++jfld) {
-                const idx_t nb_nodes = StructuredColumns(gradfields[jfld].functionspace()).sizeOwned();
-                const idx_t nlev     = gradfields[jfld].levels();
+                const std::vector<idx_t> nodes = trans_ordered_points(StructuredColumns(gradfields[jfld].functionspace()));
+                const idx_t nb_nodes           = static_cast<idx_t>(nodes.size());
+                const idx_t nlev               = gradfields[jfld].levels();
                 if (nlev) {
                     auto field = make_view<double, 3>(gradfields[jfld]);
                     for (idx_t jlev = 0; jlev < nlev; ++jlev) {
                         for (idx_t jnode = 0; jnode < nb_nodes; ++jnode) {
-                            field(jnode, jlev, 1 - dim) = rgpview(f, jnode);
+                            field(nodes[jnode], jlev, 1 - dim) = rgpview(f, jnode);
                         }
                     }
                 }
                 else {
                     auto field = make_view<double, 2>(gradfields[jfld]);
                     for (idx_t jnode = 0; jnode < nb_nodes; ++jnode) {
-                        field(jnode, 1 - dim) = rgpview(f, jnode);
+                        field(nodes[jnode], 1 - dim) = rgpview(f, jnode);
                     }
                 }
                 ++f;
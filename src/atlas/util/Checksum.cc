@@ -10,6 +10,7 @@
 
 #include <stdint.h>
 #include <cstddef>
+#include <cstring>
 
 #include "atlas/util/Checksum.h"
 
@@ -29,6 +30,16 @@ static uint16_t fletcher16(const uint8_t* data, int size) {
     return s2;
 }
 
+// Finaliser of splitmix64
+inline uint64_t mix64(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
 }  // namespace
 
 static checksum_t checksum(const char* data, size_t size) {
@@ -59,5 +70,22 @@ checksum_t checksum(const checksum_t values[], size_t size) {
     return checksum(reinterpret_cast<const char*>(&values[0]), size * sizeof(checksum_t) / sizeof(char));
 }
 
+checksum_t hash(const void* data, size_t bytes, checksum_t seed) {
+    const char* p = static_cast<const char*>(data);
+    uint64_t h    = mix64(uint64_t(seed) + 0x9e3779b97f4a7c15ULL);
+    uint64_t word;
+    size_t n = 0;
+    for (; n + sizeof(word) <= bytes; n += sizeof(word)) {
+        std::memcpy(&word, p + n, sizeof(word));
+        h = mix64(h ^ word);
+    }
+    if (n < bytes) {
+        word = 0;
+        std::memcpy(&word, p + n, bytes - n);
+        h = mix64(h ^ word);
+    }
+    return mix64(h ^ uint64_t(bytes));
+}
+
 }  // namespace util
 }  // namespace atlas
@@ -23,5 +23,10 @@ checksum_t checksum(const float values[], size_t size);
 checksum_t checksum(const double values[], size_t size);
 checksum_t checksum(const checksum_t values[], size_t size);
 
+/// @brief 64-bit hash of given bytes, mixed with a seed.
+/// Hashes of different seeds (e.g. global indices) are well distributed, so that they can be combined
+/// with a commutative operation such as a sum, independent of order.
+checksum_t hash(const void* data, size_t bytes, checksum_t seed);
+
 }  // namespace util
 }  // namespace atlas
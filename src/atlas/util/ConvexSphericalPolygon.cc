@@ -8,6 +8,8 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 
@@ -514,6 +516,242 @@ PointXYZ ConvexSphericalPolygon::GreatCircleSegment::intersect(const GreatCircle
 }
 
 
+//------------------------------------------------------------------------------------------------------
+
+void ConvexSphericalPolygonBatch::Coordinates::resize(size_t n) {
+    for (int v = 0; v < MAX_SIZE; ++v) {
+        x[v].resize(n);
+        y[v].resize(n);
+        z[v].resize(n);
+    }
+}
+
+void ConvexSphericalPolygonBatch::reserve(size_t capacity) {
+    if (capacity > size_candidate_.size()) {
+        coords_.resize(capacity);
+        size_candidate_.resize(capacity);
+        centroid_x_.resize(capacity);
+        centroid_y_.resize(capacity);
+        centroid_z_.resize(capacity);
+        radius_.resize(capacity);
+    }
+}
+
+void ConvexSphericalPolygonBatch::clear() {
+    size_ = 0;
+}
+
+void ConvexSphericalPolygonBatch::add(const ConvexSphericalPolygon& polygon) {
+    if (size_ == size_candidate_.size()) {
+        reserve(std::max<size_t>(16, 2 * size_));
+    }
+    const int n = polygon ? static_cast<int>(polygon.size()) : 0;
+    ATLAS_ASSERT(n <= MAX_SIZE);
+    for (int v = 0; v < n; ++v) {
+        coords_.set(v, size_, polygon[v]);
+    }
+    size_candidate_[size_] = n;
+    if (n > 0) {
+        const PointXYZ& centroid = polygon.centroid();
+        centroid_x_[size_]       = centroid[0];
+        centroid_y_[size_]       = centroid[1];
+        centroid_z_[size_]       = centroid[2];
+        radius_[size_]           = polygon.radius();
+    }
+    ++size_;
+}
+
+void ConvexSphericalPolygonBatch::intersect(const ConvexSphericalPolygon& target, double pointsSameEPS) {
+    area_.assign(size_, 0.);
+    cx_.assign(size_, 0.);
+    cy_.assign(size_, 0.);
+    cz_.assign(size_, 0.);
+    nv_.assign(size_, 0);
+    if (not target) {
+        return;
+    }
+
+    bool fpe_disabled = atlas::library::disable_floating_point_exception(FE_INVALID);
+
+    // Early rejection of candidates whose bounding circle does not overlap with the target's
+    const PointXYZ& tc = target.centroid();
+    const double tr    = target.radius();
+    active_.clear();
+    for (size_t c = 0; c < size_; ++c) {
+        const double dx = centroid_x_[c] - tc[0];
+        const double dy = centroid_y_[c] - tc[1];
+        const double dz = centroid_z_[c] - tc[2];
+        const double r  = radius_[c] + tr + pointsSameEPS;
+        if (size_candidate_[c] > 2 && dx * dx + dy * dy + dz * dz <= r * r) {
+            active_.emplace_back(c);
+        }
+    }
+    const size_t nactive = active_.size();
+
+    if (nactive > 0) {
+        work_.resize(nactive);
+        clipped_.resize(nactive);
+        nv_work_.resize(nactive);
+        nv_clipped_.resize(nactive);
+        for (int v = 0; v < MAX_SIZE; ++v) {
+            side_[v].resize(nactive);
+        }
+        for (size_t k = 0; k < nactive; ++k) {
+            const size_t c = active_[k];
+            nv_work_[k]    = size_candidate_[c];
+            for (int v = 0; v < nv_work_[k]; ++v) {
+                work_.x[v][k] = coords_.x[v][c];
+                work_.y[v][k] = coords_.y[v][c];
+                work_.z[v][k] = coords_.z[v][c];
+            }
+        }
+
+        // Clip all candidates with each edge of the target
+        const size_t tsize = target.size();
+        for (size_t i = 0; i < tsize; ++i) {
+            const PointXYZ& s1 = target[i];
+            const PointXYZ& s2 = target[(i != tsize - 1) ? i + 1 : 0];
+            clip(GreatCircleSegment(s1, s2), nactive, pointsSameEPS);
+        }
+
+        compute_areas(nactive);
+    }
+
+    if (fpe_disabled) {
+        atlas::library::enable_floating_point_exception(FE_INVALID);
+    }
+}
+
+void ConvexSphericalPolygonBatch::clip(const GreatCircleSegment& great_circle, size_t nactive, double pointsSameEPS) {
+    constexpr double offset = -1.5 * EPS;
+
+    int max_nv = 0;
+    for (size_t k = 0; k < nactive; ++k) {
+        max_nv = std::max(max_nv, nv_work_[k]);
+    }
+    if (max_nv == 0) {
+        return;
+    }
+
+    // Signed distance of every vertex of every candidate to the great circle plane.
+    // Vertices beyond the size of a candidate hold stale but finite values, and are ignored below.
+    const PointXYZ& n = great_circle.cross();
+    const double nx   = n[0];
+    const double ny   = n[1];
+    const double nz   = n[2];
+    for (int v = 0; v < max_nv; ++v) {
+        const double* x = work_.x[v].data();
+        const double* y = work_.y[v].data();
+        const double* z = work_.z[v].data();
+        double* side    = side_[v].data();
+        for (size_t k = 0; k < nactive; ++k) {
+            side[k] = nx * x[k] + ny * y[k] + nz * z[k];
+        }
+    }
+
+    // Same clipping logic as ConvexSphericalPolygon::clip, with hemisphere tests taken from side_
+    for (size_t k = 0; k < nactive; ++k) {
+        const int nv = nv_work_[k];
+        if (nv < 3) {
+            nv_clipped_[k] = 0;
+            continue;
+        }
+        int nc   = 0;
+        auto add = [&](const PointXYZ& p) {
+            ATLAS_ASSERT(nc < MAX_SIZE);
+            clipped_.set(nc++, k, p);
+        };
+        bool first_in = (side_[0][k] >= offset);
+        for (int i = 0; i < nv; ++i) {
+            const int in   = (i + 1) % nv;
+            bool second_in = (side_[in][k] >= offset);
+            if (first_in and second_in) {
+                add(work_.point(in, k));
+            }
+            else if (first_in != second_in) {
+                const PointXYZ p_i  = work_.point(i, k);
+                const PointXYZ p_in = work_.point(in, k);
+                const GreatCircleSegment segment(p_i, p_in);
+                PointXYZ ip = great_circle.intersect(segment, nullptr, pointsSameEPS);
+                if (ip[0] == 1 and ip[1] == 1 and ip[2] == 1) {
+                    // consider the segments parallel
+                    add(p_in);
+                    first_in = second_in;
+                    continue;
+                }
+                if (second_in) {
+                    const int inn = (in + 1) % nv;
+                    const GreatCircleSegment segment_n(p_in, work_.point(inn, k));
+                    if (segment.inLeftHemisphere(ip, offset) and segment_n.inLeftHemisphere(ip, offset) and
+                        (PointXYZ::distance(ip, p_in) > pointsSameEPS)) {
+                        add(ip);
+                    }
+                    add(p_in);
+                }
+                else {
+                    if (PointXYZ::distance(ip, p_i) > pointsSameEPS) {
+                        add(ip);
+                    }
+                }
+            }
+            first_in = second_in;
+        }
+        nv_clipped_[k] = (nc < 3) ? 0 : nc;
+    }
+    std::swap(work_, clipped_);
+    std::swap(nv_work_, nv_clipped_);
+}
+
+// Same triangulation as ConvexSphericalPolygon::triangulate, looping over candidates for each sub-triangle
+void ConvexSphericalPolygonBatch::compute_areas(size_t nactive) {
+    std::vector<double> area(nactive, 0.);
+    std::vector<double> cx(nactive, 0.);
+    std::vector<double> cy(nactive, 0.);
+    std::vector<double> cz(nactive, 0.);
+    const double* ax = work_.x[0].data();
+    const double* ay = work_.y[0].data();
+    const double* az = work_.z[0].data();
+    for (int i = 1; i < MAX_SIZE - 1; ++i) {
+        const double* bx = work_.x[i].data();
+        const double* by = work_.y[i].data();
+        const double* bz = work_.z[i].data();
+        const double* cxv = work_.x[i + 1].data();
+        const double* cyv = work_.y[i + 1].data();
+        const double* czv = work_.z[i + 1].data();
+        const int* nv     = nv_work_.data();
+        for (size_t k = 0; k < nactive; ++k) {
+            if (i + 1 < nv[k]) {
+                const double abc = (ax[k] * bx[k] + ay[k] * by[k] + az[k] * bz[k]) +
+                                   (bx[k] * cxv[k] + by[k] * cyv[k] + bz[k] * czv[k]) +
+                                   (cxv[k] * ax[k] + cyv[k] * ay[k] + czv[k] * az[k]);
+                const double a_bc = ax[k] * (by[k] * czv[k] - bz[k] * cyv[k]) +
+                                    ay[k] * (bz[k] * cxv[k] - bx[k] * czv[k]) +
+                                    az[k] * (bx[k] * cyv[k] - by[k] * cxv[k]);
+                const double t  = 2. * std::atan(std::abs(a_bc) / (1. + abc));
+                const double sx = ax[k] + bx[k] + cxv[k];
+                const double sy = ay[k] + by[k] + cyv[k];
+                const double sz = az[k] + bz[k] + czv[k];
+                const double w  = t / std::sqrt(sx * sx + sy * sy + sz * sz);
+                area[k] += t;
+                cx[k] += w * sx;
+                cy[k] += w * sy;
+                cz[k] += w * sz;
+            }
+        }
+    }
+    for (size_t k = 0; k < nactive; ++k) {
+        const size_t c = active_[k];
+        nv_[c]         = nv_work_[k];
+        area_[c]       = area[k];
+        if (area[k] > 0.) {
+            const double norm = std::sqrt(cx[k] * cx[k] + cy[k] * cy[k] + cz[k] * cz[k]);
+            cx_[c]            = cx[k] / norm;
+            cy_[c]            = cy[k] / norm;
+            cz_[c]            = cz[k] / norm;
+        }
+    }
+}
+
 //------------------------------------------------------------------------------------------------------
 
 }  // namespace util
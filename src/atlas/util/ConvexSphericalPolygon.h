@@ -167,5 +167,98 @@ private:
 
 //------------------------------------------------------------------------------------------------------
 
+/*
+ * @brief Batch of candidate polygons stored in structure-of-arrays layout, to be intersected
+ *        against a single target polygon at once.
+ *
+ * Candidates whose bounding circles (centroid, radius) do not overlap with the target are rejected
+ * before any clipping. Hemisphere tests and areas are computed in loops over candidates with
+ * unit stride, so that they can be vectorised. Buffers are kept between calls to intersect(),
+ * so a batch is meant to be reused, e.g. one per thread.
+ *
+ * Usage:
+ *     ConvexSphericalPolygonBatch batch;
+ *     for (auto& c : candidates) { batch.add(c); }
+ *     batch.intersect(target);
+ *     for (size_t i = 0; i < batch.size(); ++i) { batch.area(i); batch.centroid(i); }
+ */
+class ConvexSphericalPolygonBatch {
+public:
+    static constexpr int MAX_SIZE = ConvexSphericalPolygon::MAX_SIZE;
+
+public:
+    ConvexSphericalPolygonBatch() = default;
+
+    void reserve(size_t capacity);
+
+    void clear();
+
+    /// @brief Append a candidate polygon to the batch
+    void add(const ConvexSphericalPolygon&);
+
+    size_t size() const { return size_; }
+
+    /// @brief Intersect the target polygon with all candidates of the batch.
+    ///        The target polygon clips each candidate, as in target.intersect(candidate) when the target is the
+    ///        larger polygon.
+    void intersect(const ConvexSphericalPolygon& target,
+                   double pointsSameEPS = std::numeric_limits<double>::epsilon());
+
+    /// @brief Area of the intersection of the target with candidate i (0 when they do not intersect)
+    double area(size_t i) const { return area_[i]; }
+
+    /// @brief Centroid of the intersection of the target with candidate i
+    PointXYZ centroid(size_t i) const { return PointXYZ{cx_[i], cy_[i], cz_[i]}; }
+
+    /// @brief Number of vertices of the intersection of the target with candidate i
+    int intersection_size(size_t i) const { return nv_[i]; }
+
+private:
+    struct Coordinates {
+        std::array<std::vector<double>, MAX_SIZE> x;
+        std::array<std::vector<double>, MAX_SIZE> y;
+        std::array<std::vector<double>, MAX_SIZE> z;
+        void resize(size_t n);
+        PointXYZ point(int v, size_t c) const { return PointXYZ{x[v][c], y[v][c], z[v][c]}; }
+        void set(int v, size_t c, const PointXYZ& p) {
+            x[v][c] = p[0];
+            y[v][c] = p[1];
+            z[v][c] = p[2];
+        }
+    };
+
+    void clip(const ConvexSphericalPolygon::GreatCircleSegment&, size_t nactive, double pointsSameEPS);
+
+    void compute_areas(size_t nactive);
+
+private:
+    size_t size_{0};
+
+    // candidates as added
+    Coordinates coords_;
+    std::vector<int> size_candidate_;
+    std::vector<double> centroid_x_;
+    std::vector<double> centroid_y_;
+    std::vector<double> centroid_z_;
+    std::vector<double> radius_;
+
+    // work buffers, compacted to candidates surviving early rejection
+    std::vector<size_t> active_;
+    Coordinates work_;
+    Coordinates clipped_;
+    std::vector<int> nv_work_;
+    std::vector<int> nv_clipped_;
+    std::array<std::vector<double>, MAX_SIZE> side_;
+
+    // results per candidate
+    std::vector<double> area_;
+    std::vector<double> cx_;
+    std::vector<double> cy_;
+    std::vector<double> cz_;
+    std::vector<int> nv_;
+};
+
+//------------------------------------------------------------------------------------------------------
+
 }  // namespace util
 }  // namespace atlas
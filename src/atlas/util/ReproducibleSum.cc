@@ -0,0 +1,122 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/ReproducibleSum.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace util {
+
+//------------------------------------------------------------------------------------------------------
+
+namespace {
+constexpr ReproducibleSum::word_t base = ReproducibleSum::word_t(1) << 32;
+
+// floor(w / 2^32), also for negative w
+inline ReproducibleSum::word_t carry_of(ReproducibleSum::word_t w) {
+    return w >= 0 ? w / base : -((-w + base - 1) / base);
+}
+}  // namespace
+
+ReproducibleSum& ReproducibleSum::operator+=(const ReproducibleSum& other) {
+    ReproducibleSum o = other;
+    o.normalise();
+    normalise();
+    for (int i = 0; i < nb_words; ++i) {
+        words_[i] += o.words_[i];
+    }
+    for (int i = 0; i < 3; ++i) {
+        nonfinite_[i] += o.nonfinite_[i];
+    }
+    pending_ = 2;
+    return *this;
+}
+
+void ReproducibleSum::normalise() {
+    for (int i = 0; i < nb_words - 1; ++i) {
+        const word_t carry = carry_of(words_[i]);
+        words_[i] -= carry * base;
+        words_[i + 1] += carry;
+    }
+    pending_ = 1;
+}
+
+double ReproducibleSum::value() const {
+    if (nonfinite_[2] || (nonfinite_[0] && nonfinite_[1])) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (nonfinite_[0]) {
+        return std::numeric_limits<double>::infinity();
+    }
+    if (nonfinite_[1]) {
+        return -std::numeric_limits<double>::infinity();
+    }
+
+    ReproducibleSum s = *this;
+    s.normalise();
+    double sign = 1.;
+    if (s.words_[nb_words - 1] < 0) {
+        for (auto& w : s.words_) {
+            w = -w;
+        }
+        s.normalise();
+        sign = -1.;
+    }
+    // All digits are now non-negative. Sum from most to least significant digit.
+    double result = 0.;
+    for (int i = nb_words - 1; i >= 0; --i) {
+        if (s.words_[i]) {
+            result += std::ldexp(static_cast<double>(s.words_[i]), 32 * i - bias);
+        }
+    }
+    return sign * result;
+}
+
+void ReproducibleSum::pack(word_t* buffer) const {
+    ReproducibleSum s = *this;
+    s.normalise();
+    std::copy(s.words_.begin(), s.words_.end(), buffer);
+    std::copy(s.nonfinite_.begin(), s.nonfinite_.end(), buffer + nb_words);
+}
+
+void ReproducibleSum::unpack(const word_t* buffer) {
+    std::copy(buffer, buffer + nb_words, words_.begin());
+    std::copy(buffer + nb_words, buffer + packed_size, nonfinite_.begin());
+    normalise();
+}
+
+void ReproducibleSum::allReduce(const eckit::mpi::Comm& comm) {
+    std::vector<word_t> buffer(packed_size);
+    pack(buffer.data());
+    ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(buffer.data(), buffer.size(), eckit::mpi::sum()); }
+    unpack(buffer.data());
+}
+
+void ReproducibleSum::allReduce(std::vector<ReproducibleSum>& sums, const eckit::mpi::Comm& comm) {
+    std::vector<word_t> buffer(sums.size() * packed_size);
+    for (size_t j = 0; j < sums.size(); ++j) {
+        sums[j].pack(buffer.data() + j * packed_size);
+    }
+    ATLAS_TRACE_MPI(ALLREDUCE) { comm.allReduceInPlace(buffer.data(), buffer.size(), eckit::mpi::sum()); }
+    for (size_t j = 0; j < sums.size(); ++j) {
+        sums[j].unpack(buffer.data() + j * packed_size);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace util
+}  // namespace atlas
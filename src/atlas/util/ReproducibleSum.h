@@ -0,0 +1,121 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace eckit {
+namespace mpi {
+class Comm;
+}
+}  // namespace eckit
+
+namespace atlas {
+namespace util {
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Exact summation of floating point values, independent of the order of summation
+///
+/// Values are accumulated exactly in a fixed-point integer representation spanning the full range of
+/// double precision ("superaccumulator"). Integer addition is associative, so partial sums can be
+/// combined in any order, across threads or MPI tasks, and the result is bit-identical.
+/// The result is the exact sum, rounded to double precision in a deterministic way. Non-finite values
+/// are counted separately, and propagate to the result as with ordinary summation.
+class ReproducibleSum {
+public:
+    using word_t = std::int64_t;
+
+    /// Number of 32-bit digits covering the double precision range, with headroom for carries
+    static constexpr int nb_words = 72;
+
+    ReproducibleSum() {
+        words_.fill(0);
+        nonfinite_.fill(0);
+    }
+
+    ReproducibleSum& operator+=(double x) {
+        add(x);
+        return *this;
+    }
+
+    ReproducibleSum& operator+=(const ReproducibleSum&);
+
+    void add(double x) {
+        std::uint64_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const int exponent = static_cast<int>((bits >> 52) & 0x7FF);
+        std::uint64_t u    = bits & ((std::uint64_t(1) << 52) - 1);
+        if (exponent == 0x7FF) {
+            ++nonfinite_[u ? 2 : (bits >> 63)];
+            return;
+        }
+        if (exponent == 0) {  // zero or subnormal
+            if (u == 0) {
+                return;
+            }
+            add(u, 1, bits >> 63);
+        }
+        else {
+            add(u | (std::uint64_t(1) << 52), exponent, bits >> 63);
+        }
+    }
+
+    /// @brief Exact sum, rounded to double precision
+    double value() const;
+
+    /// @brief Propagate carries, so that all digits but the most significant one are in [0, 2^32)
+    void normalise();
+
+    /// @brief Combine the sums of all MPI tasks in place, with a single allReduce
+    void allReduce(const eckit::mpi::Comm&);
+
+    /// @brief Combine many sums of all MPI tasks in place, with a single allReduce
+    static void allReduce(std::vector<ReproducibleSum>&, const eckit::mpi::Comm&);
+
+private:
+    static constexpr int packed_size = nb_words + 3;
+
+    // Add (-1)^negative * u * 2^(exponent-1075), with u < 2^53
+    void add(std::uint64_t u, int exponent, std::uint64_t negative) {
+        const int p           = exponent - 1075 + bias;
+        const int w           = p >> 5;
+        const int s           = p & 31;
+        const std::uint64_t r = u >> (32 - s);
+        const word_t sign     = negative ? -1 : 1;
+        words_[w] += sign * static_cast<word_t>((u << s) & mask);
+        words_[w + 1] += sign * static_cast<word_t>(r & mask);
+        words_[w + 2] += sign * static_cast<word_t>(r >> 32);
+        if (++pending_ == max_pending) {
+            normalise();
+        }
+    }
+
+    // Bit position of the least significant bit of words_[0] is -bias
+    static constexpr int bias                 = 1152;
+    static constexpr std::uint64_t mask       = 0xFFFFFFFFull;
+    static constexpr std::int64_t max_pending = std::int64_t(1) << 30;
+
+    void pack(word_t*) const;
+    void unpack(const word_t*);
+
+    std::array<word_t, nb_words> words_;
+    std::array<word_t, 3> nonfinite_;  // number of +inf, -inf and nan values
+    std::int64_t pending_{0};          // number of additions since last normalise()
+};
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace util
+}  // namespace atlas
@@ -0,0 +1,277 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/PointCloud.h"
+#include "atlas/grid.h"
+#include "atlas/interpolation.h"
+#include "atlas/mesh.h"
+#include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildHalo.h"
+#include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
+#include "atlas/mesh/actions/Reorder.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/numerics/Nabla.h"
+#include "atlas/numerics/fvm/Method.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/CoordinateEnums.h"
+
+//------------------------------------------------------------------------------
+
+using namespace atlas;
+using atlas::util::Config;
+
+//------------------------------------------------------------------------------
+
+namespace {
+
+/// Fully associative cache with least-recently-used replacement, holding whole columns of a field.
+/// Counts the misses for a trace of accessed columns, as a hardware independent measure of locality.
+class CacheSimulator {
+public:
+    CacheSimulator(size_t capacity): capacity_(std::max<size_t>(capacity, 1)) {}
+
+    void access(idx_t column) {
+        auto it = map_.find(column);
+        if (it != map_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return;
+        }
+        ++misses_;
+        lru_.push_front(column);
+        map_[column] = lru_.begin();
+        if (lru_.size() > capacity_) {
+            map_.erase(lru_.back());
+            lru_.pop_back();
+        }
+    }
+
+    size_t misses() const { return misses_; }
+
+private:
+    size_t capacity_;
+    size_t misses_{0};
+    std::list<idx_t> lru_;
+    std::unordered_map<idx_t, std::list<idx_t>::iterator> map_;
+};
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark of Nabla operators and interpolation with different mesh orderings (mesh::actions::Reorder)";
+    }
+    std::string usage() override {
+        return name() + " [--grid=name] [--target=name] [--levels=N] [--niter=N] [--cache=KiB] [--help]";
+    }
+
+public:
+    Tool(int argc, char** argv);
+};
+
+//-----------------------------------------------------------------------------
+
+Tool::Tool(int argc, char** argv): AtlasTool(argc, argv) {
+    add_option(new SimpleOption<std::string>(
+        "grid", "Grid unique identifier (default=O320)\n" + indent() + "     Example values: N80, F40, O24, L32"));
+    add_option(new SimpleOption<std::string>("target", "Target grid of interpolation (default=O160)"));
+    add_option(new SimpleOption<long>("levels", "number of levels (default=137)"));
+    add_option(new SimpleOption<long>("niter", "number of iterations (default=10)"));
+    add_option(new SimpleOption<long>("cache", "size of simulated cache in KiB (default=1024)"));
+}
+
+//-----------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    Trace timer(Here(), displayName());
+
+    std::string key    = "O320";
+    std::string target = "O160";
+    long levels        = 137;
+    long niter         = 10;
+    long cache_kib     = 1024;
+    args.get("grid", key);
+    args.get("target", target);
+    args.get("levels", levels);
+    args.get("niter", niter);
+    args.get("cache", cache_kib);
+
+    Grid grid;
+    Grid target_grid;
+    try {
+        grid        = Grid(key);
+        target_grid = Grid(target);
+    }
+    catch (eckit::Exception&) {
+        return failed();
+    }
+
+    Log::info() << "Configuration" << std::endl;
+    Log::info() << "~~~~~~~~~~~~~" << std::endl;
+    Log::info() << "  Grid           : " << grid.name() << std::endl;
+    Log::info() << "  Target grid    : " << target_grid.name() << std::endl;
+    Log::info() << "  MPI tasks      : " << mpi::comm().size() << std::endl;
+    Log::info() << "  OpenMP         : " << atlas_omp_get_max_threads() << std::endl;
+    Log::info() << "  levels         : " << levels << std::endl;
+    Log::info() << "  niter          : " << niter << std::endl;
+    Log::info() << "  cache          : " << cache_kib << " KiB" << std::endl;
+    Log::info() << std::endl;
+
+    const std::vector<std::pair<std::string, Config>> orderings{
+        {"none", Config("type", "none")},
+        {"hilbert", Config("type", "hilbert")},
+        {"hilbert, elements=curve", Config("type", "hilbert")("elements", "curve")},
+        {"morton, elements=curve", Config("type", "morton")("elements", "curve")},
+        {"reverse_cuthill_mckee", Config("type", "reverse_cuthill_mckee")},
+    };
+
+    auto timed = [&](const std::function<void()>& f) {
+        f();  // warm up
+        mpi::comm().barrier();
+        Trace t(Here(), "iterations");
+        for (long i = 0; i < niter; ++i) {
+            f();
+        }
+        t.stop();
+        return t.elapsed() / double(niter);
+    };
+
+    Log::info() << std::left << std::setw(26) << "ordering" << std::right << std::setw(12) << "gradient"
+                << std::setw(12) << "div+curl" << std::setw(12) << "interp" << std::setw(14) << "misses/node"
+                << std::setw(14) << "misses/edge" << std::setw(14) << "misses/cell" << std::endl;
+
+    for (const auto& ordering : orderings) {
+        Trace trace(Here(), ordering.first);
+        Mesh mesh = StructuredMeshGenerator().generate(grid);
+
+        // Build halo, edges and node-to-edge connectivity as fvm::Method would, so that these are reordered too.
+        // The Method then finds them already built for its halo.
+        mesh::actions::build_nodes_parallel_fields(mesh);
+        mesh::actions::build_periodic_boundaries(mesh);
+        mesh::actions::build_halo(mesh, 1);
+        mesh::actions::build_edges(mesh);
+        mesh::actions::build_edges_parallel_fields(mesh);
+        mesh::actions::build_node_to_edge_connectivity(mesh);
+        mesh::actions::Reorder{ordering.second}(mesh);
+
+        numerics::fvm::Method fvm(mesh, option::levels(levels) | option::halo(1));
+        numerics::Nabla nabla(fvm);
+
+        const auto& fs = fvm.node_columns();
+        Field scalar   = fs.createField<double>(option::name("scalar"));
+        Field grad     = fs.createField<double>(option::name("grad") | option::variables(2));
+        Field wind     = fs.createField<double>(option::name("wind") | option::variables(2));
+        FieldSet vectors, divergences, curls, none;
+        vectors.add(wind);
+        divergences.add(fs.createField<double>(option::name("div")));
+        curls.add(fs.createField<double>(option::name("curl")));
+        {
+            auto lonlat = array::make_view<double, 2>(fs.nodes().lonlat());
+            auto s      = array::make_view<double, 2>(scalar);
+            auto w      = array::make_view<double, 3>(wind);
+            for (idx_t n = 0; n < fs.nodes().size(); ++n) {
+                const double x = lonlat(n, LON) * M_PI / 180.;
+                const double y = lonlat(n, LAT) * M_PI / 180.;
+                for (idx_t l = 0; l < levels; ++l) {
+                    s(n, l)      = std::cos(y) * std::cos(x) + l;
+                    w(n, l, LON) = std::cos(y);
+                    w(n, l, LAT) = std::sin(x);
+                }
+            }
+        }
+
+        double t_grad    = timed([&]() { nabla.gradient(scalar, grad); });
+        double t_divcurl = timed([&]() { nabla.gradient_divergence_curl(none, none, vectors, divergences, curls); });
+
+        // Interpolation from the mesh to target points on the same partitions
+        functionspace::PointCloud target_fs(target_grid, grid::MatchingPartitioner(mesh));
+        Field source = fs.createField<double>(option::name("source") | option::levels(false));
+        Field result = target_fs.createField<double>(option::name("result"));
+        array::make_view<double, 1>(source).assign(1.);
+        Interpolation interpolation(option::type("finite-element"), fs, target_fs);
+        double t_interp = timed([&]() { interpolation.execute(source, result); });
+
+        // Simulated cache misses of column accesses: gathers over edges per node (as the fvm Nabla),
+        // over nodes per edge and over nodes per cell (as the finite-element interpolation)
+        const size_t capacity         = size_t(cache_kib) * 1024 / (size_t(levels) * sizeof(double));
+        const auto& node2edge         = mesh.nodes().edge_connectivity();
+        const auto& edge2node         = mesh.edges().node_connectivity();
+        const auto& cell2node         = mesh.cells().node_connectivity();
+        const idx_t nnodes            = fs.nb_nodes();
+        const idx_t nedges            = mesh.edges().size();
+        const idx_t ncells            = mesh.cells().size();
+        double misses_per_node        = 0;
+        double misses_per_edge        = 0;
+        double misses_per_cell        = 0;
+        {
+            CacheSimulator cache(capacity);
+            for (idx_t n = 0; n < nnodes; ++n) {
+                for (idx_t j = 0; j < node2edge.cols(n); ++j) {
+                    const idx_t e = node2edge(n, j);
+                    cache.access(edge2node(e, 0));
+                    cache.access(edge2node(e, 1));
+                }
+            }
+            misses_per_node = double(cache.misses()) / double(nnodes);
+        }
+        {
+            CacheSimulator cache(capacity);
+            for (idx_t e = 0; e < nedges; ++e) {
+                cache.access(edge2node(e, 0));
+                cache.access(edge2node(e, 1));
+            }
+            misses_per_edge = double(cache.misses()) / double(nedges);
+        }
+        {
+            CacheSimulator cache(capacity);
+            for (idx_t c = 0; c < ncells; ++c) {
+                for (idx_t j = 0; j < cell2node.cols(c); ++j) {
+                    cache.access(cell2node(c, j));
+                }
+            }
+            misses_per_cell = double(cache.misses()) / double(ncells);
+        }
+
+        Log::info() << std::left << std::setw(26) << ordering.first << std::right << std::fixed
+                    << std::setprecision(6) << std::setw(12) << t_grad << std::setw(12) << t_divcurl << std::setw(12)
+                    << t_interp << std::setprecision(4) << std::setw(14) << misses_per_node << std::setw(14)
+                    << misses_per_edge << std::setw(14) << misses_per_cell << std::endl;
+    }
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
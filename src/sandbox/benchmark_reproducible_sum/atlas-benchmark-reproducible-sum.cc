@@ -0,0 +1,154 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <string>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/grid.h"
+#include "atlas/mesh.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+
+//------------------------------------------------------------------------------
+
+using namespace atlas;
+using atlas::util::Config;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    int execute(const Args& args) override;
+    std::string briefDescription() override {
+        return "Benchmark of reproducible (exact) global sums of NodeColumns fields, against the default sums";
+    }
+    std::string usage() override { return name() + " [--grid=name] [--levels=N] [--niter=N] [--help]"; }
+
+public:
+    Tool(int argc, char** argv);
+};
+
+//-----------------------------------------------------------------------------
+
+Tool::Tool(int argc, char** argv): AtlasTool(argc, argv) {
+    add_option(new SimpleOption<std::string>(
+        "grid", "Grid unique identifier (default=O320)\n" + indent() + "     Example values: N80, F40, O24, L32"));
+    add_option(new SimpleOption<long>("levels", "number of levels (default=137)"));
+    add_option(new SimpleOption<long>("niter", "number of iterations (default=10)"));
+}
+
+//-----------------------------------------------------------------------------
+
+int Tool::execute(const Args& args) {
+    Trace timer(Here(), displayName());
+
+    std::string key = "O320";
+    long levels     = 137;
+    long niter      = 10;
+    args.get("grid", key);
+    args.get("levels", levels);
+    args.get("niter", niter);
+
+    Grid grid;
+    try {
+        grid = Grid(key);
+    }
+    catch (eckit::Exception&) {
+        return failed();
+    }
+
+    Log::info() << "Configuration" << std::endl;
+    Log::info() << "~~~~~~~~~~~~~" << std::endl;
+    Log::info() << "  Grid           : " << grid.name() << std::endl;
+    Log::info() << "  MPI tasks      : " << mpi::comm().size() << std::endl;
+    Log::info() << "  OpenMP         : " << atlas_omp_get_max_threads() << std::endl;
+    Log::info() << "  levels         : " << levels << std::endl;
+    Log::info() << "  niter          : " << niter << std::endl;
+    Log::info() << std::endl;
+
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns fs_default(mesh, option::levels(levels) | Config("reproducible_sums", false));
+    functionspace::NodeColumns fs_reproducible(mesh, option::levels(levels) | Config("reproducible_sums", true));
+
+    Field field    = fs_default.createField<double>(option::name("field"));
+    auto view      = array::make_view<double, 2>(field);
+    auto glb_idx   = array::make_view<gidx_t, 1>(fs_default.nodes().global_index());
+    const idx_t nb = fs_default.nb_nodes();
+    for (idx_t n = 0; n < nb; ++n) {
+        for (idx_t l = 0; l < levels; ++l) {
+            view(n, l) = std::sin(double(glb_idx(n))) * std::exp(double(l % 10));
+        }
+    }
+
+    auto benchmark = [&](const std::string& name, const std::function<double()>& f) {
+        double result = f();  // warm up
+        mpi::comm().barrier();
+        Trace t(Here(), name);
+        for (long i = 0; i < niter; ++i) {
+            result = f();
+        }
+        t.stop();
+        Log::info() << "  " << std::left << std::setw(40) << name << std::right << std::setw(12) << std::fixed
+                    << std::setprecision(6) << t.elapsed() / double(niter) << " s    result = " << std::scientific
+                    << std::setprecision(17) << result << std::endl;
+        return t.elapsed() / double(niter);
+    };
+
+    Log::info() << "Timings per iteration" << std::endl;
+    Log::info() << "~~~~~~~~~~~~~~~~~~~~~" << std::endl;
+    idx_t N;
+    double t_sum = benchmark("sum", [&]() {
+        double s;
+        fs_default.sum(field, s, N);
+        return s;
+    });
+    double t_oisum = benchmark("orderIndependentSum", [&]() {
+        double s;
+        fs_default.orderIndependentSum(field, s, N);
+        return s;
+    });
+    double t_reproducible = benchmark("sum (reproducible_sums)", [&]() {
+        double s;
+        fs_reproducible.sum(field, s, N);
+        return s;
+    });
+    double t_reproducible_per_level = benchmark("sumPerLevel (reproducible_sums)", [&]() {
+        Field s("sum", array::make_datatype<double>(), array::make_shape(levels));
+        fs_reproducible.sumPerLevel(field, s, N);
+        return array::make_view<double, 1>(s)(0);
+    });
+    Log::info() << std::endl;
+    Log::info() << "  overhead of reproducible sum vs sum                 : " << std::fixed << std::setprecision(2)
+                << t_reproducible / t_sum << "x" << std::endl;
+    Log::info() << "  overhead of reproducible sum vs orderIndependentSum : " << t_reproducible / t_oisum << "x"
+                << std::endl;
+    Log::info() << "  overhead of reproducible sumPerLevel vs sum         : " << t_reproducible_per_level / t_sum
+                << "x" << std::endl;
+    return success();
+}
+
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv) {
+    Tool tool(argc, argv);
+    return tool.start();
+}
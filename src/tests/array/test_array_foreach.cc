@@ -345,6 +345,76 @@ CASE("test_array_foreach_data_integrity") {
   }
 }
 
+CASE("test_array_foreach_execution_policies") {
+
+  auto arr1 = ArrayT<double>(20, 7, 5);
+  auto view1 = make_view<double, 3>(arr1);
+
+  auto arr2 = ArrayT<double>(20, 7, 5);
+  auto view2 = make_view<double, 3>(arr2);
+
+  for (auto idx = size_t{}; idx < arr2.size(); ++idx) {
+    static_cast<double*>(arr2.data())[idx] = idx;
+  }
+
+  const auto reset = [&]() { view1.assign(0.); };
+
+  const auto checkData = [&](const std::string& name) {
+    Log::info() << "checking " << name << std::endl;
+    for (auto idx = size_t{}; idx < arr1.size(); ++idx) {
+      EXPECT_EQ(static_cast<double*>(arr1.data())[idx], idx + 1.);
+    }
+    reset();
+  };
+
+  const auto addOne = [](double& a1, const double& a2) { a1 = a2 + 1.; };
+  const auto addOneLine = [](auto&& slice1, auto&& slice2) {
+    for (idx_t idx = 0; idx < slice1.shape(0); ++idx) {
+      slice1(idx) = slice2(idx) + 1.;
+    }
+  };
+
+  const auto testPolicy = [&](auto executionPolicy) {
+    const auto name = std::string(execution::policy_name(executionPolicy));
+
+    // Elements, with collapsed outer loops for parallel policies.
+    ArrayForEach<0, 1, 2>::apply(executionPolicy, std::tie(view1, view2), addOne);
+    checkData(name + " <0,1,2>");
+
+    // Lines, with collapsed loops for parallel policy.
+    ArrayForEach<0, 1>::apply(executionPolicy, std::tie(view1, view2), addOneLine);
+    checkData(name + " <0,1>");
+
+    ArrayForEach<1, 2>::apply(executionPolicy, std::tie(view1, view2), addOneLine);
+    checkData(name + " <1,2>");
+
+    // Elements of non-contiguous slices.
+    for (idx_t k = 0; k < view1.shape(2); ++k) {
+      auto slice1 = view1.slice(Range::all(), Range::all(), k);
+      auto slice2 = view2.slice(Range::all(), Range::all(), k);
+      ArrayForEach<0, 1>::apply(executionPolicy, std::tie(slice1, slice2), addOne);
+    }
+    checkData(name + " strided <0,1>");
+
+    // Masked elements.
+    const auto mask = [](idx_t, idx_t j, idx_t k) { return int(j == 1 && k == 2); };
+    ArrayForEach<0, 1, 2>::apply(executionPolicy, std::tie(view1, view2), mask, addOne);
+    for (idx_t i = 0; i < view1.shape(0); ++i) {
+      for (idx_t j = 0; j < view1.shape(1); ++j) {
+        for (idx_t k = 0; k < view1.shape(2); ++k) {
+          EXPECT_EQ(view1(i, j, k), mask(i, j, k) ? 0. : view2(i, j, k) + 1.);
+        }
+      }
+    }
+    reset();
+  };
+
+  testPolicy(execution::seq);
+  testPolicy(execution::unseq);
+  testPolicy(execution::par);
+  testPolicy(execution::par_unseq);
+}
+
 template <typename IterationMethod, typename Operation>
 double timeLoop(const IterationMethod& iterationMethod, int num_iter, int num_first,
                 const Operation& operation, double baseline, const std::string& output) {
@@ -461,6 +531,14 @@ CASE("test_array_foreach_performance") {
     ArrayForEach<0, 1>::apply(execution::seq, std::tie(view1, view2, view3), operation);
   };
 
+  const auto forEachAllUnseq = [&](const auto& operation) {
+    ArrayForEach<0, 1>::apply(execution::unseq, std::tie(view1, view2, view3), operation);
+  };
+
+  const auto forEachAllParUnseq = [&](const auto& operation) {
+    ArrayForEach<0, 1>::apply(execution::par_unseq, std::tie(view1, view2, view3), operation);
+  };
+
   const auto forEachNested = [&](const auto& operation) {
       const auto function = [&](auto&& slice1, auto&& slice2, auto&& slice3) {
           ArrayForEach<0>::apply(execution::seq, std::tie(slice1, slice2, slice3), operation);
@@ -482,6 +560,8 @@ CASE("test_array_foreach_performance") {
   timeLoop(forEachCol, num_iter, num_first, add, baseline, "Addition; for each (columns)        ");
   timeLoop(forEachLevel, num_iter, num_first, add, baseline, "Addition; for each (levels)         ");
   timeLoop(forEachAll, num_iter, num_first, add, baseline, "Addition; for each (all elements)   ");
+  timeLoop(forEachAllUnseq, num_iter, num_first, add, baseline, "Addition; for each (all, unseq)      ");
+  timeLoop(forEachAllParUnseq, num_iter, num_first, add, baseline, "Addition; for each (all, par_unseq)  ");
   timeLoop(forEachNested, num_iter, num_first, add, baseline, "Addition; for each (nested)         ");
   timeLoop(forEachConf, num_iter, num_first, add, baseline, "Addition; for each (nested, config) ");
   Log::info() << std::endl;
@@ -494,6 +574,8 @@ CASE("test_array_foreach_performance") {
   timeLoop(forEachCol, num_iter, num_first, trig, baseline, "Trig    ; for each (columns)        ");
   timeLoop(forEachLevel, num_iter, num_first, trig, baseline, "Trig    ; for each (levels)         ");
   timeLoop(forEachAll, num_iter, num_first, trig, baseline, "Trig    ; for each (all elements)   ");
+  timeLoop(forEachAllUnseq, num_iter, num_first, trig, baseline, "Trig    ; for each (all, unseq)      ");
+  timeLoop(forEachAllParUnseq, num_iter, num_first, trig, baseline, "Trig    ; for each (all, par_unseq)  ");
   timeLoop(forEachNested, num_iter, num_first, trig, baseline, "Trig    ; for each (nested)         ");
   timeLoop(forEachConf, num_iter, num_first, trig, baseline, "Trig    ; for each (nested, config) ");
 }
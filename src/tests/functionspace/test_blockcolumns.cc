@@ -0,0 +1,207 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/BlockCellColumns.h"
+#include "atlas/functionspace/BlockNodeColumns.h"
+#include "atlas/functionspace/BlockStructuredColumns.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/mesh.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::functionspace;
+using namespace atlas::util;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+Mesh generate_mesh() {
+    auto grid          = Grid{"O16"};
+    auto meshgenerator = MeshGenerator{grid.meshgenerator()};
+    return meshgenerator.generate(grid);
+}
+
+// Fill non-blocked fields of shape (size,nlev,nvar), (size,nlev) and (size) with values depending on the global index
+FieldSet create_nonblocked(const FunctionSpace& columns, idx_t nlev, idx_t nvar) {
+    FieldSet fields;
+    fields.add(columns.createField<double>(option::name("f3") | option::levels(nlev) | option::variables(nvar)));
+    fields.add(columns.createField<float>(option::name("f2") | option::levels(nlev)));
+    fields.add(columns.createField<int>(option::name("f1") | option::levels(0)));
+    auto g  = array::make_view<gidx_t, 1>(columns.global_index());
+    auto f3 = array::make_view<double, 3>(fields["f3"]);
+    auto f2 = array::make_view<float, 2>(fields["f2"]);
+    auto f1 = array::make_view<int, 1>(fields["f1"]);
+    for (idx_t n = 0; n < columns.size(); ++n) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            for (idx_t jvar = 0; jvar < nvar; ++jvar) {
+                f3(n, jlev, jvar) = g(n) * 100. + jlev * 10. + jvar;
+            }
+            f2(n, jlev) = g(n) * 10.f + jlev;
+        }
+        f1(n) = g(n);
+    }
+    return fields;
+}
+
+template <typename BlockFunctionSpace>
+FieldSet create_blocked(const BlockFunctionSpace& fs, const FieldSet& nonblocked) {
+    FieldSet fields;
+    for (idx_t f = 0; f < nonblocked.size(); ++f) {
+        fields.add(fs.createField(nonblocked[f]));
+    }
+    return fields;
+}
+
+template <typename BlockFunctionSpace>
+void check_blocked(const BlockFunctionSpace& fs, const FieldSet& nonblocked, const FieldSet& blocked) {
+    auto f3  = array::make_view<double, 3>(nonblocked["f3"]);
+    auto f1  = array::make_view<int, 1>(nonblocked["f1"]);
+    auto bf3 = array::make_view<double, 4>(blocked["f3"]);
+    auto bf1 = array::make_view<int, 2>(blocked["f1"]);
+    EXPECT_EQ(bf3.shape(0), fs.nblks());
+    EXPECT_EQ(bf3.shape(1), f3.shape(2));
+    EXPECT_EQ(bf3.shape(2), f3.shape(1));
+    EXPECT_EQ(bf3.shape(3), fs.nproma());
+    for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
+        const idx_t blk_size = std::min(fs.nproma(), fs.size() - jblk * fs.nproma());
+        for (idx_t jrof = 0; jrof < fs.nproma(); ++jrof) {
+            // Padding of the last block repeats its last point
+            const idx_t n = fs.index(jblk, std::min(jrof, blk_size - 1));
+            for (idx_t jvar = 0; jvar < bf3.shape(1); ++jvar) {
+                for (idx_t jlev = 0; jlev < bf3.shape(2); ++jlev) {
+                    EXPECT_EQ(bf3(jblk, jvar, jlev, jrof), f3(n, jlev, jvar));
+                }
+            }
+            EXPECT_EQ(bf1(jblk, jrof), f1(n));
+        }
+    }
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE("test_BlockNodeColumns") {
+    Mesh mesh    = generate_mesh();
+    idx_t nlev   = 5;
+    idx_t nvar   = 3;
+    idx_t nproma = 7;
+    auto nodes   = NodeColumns(mesh, option::levels(nlev) | option::halo(1));
+
+    SECTION("all points") {
+        auto fs = BlockNodeColumns(nodes, util::Config("nproma", nproma));
+        EXPECT_EQ(fs.type(), "BlockNodeColumns");
+        EXPECT_EQ(fs.size(), nodes.size());
+        EXPECT_EQ(fs.levels(), nlev);
+        EXPECT_EQ(fs.nblks(), (nodes.size() + nproma - 1) / nproma);
+        EXPECT(BlockNodeColumns(FunctionSpace(fs)));
+        EXPECT(not BlockCellColumns(FunctionSpace(fs)));
+
+        FieldSet nonblocked = create_nonblocked(nodes, nlev, nvar);
+        FieldSet blocked    = create_blocked(fs, nonblocked);
+        fs.to_blocked(nonblocked, blocked);
+        check_blocked(fs, nonblocked, blocked);
+
+        FieldSet roundtrip = create_nonblocked(nodes, nlev, nvar);
+        auto f2            = array::make_view<float, 2>(nonblocked["f2"]);
+        auto rf2           = array::make_view<float, 2>(roundtrip["f2"]);
+        rf2.assign(-1.f);
+        fs.to_nonblocked(blocked, roundtrip);
+        for (idx_t n = 0; n < nodes.size(); ++n) {
+            for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+                EXPECT_EQ(rf2(n, jlev), f2(n, jlev));
+            }
+        }
+    }
+
+    SECTION("owned points") {
+        auto fs    = BlockNodeColumns(nodes, util::Config("nproma", nproma) | util::Config("owned", true));
+        auto ghost = array::make_view<int, 1>(nodes.ghost());
+        idx_t nb_owned = 0;
+        for (idx_t n = 0; n < ghost.size(); ++n) {
+            nb_owned += (ghost(n) == 0);
+        }
+        EXPECT(fs.owned());
+        EXPECT_EQ(fs.size(), nb_owned);
+        for (idx_t jblk = 0; jblk < fs.nblks(); ++jblk) {
+            for (idx_t jrof = 0; jrof < fs.block_size(jblk); ++jrof) {
+                EXPECT_EQ(ghost(fs.index(jblk, jrof)), 0);
+            }
+        }
+
+        FieldSet nonblocked = create_nonblocked(nodes, nlev, nvar);
+        FieldSet blocked    = create_blocked(fs, nonblocked);
+        fs.to_blocked(nonblocked, blocked);
+        check_blocked(fs, nonblocked, blocked);
+    }
+}
+
+CASE("test_BlockCellColumns scatter/gather") {
+    Mesh mesh  = generate_mesh();
+    idx_t nlev = 4;
+    auto cells = CellColumns(mesh, option::levels(nlev));
+    auto fs    = BlockCellColumns(cells, util::Config("nproma", 16));
+    EXPECT_EQ(fs.type(), "BlockCellColumns");
+
+    auto glb = fs.createField<double>(option::name("f") | option::global());
+    auto g   = array::make_view<double, 2>(glb);
+    for (idx_t n = 0; n < glb.shape(0); ++n) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            g(n, jlev) = n * 10. + jlev;
+        }
+    }
+    auto loc = fs.createField(glb);
+    EXPECT_EQ(loc.rank(), 3);
+    EXPECT_EQ(loc.horizontal_dimension(), (std::vector<idx_t>{0, 2}));
+    fs.scatter(glb, loc);
+
+    auto glb_2 = fs.createField(glb, option::global());
+    fs.gather(loc, glb_2);
+    auto g2 = array::make_view<double, 2>(glb_2);
+    for (idx_t n = 0; n < glb_2.shape(0); ++n) {
+        for (idx_t jlev = 0; jlev < nlev; ++jlev) {
+            EXPECT_EQ(g2(n, jlev), g(n, jlev));
+        }
+    }
+}
+
+CASE("test_BlockStructuredColumns to_blocked") {
+    idx_t nlev = 3;
+    auto grid  = Grid("O8");
+    auto sc    = StructuredColumns(grid, util::Config("levels", nlev));
+    auto fs    = BlockStructuredColumns(grid, util::Config("nproma", 10) | util::Config("levels", nlev));
+
+    FieldSet nonblocked = create_nonblocked(sc, nlev, 2);
+    FieldSet blocked    = create_blocked(fs, nonblocked);
+    fs.to_blocked(nonblocked, blocked);
+    check_blocked(fs, nonblocked, blocked);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -8,6 +8,9 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "eckit/types/Types.h"
 
 #include "atlas/array/ArrayView.h"
@@ -23,6 +26,7 @@
 #include "atlas/meshgenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/trans/Trans.h"
+#include "atlas/util/ReproducibleSum.h"
 
 #include "tests/AtlasTestEnvironment.h"
 
@@ -468,6 +472,103 @@ CASE("test_functionspace_NodeColumns") {
                                      option::name("tmp"));
 }
 
+CASE("test_functionspace_NodeColumns_reproducible_sums") {
+    Grid grid("O16");
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns fs(mesh, option::halo(1) | option::levels(4) | util::Config("reproducible_sums", true));
+
+    auto value = [](gidx_t g, idx_t l) { return std::sin(double(g)) * std::pow(10., double(l % 3) * 4.); };
+
+    Field field  = fs.createField<double>(option::name("field"));
+    auto view    = array::make_view<double, 2>(field);
+    auto glb_idx = array::make_view<gidx_t, 1>(fs.nodes().global_index());
+    for (idx_t n = 0; n < fs.nb_nodes(); ++n) {
+        for (idx_t l = 0; l < fs.levels(); ++l) {
+            view(n, l) = value(glb_idx(n), l);
+        }
+    }
+
+    // Exact sum computed without decomposition
+    util::ReproducibleSum exact;
+    for (gidx_t g = 1; g <= grid.size(); ++g) {
+        for (idx_t l = 0; l < fs.levels(); ++l) {
+            exact += value(g, l);
+        }
+    }
+
+    double sum, oisum, mean;
+    idx_t N;
+    fs.sum(field, sum, N);
+    fs.orderIndependentSum(field, oisum, N);
+    fs.mean(field, mean, N);
+    EXPECT_EQ(sum, exact.value());
+    EXPECT_EQ(oisum, exact.value());
+    EXPECT_EQ(mean, exact.value() / double(N));
+}
+
+CASE("test_functionspace_NodeColumns_statistics") {
+    Grid grid("O8");
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns fs(mesh, option::halo(1) | option::levels(5));
+
+    FieldSet fields;
+    fields.add(fs.createField<double>(option::name("scalar")));
+    fields.add(fs.createField<int>(option::name("integer")));
+    auto scalar  = array::make_view<double, 2>(fields["scalar"]);
+    auto integer = array::make_view<int, 2>(fields["integer"]);
+    auto glb_idx = array::make_view<gidx_t, 1>(fs.nodes().global_index());
+    for (idx_t n = 0; n < fs.nb_nodes(); ++n) {
+        for (idx_t l = 0; l < fs.levels(); ++l) {
+            scalar(n, l)  = std::sin(double(glb_idx(n))) + 0.1 * l;
+            integer(n, l) = int(glb_idx(n) % 7) - l;
+        }
+    }
+
+    auto stats = fs.statistics(fields);
+    EXPECT_EQ(stats.size(), 2);
+
+    SECTION("double") {
+        const auto& s = stats[0];
+        double sum, mean, stddev, min, max;
+        gidx_t gidx_min, gidx_max;
+        idx_t N, level_min, level_max;
+        fs.sum(fields[0], sum, N);
+        fs.meanAndStandardDeviation(fields[0], mean, stddev, N);
+        fs.minimumAndLocation(fields[0], min, gidx_min, level_min);
+        fs.maximumAndLocation(fields[0], max, gidx_max, level_max);
+
+        EXPECT_EQ(s.N, N);
+        EXPECT_APPROX_EQ(s.sum, sum, 1.e-10);
+        EXPECT_APPROX_EQ(s.mean, mean, 1.e-12);
+        EXPECT_APPROX_EQ(s.stddev, stddev, 1.e-12);
+        EXPECT_EQ(s.minimum, min);
+        EXPECT_EQ(s.maximum, max);
+        EXPECT_EQ(s.minimum_glb_idx, gidx_min);
+        EXPECT_EQ(s.maximum_glb_idx, gidx_max);
+        EXPECT_EQ(s.minimum_level, level_min);
+        EXPECT_EQ(s.maximum_level, level_max);
+    }
+
+    SECTION("int") {
+        const auto& s = stats[1];
+        int sum, min, max;
+        idx_t N;
+        fs.sum(fields[1], sum, N);
+        fs.minimum(fields[1], min);
+        fs.maximum(fields[1], max);
+
+        EXPECT_EQ(s.N, N);
+        EXPECT_APPROX_EQ(s.sum, double(sum), 1.e-12 * std::max(1., std::abs(double(sum))));
+        EXPECT_EQ(s.minimum, double(min));
+        EXPECT_EQ(s.maximum, double(max));
+    }
+
+    auto minmax = fs.statistics(fields["scalar"], util::Config("statistics", std::vector<std::string>{"minimum"}));
+    EXPECT_EQ(minmax.minimum, stats[0].minimum);
+    EXPECT_EQ(minmax.N, 0);
+    EXPECT_EQ(minmax.maximum, 0.);
+}
+
 CASE("test_SpectralFunctionSpace") {
     idx_t truncation = 159;
     idx_t nb_levels  = 10;
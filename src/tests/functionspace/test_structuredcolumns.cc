@@ -8,6 +8,8 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cmath>
+
 #include "eckit/log/Bytes.h"
 #include "eckit/types/Types.h"
 
@@ -21,6 +23,7 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
+#include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/MicroDeg.h"
@@ -445,6 +448,120 @@ CASE("create_aligned_field") {
     check_field(field);
 }
 
+CASE("checksum in reduce mode is independent of partitioning") {
+    Grid grid("O16");
+    auto checksum = [&](const std::string& partitioner) {
+        functionspace::StructuredColumns fs(grid, grid::Partitioner(partitioner), option::halo(1));
+        Field field = fs.createField<double>(option::levels(2));
+        auto view   = array::make_view<double, 2>(field);
+        auto glb    = array::make_view<gidx_t, 1>(fs.global_index());
+        for (idx_t n = 0; n < fs.size(); ++n) {
+            view(n, 0) = glb(n);
+            view(n, 1) = -glb(n);
+        }
+        parallel::Checksum checksum("test", parallel::Checksum::Mode::reduce);
+        checksum.setup(fs.mpi_comm(), array::make_view<int, 1>(fs.partition()).data(),
+                       array::make_view<idx_t, 1>(fs.remote_index()).data(), 0,
+                       array::make_view<gidx_t, 1>(fs.global_index()).data(), fs.size());
+        return checksum.execute(view.data(), 2);
+    };
+    std::string checksum_equal_regions = checksum("equal_regions");
+    std::string checksum_checkerboard  = checksum("checkerboard");
+    Log::info() << "checksum = " << checksum_equal_regions << std::endl;
+    EXPECT_EQ(checksum_equal_regions, checksum_checkerboard);
+}
+
+CASE("statistics are independent of partitioning") {
+    Grid grid("O16");
+    auto statistics = [&](const std::string& partitioner) {
+        functionspace::StructuredColumns fs(grid, grid::Partitioner(partitioner), option::halo(1) | option::levels(3));
+        Field field = fs.createField<double>();
+        auto view   = array::make_view<double, 2>(field);
+        auto glb    = array::make_view<gidx_t, 1>(fs.global_index());
+        for (idx_t n = 0; n < fs.size(); ++n) {
+            for (idx_t l = 0; l < fs.levels(); ++l) {
+                view(n, l) = std::cos(double(glb(n))) * (l + 1);
+            }
+        }
+        return fs.statistics(field);
+    };
+    auto s1 = statistics("equal_regions");
+    auto s2 = statistics("checkerboard");
+    EXPECT_EQ(s1.N, grid.size() * 3);
+    EXPECT_EQ(s1.N, s2.N);
+    EXPECT_APPROX_EQ(s1.mean, s2.mean, 1.e-12);
+    EXPECT_APPROX_EQ(s1.stddev, s2.stddev, 1.e-12);
+    EXPECT_EQ(s1.minimum, s2.minimum);
+    EXPECT_EQ(s1.maximum, s2.maximum);
+    EXPECT_EQ(s1.minimum_glb_idx, s2.minimum_glb_idx);
+    EXPECT_EQ(s1.maximum_glb_idx, s2.maximum_glb_idx);
+    EXPECT_EQ(s1.maximum_level, 2);
+}
+
+CASE("tiled ordering of StructuredColumns") {
+    Grid grid("O16");
+    grid::Partitioner partitioner("equal_regions");
+    auto config = option::halo(2) | option::levels(2);
+    functionspace::StructuredColumns rows(grid, partitioner, config);
+    functionspace::StructuredColumns tiles(grid, partitioner, config | util::Config("ordering", "tiles") |
+                                                                  util::Config("tile_size", std::vector<long>{4, 2}));
+    EXPECT_EQ(rows.ordering(), "rows");
+    EXPECT_EQ(tiles.ordering(), "tiles");
+    EXPECT_EQ(tiles.sizeOwned(), rows.sizeOwned());
+    EXPECT_EQ(tiles.size(), rows.size());
+
+    auto glb_rows  = array::make_view<gidx_t, 1>(rows.global_index());
+    auto glb_tiles = array::make_view<gidx_t, 1>(tiles.global_index());
+    auto ghost     = array::make_view<int, 1>(tiles.ghost());
+    auto index_i   = array::make_indexview<idx_t, 1>(tiles.index_i());
+    auto index_j   = array::make_indexview<idx_t, 1>(tiles.index_j());
+
+    SECTION("index(i,j) is consistent with the storage order") {
+        idx_t reordered = 0;
+        for (idx_t j = tiles.j_begin_halo(); j < tiles.j_end_halo(); ++j) {
+            for (idx_t i = tiles.i_begin_halo(j); i < tiles.i_end_halo(j); ++i) {
+                const idx_t n = tiles.index(i, j);
+                EXPECT_EQ(index_i(n), i);
+                EXPECT_EQ(index_j(n), j);
+                EXPECT_EQ(glb_tiles(n), glb_rows(rows.index(i, j)));
+                const bool owned = j >= tiles.j_begin() && j < tiles.j_end() && i >= tiles.i_begin(j) &&
+                                   i < tiles.i_end(j);
+                EXPECT_EQ(n < tiles.sizeOwned(), owned);
+                EXPECT_EQ(ghost(n), owned ? 0 : 1);
+                if (n != rows.index(i, j)) {
+                    ++reordered;
+                }
+            }
+        }
+        EXPECT(reordered > 0);
+    }
+
+    SECTION("halo exchange and gather") {
+        Field field = tiles.createField<double>();
+        auto view   = array::make_view<double, 2>(field);
+        for (idx_t n = 0; n < tiles.size(); ++n) {
+            for (idx_t k = 0; k < tiles.levels(); ++k) {
+                view(n, k) = (n < tiles.sizeOwned()) ? double(glb_tiles(n) * (k + 1)) : -1.;
+            }
+        }
+        tiles.haloExchange(field);
+        for (idx_t n = 0; n < tiles.size(); ++n) {
+            for (idx_t k = 0; k < tiles.levels(); ++k) {
+                EXPECT_EQ(view(n, k), double(glb_tiles(n) * (k + 1)));
+            }
+        }
+
+        Field global = tiles.createField(field, option::global());
+        tiles.gather(field, global);
+        auto gview = array::make_view<double, 2>(global);
+        for (idx_t n = 0; n < gview.shape(0); ++n) {
+            for (idx_t k = 0; k < tiles.levels(); ++k) {
+                EXPECT_EQ(gview(n, k), double((n + 1) * (k + 1)));
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
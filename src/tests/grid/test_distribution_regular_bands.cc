@@ -192,6 +192,33 @@ CASE("test regular_bands performance test") {
     }
 }
 
+CASE("test partition_ranges") {
+    auto grid = StructuredGrid("O32");
+
+    std::vector<grid::Distribution> distributions{
+        grid::Distribution(grid, grid::Partitioner("regular_bands", 5)),
+        grid::Distribution(grid, grid::Partitioner("equal_regions", 7)),
+        grid::Distribution(grid, grid::Partitioner("checkerboard", 6)), grid::Distribution(grid)};
+
+    for (const auto& dist : distributions) {
+        SECTION(dist.type()) {
+            for (int p = 0; p < dist.nb_partitions(); ++p) {
+                // Expected ranges by scanning all points
+                std::vector<grid::Distribution::Range> expected;
+                for (gidx_t n = 0; n < grid.size(); ++n) {
+                    if (dist.partition(n) == p) {
+                        if (expected.empty() || expected.back().second != n) {
+                            expected.emplace_back(n, n);
+                        }
+                        expected.back().second = n + 1;
+                    }
+                }
+                EXPECT(dist.partition_ranges(p) == expected);
+            }
+        }
+    }
+}
+
 CASE("test regular_bands with a very large grid") {
     auto grid = StructuredGrid(sizeof(atlas::idx_t) == 4 ? "L40000x20000" : "L160000x80000");
     auto dist = grid::Distribution(grid, grid::Partitioner("regular_bands"));
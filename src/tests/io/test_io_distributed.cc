@@ -0,0 +1,121 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/io/DistributedRecord.h"
+#include "atlas/io/atlas-io.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+FieldSet create_fields(const FunctionSpace& fs) {
+    FieldSet fields;
+    auto f1 = fields.add(fs.createField<double>(option::name("f1")));
+    auto f2 = fields.add(fs.createField<float>(option::name("f2") | option::levels(3)));
+
+    auto global_index = array::make_view<gidx_t, 1>(fs.global_index());
+    auto v1           = array::make_view<double, 1>(f1);
+    auto v2           = array::make_view<float, 2>(f2);
+    for (idx_t n = 0; n < fs.size(); ++n) {
+        v1(n) = double(global_index(n));
+        for (idx_t k = 0; k < 3; ++k) {
+            v2(n, k) = float(100 * global_index(n) + k);
+        }
+    }
+    return fields;
+}
+
+void check_global(const std::string& path, gidx_t nb_points) {
+    if (mpi::rank() != 0) {
+        return;
+    }
+    auto f1 = io::read_global(path, "f1");
+    auto f2 = io::read_global(path, "f2");
+    EXPECT_EQ(f1.shape(0), nb_points);
+    EXPECT_EQ(f2.shape(0), nb_points);
+    EXPECT_EQ(f2.shape(1), 3);
+    auto v1 = array::make_view<double, 1>(f1);
+    auto v2 = array::make_view<float, 2>(f2);
+    for (idx_t n = 0; n < f1.shape(0); ++n) {
+        EXPECT_EQ(v1(n), double(n + 1));
+        EXPECT_EQ(v2(n, 2), float(100 * (n + 1) + 2));
+    }
+
+    io::Metadata metadata;
+    io::RecordItemReader{"file:" + path + "?key=global_index"}.read(metadata);
+    std::vector<long> partitions;
+    metadata.get("partitions", partitions);
+    EXPECT_EQ(partitions.size(), size_t(mpi::size()));
+    long sum = 0;
+    for (auto& p : partitions) {
+        sum += p;
+    }
+    EXPECT_EQ(sum, nb_points);
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("write_distributed StructuredColumns") {
+    Grid grid("O32");
+    functionspace::StructuredColumns fs(grid, option::halo(2));
+    auto fields = create_fields(fs);
+
+    std::string path = "distributed_structuredcolumns.atlas";
+    size_t length    = io::write_distributed(fields, path);
+    EXPECT(length > 0);
+    check_global(path, grid.size());
+}
+
+CASE("write_distributed NodeColumns") {
+    Grid grid("O32");
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    functionspace::NodeColumns fs(mesh, option::halo(1));
+    auto fields = create_fields(fs);
+
+    std::string path = "distributed_nodecolumns.atlas";
+    io::write_distributed(fields, path);
+    check_global(path, grid.size());
+}
+
+CASE("write_distributed requires unique field names") {
+    Grid grid("O32");
+    functionspace::StructuredColumns fs(grid);
+
+    FieldSet duplicate = create_fields(fs);
+    duplicate.add(fs.createField<double>(option::name("f1")));
+    EXPECT_THROWS_AS(io::write_distributed(duplicate, "distributed_duplicate.atlas"), eckit::AssertionFailed);
+
+    FieldSet reserved;
+    reserved.add(fs.createField<gidx_t>(option::name("global_index")));
+    EXPECT_THROWS_AS(io::write_distributed(reserved, "distributed_reserved.atlas"), eckit::AssertionFailed);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
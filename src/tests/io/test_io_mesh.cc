@@ -0,0 +1,164 @@
+/*
+ * (C) Copyright 2020 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/grid.h"
+#include "atlas/io/MeshRecord.h"
+#include "atlas/mesh.h"
+#include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildHalo.h"
+#include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/mesh/actions/BuildPeriodicBoundaries.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+template <typename Value, int Rank>
+void check_field(const Field& field, const Field& reference) {
+    EXPECT_EQ(field.name(), reference.name());
+    EXPECT_EQ(field.datatype().str(), reference.datatype().str());
+    EXPECT(field.shape() == reference.shape());
+    EXPECT_EQ(field.variables(), reference.variables());
+    auto v   = array::make_view<Value, Rank>(field);
+    auto ref = array::make_view<Value, Rank>(reference);
+    EXPECT_EQ(v.size(), ref.size());
+    EXPECT(std::equal(v.data(), v.data() + v.size(), ref.data()));
+}
+
+template <typename Connectivity>
+void check_connectivity(const Connectivity& connectivity, const Connectivity& reference) {
+    EXPECT_EQ(connectivity.rows(), reference.rows());
+    for (idx_t r = 0; r < reference.rows(); ++r) {
+        EXPECT_EQ(connectivity.cols(r), reference.cols(r));
+        for (idx_t c = 0; c < reference.cols(r); ++c) {
+            EXPECT_EQ(connectivity(r, c), reference(r, c));
+        }
+    }
+}
+
+void check_elements(const mesh::HybridElements& elements, const mesh::HybridElements& reference) {
+    EXPECT_EQ(elements.size(), reference.size());
+    EXPECT_EQ(elements.nb_types(), reference.nb_types());
+    for (idx_t t = 0; t < reference.nb_types(); ++t) {
+        EXPECT_EQ(elements.element_type(t).name(), reference.element_type(t).name());
+        EXPECT_EQ(elements.elements(t).size(), reference.elements(t).size());
+    }
+    check_field<gidx_t, 1>(elements.global_index(), reference.global_index());
+    check_field<int, 1>(elements.partition(), reference.partition());
+    check_field<idx_t, 1>(elements.remote_index(), reference.remote_index());
+    check_field<int, 1>(elements.halo(), reference.halo());
+    check_connectivity(elements.node_connectivity(), reference.node_connectivity());
+    check_connectivity(elements.edge_connectivity(), reference.edge_connectivity());
+    check_connectivity(elements.cell_connectivity(), reference.cell_connectivity());
+}
+
+void check_mesh(const Mesh& mesh, const Mesh& reference) {
+    EXPECT_EQ(mesh.grid().uid(), reference.grid().uid());
+    EXPECT_EQ(mesh.metadata().getInt("halo"), reference.metadata().getInt("halo"));
+    EXPECT_EQ(mesh.nodes().size(), reference.nodes().size());
+    EXPECT_EQ(mesh.nodes().nb_fields(), reference.nodes().nb_fields());
+    check_field<gidx_t, 1>(mesh.nodes().global_index(), reference.nodes().global_index());
+    check_field<int, 1>(mesh.nodes().partition(), reference.nodes().partition());
+    check_field<idx_t, 1>(mesh.nodes().remote_index(), reference.nodes().remote_index());
+    check_field<int, 1>(mesh.nodes().ghost(), reference.nodes().ghost());
+    check_field<int, 1>(mesh.nodes().halo(), reference.nodes().halo());
+    check_field<double, 2>(mesh.nodes().xy(), reference.nodes().xy());
+    check_field<double, 2>(mesh.nodes().lonlat(), reference.nodes().lonlat());
+    check_connectivity(mesh.nodes().edge_connectivity(), reference.nodes().edge_connectivity());
+    check_connectivity(mesh.nodes().cell_connectivity(), reference.nodes().cell_connectivity());
+    check_elements(mesh.cells(), reference.cells());
+    check_elements(mesh.edges(), reference.edges());
+}
+
+Mesh generate_mesh(const Grid& grid) {
+    Mesh mesh = StructuredMeshGenerator().generate(grid);
+    mesh::actions::build_nodes_parallel_fields(mesh);
+    mesh::actions::build_periodic_boundaries(mesh);
+    mesh::actions::build_halo(mesh, 1);
+    mesh::actions::build_edges(mesh);
+    mesh::actions::build_edges_parallel_fields(mesh);
+    mesh::actions::build_node_to_edge_connectivity(mesh);
+    return mesh;
+}
+
+//-----------------------------------------------------------------------------
+
+CASE("write_mesh / read_mesh") {
+    Grid grid("O16");
+    Mesh reference = generate_mesh(grid);
+
+    std::string path = "mesh_p" + std::to_string(mpi::rank()) + ".atlas";
+    EXPECT(io::write_mesh(reference, path) > 0);
+    Mesh mesh = io::read_mesh(path);
+
+    check_mesh(mesh, reference);
+
+    SECTION("halo exchange on restored mesh") {
+        functionspace::NodeColumns fs(mesh, option::halo(1));
+        EXPECT_EQ(fs.size(), reference.nodes().size());
+        Field field = fs.createField<double>(option::name("f"));
+        auto v      = array::make_view<double, 1>(field);
+        auto ghost  = array::make_view<int, 1>(fs.ghost());
+        auto gidx   = array::make_view<gidx_t, 1>(fs.global_index());
+        for (idx_t n = 0; n < fs.size(); ++n) {
+            v(n) = ghost(n) ? -1. : double(gidx(n));
+        }
+        fs.haloExchange(field);
+        for (idx_t n = 0; n < fs.size(); ++n) {
+            EXPECT_EQ(v(n), double(gidx(n)));
+        }
+    }
+}
+
+CASE("MeshCache") {
+    Grid grid("O16");
+    MeshGenerator meshgenerator("structured");
+    grid::Distribution distribution(grid, grid::Partitioner("equal_regions"));
+    auto setup = util::Config("halo", 1) | util::Config("edges", true);
+
+    io::MeshCache cache(".");
+    std::string key = cache.key(grid, meshgenerator, distribution, setup);
+    std::remove(cache.path(key, mpi::rank()).c_str());
+    EXPECT(not cache.contains(key, meshgenerator.mpi_comm()));
+
+    EXPECT(key != cache.key(grid, meshgenerator, distribution, util::Config("halo", 2)));
+    EXPECT(key != cache.key(grid, MeshGenerator("structured", util::Config("triangulate", true)), distribution, setup));
+
+    Mesh generated = cache.generate(grid, meshgenerator, distribution, setup);
+    EXPECT(cache.contains(key, meshgenerator.mpi_comm()));
+    EXPECT_EQ(generated.metadata().getInt("halo"), 1);
+    EXPECT(generated.edges().size() > 0);
+
+    Mesh cached = cache.generate(grid, meshgenerator, distribution, setup);
+    EXPECT(cached.get() != generated.get());
+    check_mesh(cached, generated);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
@@ -16,6 +16,8 @@
 #include "atlas/array.h"
 #include "atlas/util/vector.h"
 
+#include "atlas/field/Field.h"
+#include "atlas/io/MappedField.h"
 #include "atlas/io/atlas-io.h"
 
 #include "tests/AtlasTestEnvironment.h"
@@ -555,6 +557,31 @@ CASE("RecordPrinter") {
 
 //-----------------------------------------------------------------------------
 
+CASE("Map Field from record") {
+    array::ArrayT<double> a(100, 3);
+    auto view = array::make_view<double, 2>(a);
+    for (idx_t i = 0; i < view.shape(0); ++i) {
+        for (idx_t j = 0; j < view.shape(1); ++j) {
+            view(i, j) = 10. * i + j;
+        }
+    }
+    io::RecordWriter record;
+    record.alignment(64);
+    record.set("a", io::ref(a), no_compression);
+    record.set("ac", io::ref(a));
+    record.write("record_mapped.atlas" + suffix());
+
+    for (std::string key : {"a", "ac"}) {
+        Field field = io::map_field("file:record_mapped.atlas" + suffix() + "?key=" + key, "mapped");
+        EXPECT_EQ(field.name(), "mapped");
+        EXPECT_EQ(field.shape(0), 100);
+        EXPECT_EQ(field.shape(1), 3);
+        EXPECT(::memcmp(field.array().data(), a.data(), a.size() * sizeof(double)) == 0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -11,7 +11,9 @@
 
 //-----------------------------------------------------------------
 
+#include <algorithm>
 #include <cmath>
+#include <map>
 
 #include "atlas/functionspace.h"
 #include "atlas/grid.h"
@@ -19,6 +21,7 @@
 #include "atlas/meshgenerator.h"
 
 #include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildNode2CellConnectivity.h"
 #include "atlas/mesh/actions/Reorder.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/runtime/Log.h"
@@ -256,6 +259,7 @@ void test_reordering(const util::Config& reorder_config, const std::vector<idx_t
     // clang-format off
     std::string title = type == "none" ? "Default order" :
                         type == "hilbert" ? "Hilbert space filling curve" :
+                        type == "morton" ? "Morton space filling curve" :
                         type == "reverse_cuthill_mckee" ? "Reverse Cuthill Mckee order":
                         type;
     type = grid_name() + "_" + type;
@@ -355,6 +359,96 @@ CASE("test_reverse_cuthill_mckee_reordering") {
     test_reordering(reorder_config, expected);
 }
 
+CASE("test_morton_reordering") {
+    auto reorder_config = option::type("morton");
+    test_reordering(reorder_config);
+}
+
+CASE("test_reordering_of_elements_keeps_mesh_consistent") {
+    for (std::string type : {"hilbert", "morton"}) {
+        SECTION(type) {
+            auto mesh = get_mesh();
+            mesh::actions::build_edges(mesh);
+            mesh::actions::build_node_to_edge_connectivity(mesh);
+            mesh::actions::build_node_to_cell_connectivity(mesh);
+
+            // Identify cells and edges by global indices of their nodes
+            auto element_nodes = [&](const mesh::HybridElements& elements) {
+                auto glb_idx = array::make_view<gidx_t, 1>(mesh.nodes().global_index());
+                const auto& node_connectivity = elements.node_connectivity();
+                std::vector<std::vector<gidx_t>> nodes(elements.size());
+                for (idx_t e = 0; e < elements.size(); ++e) {
+                    for (idx_t n = 0; n < node_connectivity.cols(e); ++n) {
+                        nodes[e].emplace_back(glb_idx(node_connectivity(e, n)));
+                    }
+                    std::sort(nodes[e].begin(), nodes[e].end());
+                }
+                return nodes;
+            };
+            auto sorted = [](std::vector<std::vector<gidx_t>> v) {
+                std::sort(v.begin(), v.end());
+                return v;
+            };
+            auto cells_by_global_index = [&](const std::vector<std::vector<gidx_t>>& cells) {
+                auto cell_glb_idx = array::make_view<gidx_t, 1>(mesh.cells().global_index());
+                std::map<gidx_t, std::vector<gidx_t>> map;
+                for (idx_t c = 0; c < mesh.cells().size(); ++c) {
+                    map[cell_glb_idx(c)] = cells[c];
+                }
+                return map;
+            };
+            const auto cells_before = element_nodes(mesh.cells());
+            const auto edges_before = element_nodes(mesh.edges());
+            const auto cells_by_global_index_before = cells_by_global_index(cells_before);
+
+            mesh::actions::Reorder{option::type(type) | util::Config("elements", "curve")}(mesh);
+
+            const auto cells_after = element_nodes(mesh.cells());
+            const auto edges_after = element_nodes(mesh.edges());
+            EXPECT(sorted(cells_before) == sorted(cells_after));
+            EXPECT(sorted(edges_before) == sorted(edges_after));
+            EXPECT(edges_before != edges_after);
+
+            // Cell fields are reordered with the cells
+            EXPECT(cells_by_global_index(cells_after) == cells_by_global_index_before);
+
+            // All connectivities refer to each other consistently
+            const auto& node2edge = mesh.nodes().edge_connectivity();
+            const auto& node2cell = mesh.nodes().cell_connectivity();
+            const auto& edge2node = mesh.edges().node_connectivity();
+            const auto& edge2cell = mesh.edges().cell_connectivity();
+            const auto& cell2node = mesh.cells().node_connectivity();
+            auto contains         = [](const auto& connectivity, idx_t row, idx_t value) {
+                for (idx_t c = 0; c < connectivity.cols(row); ++c) {
+                    if (connectivity(row, c) == value) {
+                        return true;
+                    }
+                }
+                return false;
+            };
+            idx_t errors = 0;
+            for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+                for (idx_t j = 0; j < node2edge.cols(n); ++j) {
+                    errors += !contains(edge2node, node2edge(n, j), n);
+                }
+                for (idx_t j = 0; j < node2cell.cols(n); ++j) {
+                    errors += !contains(cell2node, node2cell(n, j), n);
+                }
+            }
+            for (idx_t e = 0; e < mesh.edges().size(); ++e) {
+                for (idx_t j = 0; j < edge2cell.cols(e); ++j) {
+                    idx_t c = edge2cell(e, j);
+                    if (c != edge2cell.missing_value()) {
+                        errors += !contains(cell2node, c, edge2node(e, 0));
+                        errors += !contains(cell2node, c, edge2node(e, 1));
+                    }
+                }
+            }
+            EXPECT_EQ(errors, 0);
+        }
+    }
+}
+
 CASE("test_none_reordering") {
     auto reorder_config = option::type("none");
     test_reordering(reorder_config);
@@ -29,6 +29,7 @@
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -445,6 +446,103 @@ CASE("test_meshgen_ghost_at_end") {
     Log::info() << "]" << std::endl;
 }
 
+CASE("test_meshgen_threads") {
+    // Meshes generated with multiple threads are identical to meshes generated with a single thread
+    StructuredGrid grid = Grid("O32");
+    int nb_parts        = 7;
+    int num_threads     = atlas_omp_get_max_threads();
+
+    for (int p = 0; p < nb_parts; ++p) {
+        StructuredMeshGenerator generate(util::Config("nb_parts", nb_parts)("part", p)("ghost_at_end", true));
+
+        atlas_omp_set_num_threads(1);
+        Mesh serial = generate(grid);
+        atlas_omp_set_num_threads(num_threads);
+        Mesh threaded = generate(grid);
+
+        EXPECT_EQ(threaded.nodes().size(), serial.nodes().size());
+        EXPECT_EQ(threaded.cells().size(), serial.cells().size());
+        EXPECT_EQ(threaded.cells().elements(0).size(), serial.cells().elements(0).size());
+
+        auto gidx   = array::make_view<gidx_t, 1>(serial.nodes().global_index());
+        auto part   = array::make_view<int, 1>(serial.nodes().partition());
+        auto ghost  = array::make_view<int, 1>(serial.nodes().ghost());
+        auto xy     = array::make_view<double, 2>(serial.nodes().xy());
+        auto t_gidx = array::make_view<gidx_t, 1>(threaded.nodes().global_index());
+        auto t_part = array::make_view<int, 1>(threaded.nodes().partition());
+        auto t_ghst = array::make_view<int, 1>(threaded.nodes().ghost());
+        auto t_xy   = array::make_view<double, 2>(threaded.nodes().xy());
+        for (idx_t n = 0; n < serial.nodes().size(); ++n) {
+            EXPECT_EQ(t_gidx(n), gidx(n));
+            EXPECT_EQ(t_part(n), part(n));
+            EXPECT_EQ(t_ghst(n), ghost(n));
+            EXPECT_EQ(t_xy(n, XX), xy(n, XX));
+            EXPECT_EQ(t_xy(n, YY), xy(n, YY));
+        }
+
+        const auto& connectivity   = serial.cells().node_connectivity();
+        const auto& t_connectivity = threaded.cells().node_connectivity();
+        auto cells_gidx            = array::make_view<gidx_t, 1>(serial.cells().global_index());
+        auto t_cells_gidx          = array::make_view<gidx_t, 1>(threaded.cells().global_index());
+        for (idx_t c = 0; c < serial.cells().size(); ++c) {
+            EXPECT_EQ(t_cells_gidx(c), cells_gidx(c));
+            EXPECT_EQ(t_connectivity.cols(c), connectivity.cols(c));
+            for (idx_t j = 0; j < connectivity.cols(c); ++j) {
+                EXPECT_EQ(t_connectivity(c, j), connectivity(c, j));
+            }
+        }
+    }
+}
+
+CASE("test_meshgen_distribution_ranges") {
+    // Meshes generated from an analytic (bands) distribution are identical to meshes generated from the same
+    // distribution stored as an array, whose ranges are found by scanning the partition array
+    StructuredGrid grid = Grid("O32");
+    int nb_parts        = 7;
+
+    grid::Distribution dist_bands(grid, grid::Partitioner("bands", nb_parts));
+    grid::Distribution::partition_t partition(grid.size());
+    for (gidx_t n = 0; n < grid.size(); ++n) {
+        partition[n] = dist_bands.partition(n);
+    }
+    grid::Distribution dist_array(nb_parts, std::move(partition));
+
+    for (int p = 0; p < nb_parts; ++p) {
+        EXPECT(dist_array.partition_ranges(p) == dist_bands.partition_ranges(p));
+
+        StructuredMeshGenerator generate(util::Config("nb_parts", nb_parts)("part", p));
+        Mesh m_bands = generate(grid, dist_bands);
+        Mesh m_array = generate(grid, dist_array);
+
+        EXPECT_EQ(m_array.nodes().size(), m_bands.nodes().size());
+        EXPECT_EQ(m_array.cells().size(), m_bands.cells().size());
+
+        auto gidx   = array::make_view<gidx_t, 1>(m_bands.nodes().global_index());
+        auto part   = array::make_view<int, 1>(m_bands.nodes().partition());
+        auto ghost  = array::make_view<int, 1>(m_bands.nodes().ghost());
+        auto a_gidx = array::make_view<gidx_t, 1>(m_array.nodes().global_index());
+        auto a_part = array::make_view<int, 1>(m_array.nodes().partition());
+        auto a_ghst = array::make_view<int, 1>(m_array.nodes().ghost());
+        for (idx_t n = 0; n < m_bands.nodes().size(); ++n) {
+            EXPECT_EQ(a_gidx(n), gidx(n));
+            EXPECT_EQ(a_part(n), part(n));
+            EXPECT_EQ(a_ghst(n), ghost(n));
+        }
+
+        const auto& connectivity   = m_bands.cells().node_connectivity();
+        const auto& a_connectivity = m_array.cells().node_connectivity();
+        auto cells_part            = array::make_view<int, 1>(m_bands.cells().partition());
+        auto a_cells_part          = array::make_view<int, 1>(m_array.cells().partition());
+        for (idx_t c = 0; c < m_bands.cells().size(); ++c) {
+            EXPECT_EQ(a_cells_part(c), cells_part(c));
+            EXPECT_EQ(a_connectivity.cols(c), connectivity.cols(c));
+            for (idx_t j = 0; j < connectivity.cols(c); ++j) {
+                EXPECT_EQ(a_connectivity(c, j), connectivity(c, j));
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -459,6 +459,97 @@ CASE("test_lapl") {
 
 }
 
+CASE("test_fused") {
+    Log::info() << "test_fused" << std::endl;
+    const double radius = util::Earth::radius();
+    Grid grid(griduid());
+    MeshGenerator meshgenerator("structured");
+    Mesh mesh = meshgenerator.generate(grid, Distribution(grid, Partitioner("equal_regions")));
+    fvm::Method fvm(mesh, util::Config("radius", radius) | option::levels(5));
+    Nabla fused(fvm, util::Config("fused", true));
+    Nabla reference(fvm, util::Config("fused", false));
+
+    auto do_test = [&](auto value, double tolerance) {
+        using Value = std::decay_t<decltype(value)>;
+
+        auto create_field = [&](const std::string& name, int variables) {
+            return fvm.node_columns().createField<Value>(option::name(name) | option::variables(variables));
+        };
+        auto expect_equal = [&](const Field& field, const Field& ref) {
+            const Value* f = field.array().data<Value>();
+            const Value* r = ref.array().data<Value>();
+            double rmax    = 0;
+            for (size_t j = 0; j < ref.size(); ++j) {
+                rmax = std::max(rmax, double(std::abs(r[j])));
+            }
+            for (size_t j = 0; j < ref.size(); ++j) {
+                EXPECT_APPROX_EQ(f[j], r[j], tolerance * rmax);
+            }
+        };
+
+        Field scalar = create_field("scalar", 1);
+        Field wind   = create_field("wind", 2);
+        rotated_flow_magnitude<Value>(fvm, scalar, M_PI_2 * 0.75);
+        rotated_flow<Value>(fvm, wind, M_PI_2 * 0.75);
+
+        Field grad  = create_field("grad", 2);
+        Field rgrad = create_field("rgrad", 2);
+        fused.gradient(scalar, grad);
+        reference.gradient(scalar, rgrad);
+        expect_equal(grad, rgrad);
+
+        Field div  = create_field("div", 1);
+        Field rdiv = create_field("rdiv", 1);
+        fused.divergence(wind, div);
+        reference.divergence(wind, rdiv);
+        expect_equal(div, rdiv);
+
+        Field vor  = create_field("vor", 1);
+        Field rvor = create_field("rvor", 1);
+        fused.curl(wind, vor);
+        reference.curl(wind, rvor);
+        expect_equal(vor, rvor);
+
+        Field lapl  = create_field("lapl", 1);
+        Field rlapl = create_field("rlapl", 1);
+        fused.laplacian(scalar, lapl);
+        reference.laplacian(scalar, rlapl);
+        expect_equal(lapl, rlapl);
+
+        FieldSet scalars, gradients, vectors, divergences, curls;
+        scalars.add(scalar);
+        scalars.add(lapl);
+        gradients.add(create_field("grad_scalar", 2));
+        gradients.add(create_field("grad_lapl", 2));
+        vectors.add(wind);
+        vectors.add(grad);
+        divergences.add(create_field("div_wind", 1));
+        divergences.add(create_field("div_grad", 1));
+        curls.add(create_field("curl_wind", 1));
+        curls.add(create_field("curl_grad", 1));
+        fused.gradient_divergence_curl(scalars, gradients, vectors, divergences, curls);
+
+        FieldSet rgradients, rdivergences, rcurls;
+        for (idx_t j = 0; j < 2; ++j) {
+            rgradients.add(create_field("rgrad_" + std::to_string(j), 2));
+            rdivergences.add(create_field("rdiv_" + std::to_string(j), 1));
+            rcurls.add(create_field("rcurl_" + std::to_string(j), 1));
+        }
+        reference.gradient_divergence_curl(scalars, rgradients, vectors, rdivergences, rcurls);
+        for (idx_t j = 0; j < 2; ++j) {
+            expect_equal(gradients[j], rgradients[j]);
+            expect_equal(divergences[j], rdivergences[j]);
+            expect_equal(curls[j], rcurls[j]);
+        }
+    };
+    SECTION("double precision") {
+        do_test(double{}, 1.e-12);
+    }
+    SECTION("single precision") {
+        do_test(float{}, 1.e-4);
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
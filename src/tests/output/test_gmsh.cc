@@ -8,9 +8,14 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include "atlas/array/MakeView.h"
+#include "atlas/mesh/HybridElements.h"
 #include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/output/Output.h"
+#include "atlas/output/detail/GmshIO.h"
+#include "atlas/parallel/mpi/mpi.h"
 
 #include "tests/AtlasTestEnvironment.h"
 #include "tests/TestMeshes.h"
@@ -34,6 +39,32 @@ CASE("test_gmsh_output_2") {
     // gmsh.write( mesh );
 }
 
+CASE("test_gmsh_output_binary") {
+    if (mpi::size() != 1) {
+        return;
+    }
+    Mesh mesh = test::generate_mesh(Grid("N32"));
+    output::Gmsh("test_gmsh_output_ascii.msh", util::Config("binary", false)).write(mesh);
+    output::Gmsh("test_gmsh_output_binary.msh", util::Config("binary", true)).write(mesh);
+
+    output::detail::GmshIO reader;
+    Mesh ascii  = reader.read("test_gmsh_output_ascii.msh");
+    Mesh binary = reader.read("test_gmsh_output_binary.msh");
+
+    EXPECT_EQ(binary.nodes().size(), mesh.nodes().size());
+    EXPECT_EQ(binary.nodes().size(), ascii.nodes().size());
+    EXPECT_EQ(binary.cells().size(), ascii.cells().size());
+    auto xy_a   = array::make_view<double, 2>(ascii.nodes().xy());
+    auto xy_b   = array::make_view<double, 2>(binary.nodes().xy());
+    auto gidx_a = array::make_view<gidx_t, 1>(ascii.nodes().global_index());
+    auto gidx_b = array::make_view<gidx_t, 1>(binary.nodes().global_index());
+    for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+        EXPECT_EQ(gidx_b(n), gidx_a(n));
+        EXPECT_EQ(xy_b(n, 0), xy_a(n, 0));
+        EXPECT_EQ(xy_b(n, 1), xy_a(n, 1));
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
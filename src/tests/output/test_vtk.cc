@@ -0,0 +1,160 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "atlas/array/MakeView.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/CellColumns.h"
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/output/VTK.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/Topology.h"
+
+#include "tests/AtlasTestEnvironment.h"
+#include "tests/TestMeshes.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+std::string read_file(const std::string& path) {
+    std::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+    EXPECT(file.is_open());
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Piece of this task written for the given file name
+std::string piece_path(const std::string& file) {
+    if (mpi::size() == 1) {
+        return file + ".vtu";
+    }
+    return file + "_p" + std::to_string(mpi::rank()) + ".vtu";
+}
+
+std::string attribute(const std::string& content, const std::string& name) {
+    auto begin = content.find(name + "=\"");
+    EXPECT(begin != std::string::npos);
+    begin += name.size() + 2;
+    return content.substr(begin, content.find('"', begin) - begin);
+}
+
+// Appended data block of the data array that is declared first after the given XML text
+std::string appended_block(const std::string& content, const std::string& after) {
+    auto declaration = content.find(after);
+    EXPECT(declaration != std::string::npos);
+    size_t offset = std::stoul(attribute(content.substr(declaration), "offset"));
+    const std::string appended = "<AppendedData encoding=\"raw\">\n_";
+    size_t begin               = content.find(appended) + appended.size() + offset;
+    std::uint64_t bytes;
+    std::memcpy(&bytes, content.data() + begin, sizeof(bytes));
+    return content.substr(begin + sizeof(bytes), bytes);
+}
+
+// Cells written without the "ghost" option
+bool written(const Mesh& mesh, idx_t e) {
+    auto halo  = array::make_view<int, 1>(mesh.cells().halo());
+    auto flags = array::make_view<int, 1>(mesh.cells().flags());
+    return halo(e) == 0 && not util::Topology::view(flags(e)).check(util::Topology::INVALID);
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE("test_vtk_mesh") {
+    Mesh mesh = test::generate_mesh(Grid("O16"));
+    output::VTK("test_vtk_mesh.vtu").write(mesh);
+
+    std::string content = read_file(piece_path("test_vtk_mesh"));
+    EXPECT_EQ(std::stol(attribute(content, "NumberOfPoints")), mesh.nodes().size());
+
+    idx_t nb_cells = 0;
+    for (idx_t e = 0; e < mesh.cells().size(); ++e) {
+        nb_cells += written(mesh, e);
+    }
+    EXPECT_EQ(std::stol(attribute(content, "NumberOfCells")), nb_cells);
+
+    std::string points = appended_block(content, "<Points>");
+    EXPECT_EQ(points.size(), 3 * sizeof(double) * mesh.nodes().size());
+    auto xy = array::make_view<double, 2>(mesh.nodes().xy());
+    const double* xyz = reinterpret_cast<const double*>(points.data());
+    for (idx_t n = 0; n < mesh.nodes().size(); ++n) {
+        EXPECT_EQ(xyz[3 * n + 0], xy(n, 0));
+        EXPECT_EQ(xyz[3 * n + 1], xy(n, 1));
+        EXPECT_EQ(xyz[3 * n + 2], 0.);
+    }
+
+    if (mpi::size() > 1 && mpi::rank() == 0) {
+        std::string index = read_file("test_vtk_mesh.pvtu");
+        EXPECT(index.find("<Piece Source=\"test_vtk_mesh_p" + std::to_string(mpi::size() - 1) + ".vtu\"/>") !=
+               std::string::npos);
+    }
+}
+
+CASE("test_vtk_fields") {
+    Mesh mesh = test::generate_mesh(Grid("O16"));
+    output::VTK vtk("test_vtk_fields", util::Config("levels", std::vector<long>{1}));
+
+    functionspace::NodeColumns nodes(mesh, option::levels(3));
+    Field f   = nodes.createField<double>(option::name("f"));
+    auto f_v  = array::make_view<double, 2>(f);
+    auto gidx = array::make_view<gidx_t, 1>(nodes.global_index());
+    for (idx_t n = 0; n < nodes.size(); ++n) {
+        for (idx_t jlev = 0; jlev < 3; ++jlev) {
+            f_v(n, jlev) = gidx(n) * 10. + jlev;
+        }
+    }
+    vtk.write(f, util::Config("file", "test_vtk_fields_nodes.vtu"));
+
+    std::string content = read_file(piece_path("test_vtk_fields_nodes"));
+    EXPECT(content.find("Name=\"f[000]\"") == std::string::npos);
+    std::string values = appended_block(content, "Name=\"f[001]\"");
+    EXPECT_EQ(values.size(), sizeof(double) * nodes.nb_nodes());
+    for (idx_t n = 0; n < nodes.nb_nodes(); ++n) {
+        EXPECT_EQ(reinterpret_cast<const double*>(values.data())[n], f_v(n, 1));
+    }
+
+    functionspace::CellColumns cells(mesh);
+    Field c  = cells.createField<int>(option::name("c"));
+    auto c_v = array::make_view<int, 1>(c);
+    std::vector<int> written_cells;
+    for (idx_t e = 0; e < cells.nb_cells(); ++e) {
+        c_v(e) = e;
+        if (written(mesh, e)) {
+            written_cells.emplace_back(e);
+        }
+    }
+    vtk.write(c, util::Config("file", "test_vtk_fields_cells.vtu"));
+
+    content = read_file(piece_path("test_vtk_fields_cells"));
+    values  = appended_block(content, "Name=\"c\"");
+    EXPECT_EQ(values.size(), sizeof(int) * written_cells.size());
+    EXPECT(std::memcmp(values.data(), written_cells.data(), values.size()) == 0);
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}
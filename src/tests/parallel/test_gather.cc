@@ -607,6 +607,89 @@ CASE("test_gather") {
         f.root = 0;
     }
 
+    SECTION("test_gather_multiple_roots") {
+        // Each column of a rank-1 field is gathered to a different root, in one communication
+        const idx_t roots[] = {0, f.comm_size - 1};
+        const idx_t nglb[]  = {f.rank == roots[0] ? f.gather_scatter.glb_dof() : 0,
+                               f.rank == roots[1] ? f.gather_scatter.glb_dof() : 0};
+        array::ArrayT<POD> loc(f.Nl, 2);
+        std::vector<POD> glb0(nglb[0]);
+        std::vector<POD> glb1(nglb[1]);
+        auto locv = array::make_view<POD, 2>(loc);
+        for (int j = 0; j < f.Nl; ++j) {
+            locv(j, 0) = (f.part[j] != f.rank ? 0 : f.gidx[j] * 10);
+            locv(j, 1) = (f.part[j] != f.rank ? 0 : f.gidx[j] * 100);
+        }
+
+        idx_t loc_strides[] = {2};
+        idx_t glb_strides[] = {1};
+        idx_t extents[]     = {1};
+        parallel::Field<POD const> lfields[] = {
+            parallel::Field<POD const>(loc.data<POD>(), loc_strides, extents, 1),
+            parallel::Field<POD const>(loc.data<POD>() + 1, loc_strides, extents, 1)};
+        parallel::Field<POD> gfields[] = {parallel::Field<POD>(glb0.data(), glb_strides, extents, 1),
+                                          parallel::Field<POD>(glb1.data(), glb_strides, extents, 1)};
+        f.gather_scatter.gather(lfields, gfields, 2, roots);
+
+        if (f.rank == roots[0]) {
+            POD glb_c[] = {10, 20, 30, 40, 50, 60, 70, 80, 90};
+            EXPECT(glb0 == eckit::testing::make_view(glb_c, glb_c + nglb[0]));
+        }
+        if (f.rank == roots[1]) {
+            POD glb_c[] = {100, 200, 300, 400, 500, 600, 700, 800, 900};
+            EXPECT(glb1 == eckit::testing::make_view(glb_c, glb_c + nglb[1]));
+        }
+
+        // Scatter back from both roots into a zeroed field
+        array::ArrayT<POD> loc2(f.Nl, 2);
+        auto loc2v = array::make_view<POD, 2>(loc2);
+        loc2v.assign(0.);
+        parallel::Field<POD const> gfields_c[] = {
+            parallel::Field<POD const>(glb0.data(), glb_strides, extents, 1),
+            parallel::Field<POD const>(glb1.data(), glb_strides, extents, 1)};
+        parallel::Field<POD> lfields2[] = {parallel::Field<POD>(loc2.data<POD>(), loc_strides, extents, 1),
+                                           parallel::Field<POD>(loc2.data<POD>() + 1, loc_strides, extents, 1)};
+        f.gather_scatter.scatter(gfields_c, lfields2, 2, roots);
+        for (int j = 0; j < f.Nl; ++j) {
+            EXPECT(loc2v(j, 0) == locv(j, 0));
+            EXPECT(loc2v(j, 1) == locv(j, 1));
+        }
+    }
+
+    SECTION("test_gather_windows") {
+        for (f.root = 0; f.root < f.comm_size; ++f.root) {
+            array::ArrayT<POD> loc(f.Nl, 2);
+            auto locv = array::make_view<POD, 2>(loc);
+            for (int j = 0; j < f.Nl; ++j) {
+                locv(j, 0) = (f.part[j] != f.rank ? 0 : f.gidx[j] * 10);
+                locv(j, 1) = (f.part[j] != f.rank ? 0 : f.gidx[j] * 100);
+            }
+            idx_t strides[] = {1};
+            idx_t extents[] = {2};
+            parallel::Field<POD const> lfield(loc.data<POD>(), strides, extents, 1);
+
+            std::vector<POD> glb;
+            idx_t nb_windows = 0;
+            f.gather_scatter.gather(&lfield, 1, 4, [&](idx_t jfield, idx_t begin, idx_t end, const POD data[]) {
+                EXPECT(jfield == 0);
+                EXPECT(begin == idx_t(glb.size()) / 2);
+                EXPECT(end - begin <= 4);
+                glb.insert(glb.end(), data, data + (end - begin) * 2);
+                ++nb_windows;
+            }, f.root);
+
+            if (f.rank == f.root) {
+                POD glb_c[] = {10, 100, 20, 200, 30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800, 90, 900};
+                EXPECT(glb == eckit::testing::make_view(glb_c, glb_c + 18));
+                EXPECT(nb_windows == 3);
+            }
+            else {
+                EXPECT(nb_windows == 0);
+            }
+        }
+        f.root = 0;
+    }
+
     SECTION("test_scatter_rank2_ArrayView") {
         for (f.root = 0; f.root < f.comm_size; ++f.root) {
             array::ArrayT<POD> loc(f.Nl, 3, 2);
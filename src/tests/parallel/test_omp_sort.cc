@@ -85,6 +85,46 @@ CASE("test_merge_blocks") {
     EXPECT(std::is_sorted(integers.begin(), integers.end()));
 }
 
+CASE("test_merge") {
+    auto first  = create_random_data(300000);
+    auto second = create_random_data(700000);
+    omp::sort(first.begin(), first.end());
+    omp::sort(second.begin(), second.end());
+
+    std::vector<int> merged(first.size() + second.size());
+    auto end = omp::merge(first.begin(), first.end(), second.begin(), second.end(), merged.begin());
+    EXPECT(end == merged.end());
+    EXPECT(std::is_sorted(merged.begin(), merged.end()));
+
+    std::vector<int> expected(merged.size());
+    std::merge(first.begin(), first.end(), second.begin(), second.end(), expected.begin());
+    EXPECT(merged == expected);
+}
+
+CASE("test_radix_sort") {
+    SECTION("signed integers") {
+        for (int n : {20, 1000000}) {
+            auto integers = create_random_data(n);
+            for (size_t i = 0; i < integers.size(); i += 2) {
+                integers[i] = -integers[i];
+            }
+            std::vector<long> values(integers.begin(), integers.end());
+            omp::radix_sort(values.begin(), values.end());
+            EXPECT(std::is_sorted(values.begin(), values.end()));
+        }
+    }
+
+    SECTION("stable sort with key") {
+        auto integers = create_random_data(1000000);
+        std::vector<std::pair<int, int>> pairs(integers.size());
+        for (size_t i = 0; i < pairs.size(); ++i) {
+            pairs[i] = {integers[i] % 100, static_cast<int>(i)};
+        }
+        omp::radix_sort(pairs.begin(), pairs.end(), [](const std::pair<int, int>& p) { return p.first; });
+        EXPECT(std::is_sorted(pairs.begin(), pairs.end()));
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
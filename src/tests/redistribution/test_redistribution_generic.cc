@@ -491,6 +491,59 @@ CASE("Structured grid") {
     }
 }
 
+CASE("Structured grid mixed field set with execute_start and execute_finish") {
+    auto grid = atlas::Grid("L24x19");
+
+    auto sourceMesh = MeshGenerator("structured", util::Config("partitioner", "equal_regions")).generate(grid);
+    auto targetMesh = MeshGenerator("structured", util::Config("partitioner", "equal_bands")).generate(grid);
+
+    const auto sourceFunctionSpace = functionspace::NodeColumns(sourceMesh, util::Config("halo", 1));
+    const auto targetFunctionSpace = functionspace::NodeColumns(targetMesh, util::Config("halo", 1));
+    const auto redist              = Redistribution(sourceFunctionSpace, targetFunctionSpace);
+
+    auto sourceFieldSet = FieldSet{};
+    auto targetFieldSet = FieldSet{};
+    sourceFieldSet.add(sourceFunctionSpace.createField<double>(fieldConfig<2>()));
+    sourceFieldSet.add(sourceFunctionSpace.createField<int>(fieldConfig<1>()));
+    targetFieldSet.add(targetFunctionSpace.createField<double>(fieldConfig<2>()));
+    targetFieldSet.add(targetFunctionSpace.createField<int>(fieldConfig<1>()));
+
+    auto sourceLonlatView = array::make_view<double, 2>(sourceFunctionSpace.lonlat());
+    auto targetLonlatView = array::make_view<double, 2>(targetFunctionSpace.lonlat());
+    auto sourceView2      = array::make_view<double, 2>(sourceFieldSet[0]);
+    auto sourceView1      = array::make_view<int, 1>(sourceFieldSet[1]);
+    for (idx_t i = 0; i < sourceView2.shape(0); ++i) {
+        for (idx_t j = 0; j < sourceView2.shape(1); ++j) {
+            sourceView2(i, j) = testPattern<double>(sourceLonlatView(i, LON), sourceLonlatView(i, LAT), j);
+        }
+        sourceView1(i) = testPattern<int>(sourceLonlatView(i, LON), sourceLonlatView(i, LAT), 0);
+    }
+
+    // Repeat, to reuse the persistent buffers.
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        redist.execute_start(sourceFieldSet, targetFieldSet);
+
+        // Source fields may be modified once execute_start returns.
+        auto sourceCopy = sourceView1(0);
+        sourceView1(0)  = -1;
+
+        redist.execute_finish(sourceFieldSet, targetFieldSet);
+        sourceView1(0) = sourceCopy;
+
+        targetFunctionSpace.haloExchange(targetFieldSet);
+
+        auto targetView2 = array::make_view<double, 2>(targetFieldSet[0]);
+        auto targetView1 = array::make_view<int, 1>(targetFieldSet[1]);
+        for (idx_t i = 0; i < targetView2.shape(0); ++i) {
+            for (idx_t j = 0; j < targetView2.shape(1); ++j) {
+                EXPECT(checkValue(targetView2(i, j),
+                                  testPattern<double>(targetLonlatView(i, LON), targetLonlatView(i, LAT), j)));
+            }
+            EXPECT(checkValue(targetView1(i), testPattern<int>(targetLonlatView(i, LON), targetLonlatView(i, LAT), 0)));
+        }
+    }
+}
+
 CASE("Cubed sphere grid") {
     auto grid = atlas::Grid("CS-LFR-C-8");
 
@@ -347,6 +347,78 @@ CASE("Redistribute Structured Columns") {
     }
 }
 
+CASE("Redistribute Structured Columns with execute_start and execute_finish") {
+    auto grid = atlas::Grid("O16");
+
+    const auto bands   = atlas::functionspace::StructuredColumns(grid, atlas::grid::Partitioner("equal_bands"),
+                                                               funcSpaceDefaultConfig());
+    const auto regions = atlas::functionspace::StructuredColumns(grid, atlas::grid::Partitioner("equal_regions"),
+                                                                 funcSpaceDefaultConfig());
+    const auto checkerboard = atlas::functionspace::StructuredColumns(grid, atlas::grid::Partitioner("checkerboard"),
+                                                                      funcSpaceDefaultConfig());
+
+    auto writePattern = [&](const atlas::functionspace::StructuredColumns& fs, atlas::FieldSet& fieldSet) {
+        for (idx_t field = 0; field < fieldSet.size(); ++field) {
+            auto fieldView = atlas::array::make_view<double, 2>(fieldSet[field]);
+            for (idx_t j = fs.j_begin(); j < fs.j_end(); ++j) {
+                for (idx_t i = fs.i_begin(j); i < fs.i_end(j); ++i) {
+                    const auto lonLat = grid.projection().lonlat(fs.compute_xy(i, j));
+                    for (idx_t level = 0; level < fs.levels(); ++level) {
+                        fieldView(fs.index(i, j), level) =
+                            testPattern<double>(lonLat.lon(), lonLat.lat(), field, level);
+                    }
+                }
+            }
+        }
+    };
+    auto checkPattern = [&](const atlas::functionspace::StructuredColumns& fs, const atlas::FieldSet& fieldSet) {
+        bool testPassed = true;
+        for (idx_t field = 0; field < fieldSet.size(); ++field) {
+            auto fieldView = atlas::array::make_view<const double, 2>(fieldSet[field]);
+            for (idx_t j = fs.j_begin(); j < fs.j_end(); ++j) {
+                for (idx_t i = fs.i_begin(j); i < fs.i_end(j); ++i) {
+                    const auto lonLat = grid.projection().lonlat(fs.compute_xy(i, j));
+                    for (idx_t level = 0; level < fs.levels(); ++level) {
+                        testPassed = testPassed && (fieldView(fs.index(i, j), level) ==
+                                                    testPattern<double>(lonLat.lon(), lonLat.lat(), field, level));
+                    }
+                }
+            }
+        }
+        return testPassed;
+    };
+    auto createFieldSet = [](const atlas::functionspace::StructuredColumns& fs, idx_t nFields) {
+        auto fieldSet = atlas::FieldSet{};
+        for (idx_t field = 0; field < nFields; ++field) {
+            fieldSet.add(fs.createField<double>(atlas::option::name("field_" + std::to_string(field))));
+        }
+        return fieldSet;
+    };
+
+    const auto config  = util::Config("type", "RedistributeStructuredColumns");
+    const auto redist1 = atlas::Redistribution(bands, regions, config);
+    const auto redist2 = atlas::Redistribution(regions, checkerboard, config);
+
+    auto source1 = createFieldSet(bands, 3);
+    auto target1 = createFieldSet(regions, 3);
+    auto source2 = createFieldSet(regions, 2);
+    auto target2 = createFieldSet(checkerboard, 2);
+    writePattern(bands, source1);
+    writePattern(regions, source2);
+
+    // Both exchanges are in flight at the same time, and are finished in reverse order.
+    // Repeat, to reuse the persistent buffers.
+    for (int iteration = 0; iteration < 2; ++iteration) {
+        redist1.execute_start(source1, target1);
+        redist2.execute_start(source2, target2);
+        redist2.execute_finish(source2, target2);
+        redist1.execute_finish(source1, target1);
+
+        EXPECT(checkPattern(regions, target1));
+        EXPECT(checkPattern(checkerboard, target2));
+    }
+}
+
 CASE("Redistribute Structured Columns with split comms") {
     Fixture fixture;
     SECTION("lonlat: checkerboard to equal_regions") {
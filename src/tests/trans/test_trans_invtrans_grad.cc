@@ -16,6 +16,7 @@
 #include "atlas/functionspace/Spectral.h"
 #include "atlas/functionspace/StructuredColumns.h"
 #include "atlas/grid/Distribution.h"
+#include "atlas/grid/Partitioner.h"
 #include "atlas/grid/detail/partitioner/EqualRegionsPartitioner.h"
 #include "atlas/grid/detail/partitioner/TransPartitioner.h"
 #include "atlas/mesh/Mesh.h"
@@ -184,6 +185,44 @@ CASE("test_invtrans_grad") {
     }
 }
 
+CASE("test_invtrans_grad with tiled StructuredColumns") {
+    StructuredGrid g("O48");
+    idx_t N = g.ny() / 2;
+    trans::Trans trans(g, 2 * N - 1);
+    functionspace::Spectral sp(trans);
+    functionspace::StructuredColumns rows(g, grid::Partitioner("ectrans"));
+    functionspace::StructuredColumns tiles(g, grid::Partitioner("ectrans"),
+                                           util::Config("ordering", "tiles") |
+                                               util::Config("tile_size", std::vector<long>{4, 2}));
+
+    Field scalar_sp = sp.createField<double>(option::name("scalar_sp"));
+    Field scalar    = rows.createField<double>(option::name("scalar"));
+    {
+        const double deg2rad = M_PI / 180.;
+        auto xy              = array::make_view<double, 2>(rows.xy());
+        auto var             = array::make_view<double, 1>(scalar);
+        for (idx_t n = 0; n < rows.sizeOwned(); ++n) {
+            var(n) = std::cos(xy(n, YY) * deg2rad) * std::sin(xy(n, XX) * deg2rad);
+        }
+    }
+    trans.dirtrans(scalar, scalar_sp);
+
+    Field grad_rows  = rows.createField<double>(option::name("grad") | option::variables(2));
+    Field grad_tiles = tiles.createField<double>(option::name("grad") | option::variables(2));
+    trans.invtrans_grad(scalar_sp, grad_rows);
+    trans.invtrans_grad(scalar_sp, grad_tiles);
+
+    auto r = array::make_view<double, 2>(grad_rows);
+    auto t = array::make_view<double, 2>(grad_tiles);
+    for (idx_t j = tiles.j_begin(); j < tiles.j_end(); ++j) {
+        for (idx_t i = tiles.i_begin(j); i < tiles.i_end(j); ++i) {
+            for (idx_t v = 0; v < 2; ++v) {
+                EXPECT_EQ(t(tiles.index(i, j), v), r(rows.index(i, j), v));
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
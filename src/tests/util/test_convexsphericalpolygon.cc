@@ -581,6 +581,43 @@ CASE("Edge cases in polygon intersections") {
 
 }
 
+CASE("Batched intersection") {
+    const double pointsSameEPS = 5.e6 * EPS;
+    auto target                = make_polygon({{0., 10.}, {0., 0.}, {10., 0.}, {10., 10.}});
+
+    std::vector<ConvexSphericalPolygon> candidates;
+    for (double lon = -6.; lon < 14.; lon += 2.5) {
+        for (double lat = -6.; lat < 14.; lat += 2.5) {
+            candidates.emplace_back(make_polygon({{lon, lat + 3.}, {lon, lat}, {lon + 3., lat}, {lon + 3., lat + 3.}}));
+            candidates.emplace_back(make_polygon({{lon, lat + 1.}, {lon + 1., lat}, {lon + 2., lat + 2.}}));
+        }
+    }
+    candidates.emplace_back(make_polygon({{100., 10.}, {100., 0.}, {110., 0.}}));
+
+    util::ConvexSphericalPolygonBatch batch;
+    for (const auto& candidate : candidates) {
+        batch.add(candidate);
+    }
+    EXPECT_EQ(batch.size(), candidates.size());
+
+    batch.intersect(target, pointsSameEPS);
+    double covered_area = 0.;
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        auto iplg = candidates[i].intersect(target, nullptr, pointsSameEPS);
+        EXPECT_APPROX_EQ(batch.area(i), iplg.area(), 1.e-15);
+        if (iplg.area() > 0.) {
+            EXPECT_APPROX_EQ(PointXYZ::distance(batch.centroid(i), iplg.centroid()), 0., 1.e-4);
+        }
+        covered_area += batch.area(i);
+    }
+    EXPECT(covered_area > target.area());
+    EXPECT_EQ(batch.area(candidates.size() - 1), 0.);
+
+    // Reuse of the batch for another target
+    batch.intersect(make_polygon({{100., 10.}, {100., 0.}, {110., 0.}}), pointsSameEPS);
+    EXPECT_APPROX_EQ(batch.area(candidates.size() - 1), candidates.back().area(), 1.e-15);
+}
+
 //-----------------------------------------------------------------------------
 
 }  // end namespace test
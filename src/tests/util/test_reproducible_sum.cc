@@ -0,0 +1,122 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/util/ReproducibleSum.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using atlas::util::ReproducibleSum;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+std::vector<double> random_values(size_t n, unsigned seed) {
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> mantissa(-1., 1.);
+    std::uniform_int_distribution<int> exponent(-30, 30);
+    std::vector<double> values(n);
+    for (auto& v : values) {
+        v = std::ldexp(mantissa(generator), exponent(generator));
+    }
+    return values;
+}
+
+CASE("test_sum_is_exact") {
+    ReproducibleSum sum;
+    for (int i = 0; i < 10; ++i) {
+        sum += 0.1;
+    }
+    EXPECT_EQ(sum.value(), 1.);
+
+    ReproducibleSum cancel;
+    cancel += 1.e308;
+    cancel += 1.e308;
+    cancel += -1.e308;
+    cancel += 1.;
+    cancel += -1.e308;
+    EXPECT_EQ(cancel.value(), 1.);
+
+    ReproducibleSum tiny;
+    tiny += std::numeric_limits<double>::denorm_min();
+    tiny += -1.;
+    tiny += 1.;
+    EXPECT_EQ(tiny.value(), std::numeric_limits<double>::denorm_min());
+
+    ReproducibleSum negative;
+    negative += -3.5;
+    negative += 0.25;
+    EXPECT_EQ(negative.value(), -3.25);
+}
+
+CASE("test_sum_is_order_independent") {
+    auto values = random_values(100000, 1);
+    ReproducibleSum forward;
+    for (double v : values) {
+        forward += v;
+    }
+
+    std::shuffle(values.begin(), values.end(), std::mt19937_64(2));
+    std::vector<ReproducibleSum> partial(7);
+    for (size_t i = 0; i < values.size(); ++i) {
+        partial[i % partial.size()] += values[i];
+    }
+    ReproducibleSum combined;
+    for (auto it = partial.rbegin(); it != partial.rend(); ++it) {
+        combined += *it;
+    }
+    EXPECT_EQ(forward.value(), combined.value());
+}
+
+CASE("test_non_finite") {
+    ReproducibleSum sum;
+    sum += 1.;
+    sum += std::numeric_limits<double>::infinity();
+    EXPECT_EQ(sum.value(), std::numeric_limits<double>::infinity());
+    sum += -std::numeric_limits<double>::infinity();
+    EXPECT(std::isnan(sum.value()));
+}
+
+CASE("test_allreduce") {
+    const auto& comm = mpi::comm();
+    auto values      = random_values(10000, 3);
+
+    ReproducibleSum serial;
+    for (double v : values) {
+        serial += v;
+    }
+
+    // Every task sums an interleaved subset of the values
+    std::vector<ReproducibleSum> distributed(2);
+    for (size_t i = comm.rank(); i < values.size(); i += comm.size()) {
+        distributed[0] += values[i];
+        distributed[1] += -values[i];
+    }
+    ReproducibleSum::allReduce(distributed, comm);
+    EXPECT_EQ(distributed[0].value(), serial.value());
+    EXPECT_EQ(distributed[1].value(), -serial.value());
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main(int argc, char** argv) {
+    return atlas::test::run(argc, argv);
+}